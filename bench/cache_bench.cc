@@ -0,0 +1,408 @@
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <atomic>
+#include <chrono>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include "common.h"
+#include "timer_queue.h"
+#include "socket_group_epoll_impl.h"
+#include "cluster_client.h"
+#include "cache_metrics.h"
+#include "multi_reactor_server.h"
+
+//usage: cache_bench [--name=value ...]
+//	--servers=host:port[,host:port...]	servers to drive,127.0.0.1:3824 by default
+//	--embedded=N		start a server of N reactors in this process on the first server's port
+//	--keys=N			key space,cache ids 0..N-1
+//	--dist=uniform|zipf	key distribution,--theta=0.99 skews zipf
+//	--read-ratio=0.9	share of reads,the rest are updates
+//	--value-size=100	bytes of an updated value
+//	--concurrency=N		workers,each with a socket and a thread of its own
+//	--rate=N			operations per second over all workers
+//	--duration=10 --warmup=2	seconds measured,seconds run before
+//	--outstanding=N		operations a worker has on the way at most,later ones wait
+//	--timeout=ms		operation deadline
+//	--no-preload		don't write every key before the run
+//	--spin				poll instead of sleeping when the next operation is due within 1 ms,
+//						for sub millisecond pacing on hosts with cores to spare
+//
+//open loop:operations are due at a fixed rate whatever the server does,
+//latency counts from when an operation was due,not when it could be sent,
+//so a stalled server shows in the percentiles instead of slowing the load
+//(coordinated omission). service time counts from the send.
+//reads of a key a worker holds a lease on are answered by its lease cache,
+//an update of a key updated less than a lease ago waits for that lease to end.
+//a preload is followed by a wait of kDefaultExpireMillisecond so the run
+//doesn't start with every key guaranteed
+using namespace csn;
+
+namespace {
+struct BenchOptions {
+	std::vector<std::pair<std::string, uint16_t>> servers{};
+	uint32_t embedded = 0;
+	uint32_t keys = 100000;
+	bool	 zipf = false;
+	double	 theta = 0.99;
+	double	 read_ratio = 0.9;
+	uint32_t value_size = 100;
+	uint32_t concurrency = 4;
+	double	 rate = 20000;
+	double	 duration = 10;
+	double	 warmup = 2;
+	uint32_t outstanding = 1024;
+	uint32_t timeout = ProtobufMessageClientImpl::kDefaultOperationTimeout;
+	bool	 preload = true;
+	bool	 spin = false;
+};
+
+uint64_t now_ns() {
+	return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+		std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+//splitmix64 finalizer,scatters hot ranks over the key space
+uint64_t mix(uint64_t value) {
+	value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+	value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+	return value ^ (value >> 31);
+}
+
+//
+// zipfian ranks as in YCSB(Gray et al. "Quickly generating billion-record
+// synthetic databases"),rank 0 the hottest,zeta of the key space computed once
+class ZipfianKeys {
+public:
+	ZipfianKeys(uint32_t keys, double theta) :keys_(keys), theta_(theta), zetan_(0), alpha_(0), eta_(0) {
+		for (uint32_t i = 1; i <= keys; ++i)
+			zetan_ += 1.0 / std::pow((double)i, theta);
+		double zeta2 = 1.0 + 1.0 / std::pow(2.0, theta);
+		alpha_ = 1.0 / (1.0 - theta);
+		eta_ = (1.0 - std::pow(2.0 / keys, 1.0 - theta)) / (1.0 - zeta2 / zetan_);
+	}
+	//u:uniform in [0,1)
+	uint32_t rank(double u) const {
+		double uz = u * zetan_;
+		if (uz < 1.0)
+			return 0;
+		if (uz < 1.0 + std::pow(0.5, theta_))
+			return 1;
+		return std::min<uint32_t>((uint32_t)(keys_ * std::pow(eta_ * u - eta_ + 1.0, alpha_)), keys_ - 1);
+	}
+private:
+	uint32_t keys_;
+	double	 theta_;
+	double	 zetan_;
+	double	 alpha_;
+	double	 eta_;
+};
+
+//latencies of one operation type,buckets as the metrics registry keeps them
+struct LatencyRecorder {
+	LatencyRecorder() :corrected(MetricBuckets::kBucketCount, 0), service(MetricBuckets::kBucketCount, 0),
+		count(0), max_corrected(0), max_service(0) {}
+	void record(uint64_t corrected_ns, uint64_t service_ns) {
+		++corrected[MetricBuckets::index_of(corrected_ns)];
+		++service[MetricBuckets::index_of(service_ns)];
+		++count;
+		max_corrected = std::max(max_corrected, corrected_ns);
+		max_service = std::max(max_service, service_ns);
+	}
+	void merge(const LatencyRecorder& other) {
+		for (uint32_t i = 0; i < MetricBuckets::kBucketCount; ++i) {
+			corrected[i] += other.corrected[i];
+			service[i] += other.service[i];
+		}
+		count += other.count;
+		max_corrected = std::max(max_corrected, other.max_corrected);
+		max_service = std::max(max_service, other.max_service);
+	}
+	std::vector<uint64_t> corrected;
+	std::vector<uint64_t> service;
+	uint64_t count;
+	uint64_t max_corrected;
+	uint64_t max_service;
+};
+
+struct WorkerStats {
+	uint64_t		sent = 0;
+	uint64_t		completed = 0;
+	//indexed by OpResult
+	uint64_t		results[kOpResultCount] = {};
+	//operations still on the way when the worker gave up waiting
+	uint64_t		unfinished = 0;
+	//completed within the measured window
+	uint64_t		measured = 0;
+	LatencyRecorder reads{};
+	LatencyRecorder updates{};
+};
+
+//
+// one client socket driven by one thread,due times are spaced evenly and
+// workers start staggered so the load over all of them is smooth
+class BenchWorker {
+	enum BenchWorkerLimits {
+		kPreloadBatch = 128,
+		//deferred updates wait out a lease at most
+		kDrainMillisecond = kDefaultExpireMillisecond + 2000,
+	};
+public:
+	BenchWorker(const BenchOptions& options, const ZipfianKeys* zipf, uint32_t index) :
+		options_(options), zipf_(zipf), index_(index), group_(),
+		cluster_(group_, 1, (uint8_t)index), random_(mix(index + 1)), value_(options.value_size, 'v'),
+		outstanding_(0), stats_() {}
+	//before run(),every worker writes its share of the keys
+	void preload() {
+		group_.add_timer_source(TimerQueue::get_timer_queue());
+		for (auto& server : options_.servers)
+			cluster_.add_server(server.first, server.second);
+		cluster_.set_operation_timeout(options_.timeout);
+		if (!options_.preload)
+			return;
+		ClusterClient<SocketGroupEpollImpl>::CacheItems items{};
+		for (uint32_t key = index_; key < options_.keys; key += options_.concurrency) {
+			items.emplace_back(key, value_);
+			if (items.size() == kPreloadBatch || key + options_.concurrency >= options_.keys) {
+				outstanding_ += items.size();
+				cluster_.update_many_async(std::move(items), [this](OpResult, std::time_t, uint32_t, CacheDataType) {
+					--outstanding_; });
+				items.clear();
+				while (outstanding_)
+					group_.listen(0.01);
+			}
+		}
+	}
+	//start:due time of the first operation,measure_from/until:window counted
+	void run(uint64_t start, uint64_t measure_from, uint64_t until) {
+		uint64_t interval = (uint64_t)(1e9 * options_.concurrency / options_.rate);
+		uint64_t due = start + interval * index_ / options_.concurrency;
+		measure_from_ = measure_from;
+		measure_until_ = until;
+		while (true) {
+			uint64_t now = now_ns();
+			if (now >= until)
+				break;
+			while (due <= now && due < until && outstanding_ < options_.outstanding) {
+				issue(due, now);
+				due += interval;
+			}
+			//listen() waits whole milliseconds,operations due sooner go out a bit late
+			//unless spinning,the lateness counts in their latency
+			double wait = due > now ? (double)std::min(due, until) - (double)now : 0;
+			if (outstanding_ >= options_.outstanding || (wait < 1e6 && !options_.spin))
+				wait = std::max(wait, 1e6);
+			group_.listen(wait < 1e6 ? 0 : wait / 1e9);
+		}
+		uint64_t drain_until = now_ns() + (uint64_t)kDrainMillisecond * 1000000;
+		while (outstanding_ && now_ns() < drain_until)
+			group_.listen(0.01);
+		stats_.unfinished = outstanding_;
+	}
+	const WorkerStats& stats() const { return stats_; }
+private:
+	uint32_t next_key() {
+		if (zipf_)
+			return (uint32_t)(mix(zipf_->rank(unit_(random_))) % options_.keys);
+		return (uint32_t)(random_() % options_.keys);
+	}
+	void issue(uint64_t due, uint64_t now) {
+		bool read = unit_(random_) < options_.read_ratio;
+		uint32_t key = next_key();
+		++stats_.sent;
+		++outstanding_;
+		auto handle = [this, due, sent = now, read](OpResult result, std::time_t, uint32_t, CacheDataType) {
+			complete(due, sent, read, result);
+		};
+		if (read)
+			cluster_.read_cache_async(key, std::move(handle));
+		else
+			cluster_.update_cache_async(key, value_, std::move(handle));
+	}
+	void complete(uint64_t due, uint64_t sent, bool read, OpResult result) {
+		--outstanding_;
+		++stats_.completed;
+		if (likely((uint32_t)result < kOpResultCount))
+			++stats_.results[result];
+		if (due < measure_from_ || due >= measure_until_)
+			return;
+		++stats_.measured;
+		uint64_t now = now_ns();
+		(read ? stats_.reads : stats_.updates).record(now - due, now - sent);
+	}
+	const BenchOptions&					options_;
+	const ZipfianKeys*					zipf_;
+	uint32_t							index_;
+	SocketGroup<SocketGroupEpollImpl>	group_;
+	ClusterClient<SocketGroupEpollImpl> cluster_;
+	std::mt19937_64						random_;
+	std::uniform_real_distribution<double> unit_{ 0.0, 1.0 };
+	CacheDataType						value_;
+	uint64_t							outstanding_;
+	uint64_t							measure_from_ = 0;
+	uint64_t							measure_until_ = 0;
+	WorkerStats							stats_;
+};
+
+bool parse_servers(const std::string& list, BenchOptions* options) {
+	options->servers.clear();
+	size_t begin = 0;
+	while (begin < list.size()) {
+		size_t end = list.find(',', begin);
+		std::string server = list.substr(begin, end == std::string::npos ? std::string::npos : end - begin);
+		size_t colon = server.rfind(':');
+		if (colon == std::string::npos)
+			return false;
+		options->servers.emplace_back(server.substr(0, colon), (uint16_t)std::atoi(server.c_str() + colon + 1));
+		begin = end == std::string::npos ? list.size() : end + 1;
+	}
+	return !options->servers.empty();
+}
+
+bool parse_options(int argc, char** argv, BenchOptions* options) {
+	for (int i = 1; i < argc; ++i) {
+		std::string arg = argv[i];
+		size_t equal = arg.find('=');
+		std::string name = arg.substr(0, equal);
+		const char* value = equal == std::string::npos ? "" : argv[i] + equal + 1;
+		if (name == "--servers") {
+			if (!parse_servers(value, options))
+				return false;
+		}
+		else if (name == "--embedded")
+			options->embedded = (uint32_t)std::atoi(value);
+		else if (name == "--keys")
+			options->keys = (uint32_t)std::atoll(value);
+		else if (name == "--dist" && (!std::strcmp(value, "zipf") || !std::strcmp(value, "uniform")))
+			options->zipf = !std::strcmp(value, "zipf");
+		else if (name == "--theta")
+			options->theta = std::atof(value);
+		else if (name == "--read-ratio")
+			options->read_ratio = std::atof(value);
+		else if (name == "--value-size")
+			options->value_size = (uint32_t)std::atoi(value);
+		else if (name == "--concurrency")
+			options->concurrency = (uint32_t)std::atoi(value);
+		else if (name == "--rate")
+			options->rate = std::atof(value);
+		else if (name == "--duration")
+			options->duration = std::atof(value);
+		else if (name == "--warmup")
+			options->warmup = std::atof(value);
+		else if (name == "--outstanding")
+			options->outstanding = (uint32_t)std::atoi(value);
+		else if (name == "--timeout")
+			options->timeout = (uint32_t)std::atoi(value);
+		else if (name == "--no-preload")
+			options->preload = false;
+		else if (name == "--spin")
+			options->spin = true;
+		else
+			return false;
+	}
+	if (options->servers.empty())
+		options->servers.emplace_back("127.0.0.1", 3824);
+	return options->keys && options->concurrency && options->concurrency <= 255 && options->rate > 0 &&
+		options->duration > 0 && options->outstanding && options->theta > 0 && options->theta != 1.0;
+}
+
+void report(const char* name, const LatencyRecorder& recorder) {
+	if (!recorder.count) {
+		std::printf("%-7s none\n", name);
+		return;
+	}
+	HistogramSnapshot corrected{ recorder.corrected, recorder.count, 0 };
+	HistogramSnapshot service{ recorder.service, recorder.count, 0 };
+	std::printf("%-7s %10llu  latency p50 %9.3f p99 %9.3f p999 %9.3f max %9.3f ms\n", name,
+		(unsigned long long)recorder.count, corrected.value_at(0.5) / 1e6, corrected.value_at(0.99) / 1e6,
+		corrected.value_at(0.999) / 1e6, recorder.max_corrected / 1e6);
+	std::printf("%-7s %10s  service p50 %9.3f p99 %9.3f p999 %9.3f max %9.3f ms\n", "", "",
+		service.value_at(0.5) / 1e6, service.value_at(0.99) / 1e6, service.value_at(0.999) / 1e6,
+		recorder.max_service / 1e6);
+}
+}
+
+int main(int argc, char** argv)
+{
+	BenchOptions options{};
+	if (!parse_options(argc, argv, &options)) {
+		std::fprintf(stderr, "usage: %s [--servers=host:port,...] [--embedded=reactors] [--keys=N] [--dist=uniform|zipf] "
+			"[--theta=0.99] [--read-ratio=0.9] [--value-size=100] [--concurrency=4] [--rate=20000] [--duration=10] "
+			"[--warmup=2] [--outstanding=1024] [--timeout=ms] [--no-preload] [--spin]\n", argv[0]);
+		return 1;
+	}
+	std::unique_ptr<MultiReactorServer> server;
+	std::unique_ptr<ZipfianKeys> zipf;
+	std::vector<std::unique_ptr<BenchWorker>> workers{};
+	try {
+		if (options.embedded) {
+			server = std::make_unique<MultiReactorServer>(options.embedded);
+			server->start("*", options.servers.front().second);
+		}
+		if (options.zipf)
+			zipf = std::make_unique<ZipfianKeys>(options.keys, options.theta);
+		for (uint32_t i = 0; i < options.concurrency; ++i)
+			workers.push_back(std::make_unique<BenchWorker>(options, zipf.get(), i));
+	}
+	catch (csn::Exception e) {
+		LOG_OUT("csn::Exception code:%d describe:%s", e.code(), e.what());
+		return 1;
+	}
+	std::printf("%u workers,%.0f ops/s,%s keys %u,%.0f%% reads,%u byte values,%.0f s after %.0f s warmup\n",
+		options.concurrency, options.rate, options.zipf ? "zipf" : "uniform", options.keys,
+		options.read_ratio * 100, options.value_size, options.duration, options.warmup);
+	std::fflush(stdout);
+
+	//every worker owns its client from preload on,timers are thread local
+	std::atomic<uint32_t> ready{ 0 };
+	std::atomic<uint64_t> start{ 0 };
+	std::vector<std::thread> threads{};
+	for (auto& worker : workers) {
+		threads.emplace_back([&, worker = worker.get()]() {
+			try {
+				worker->preload();
+				++ready;
+				while (!start.load())
+					std::this_thread::sleep_for(std::chrono::milliseconds(1));
+				uint64_t from = start.load() + (uint64_t)(options.warmup * 1e9);
+				worker->run(start.load(), from, from + (uint64_t)(options.duration * 1e9));
+			}
+			catch (csn::Exception e) { LOG_OUT("worker csn::Exception code:%d describe:%s", e.code(), e.what()); }
+		});
+	}
+	while (ready.load() != workers.size())
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	if (options.preload && options.read_ratio < 1)
+		std::this_thread::sleep_for(std::chrono::milliseconds(kDefaultExpireMillisecond));
+	start.store(now_ns());
+	for (auto& thread : threads)
+		thread.join();
+
+	WorkerStats total{};
+	for (auto& worker : workers) {
+		const WorkerStats& stats = worker->stats();
+		total.sent += stats.sent;
+		total.completed += stats.completed;
+		for (uint32_t i = 0; i < kOpResultCount; ++i)
+			total.results[i] += stats.results[i];
+		total.unfinished += stats.unfinished;
+		total.measured += stats.measured;
+		total.reads.merge(stats.reads);
+		total.updates.merge(stats.updates);
+	}
+	std::printf("sent %llu completed %llu unfinished %llu\n", (unsigned long long)total.sent,
+		(unsigned long long)total.completed, (unsigned long long)total.unfinished);
+	std::printf("ok %llu defer %llu retry %llu error_argument %llu error_no_data %llu timeout %llu\n",
+		(unsigned long long)total.results[kOperationOk], (unsigned long long)total.results[kOperationDefer],
+		(unsigned long long)total.results[kOperationRetry], (unsigned long long)total.results[kOperationErrorArgument],
+		(unsigned long long)total.results[kOperationErrorNoData], (unsigned long long)total.results[kOperationTimeout]);
+	std::printf("throughput %.1f ops/s\n", total.measured / options.duration);
+	report("read", total.reads);
+	report("update", total.updates);
+	if (server)
+		server->stop();
+	return 0;
+}
@@ -0,0 +1,437 @@
+#include <mutex>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <filesystem>
+#include <malloc.h>
+#include <benchmark/benchmark.h>
+#include <google/protobuf/arena.h>
+#include "common.h"
+#include "timer_queue.h"
+#include "cache_data_center.h"
+#include "cache_state_manager.h"
+#include "flat_hash_map.h"
+#include "cache_wal.h"
+#include "cache_message.pb.h"
+#include "protobuf_message_common.h"
+#include "arena_pool.h"
+
+//usage: micro_bench [--benchmark_filter=regex] [--benchmark_repetitions=N] ...
+//hot components one at a time,no sockets. arguments in a name are queue or
+//key counts,threads or value bytes as labelled by the benchmark.
+//leases last kDefaultExpireMillisecond,longer than a benchmark runs,so
+//nothing expires while a case is measured unless it says so
+using namespace csn;
+using CacheMessageProto::CacheMessage;
+using CacheMessageProto::CacheOpResponse;
+
+namespace {
+const uint32_t kTimerSpreadMillisecond = 60000;
+
+//long timers nobody fires,make the wheel as full as a busy server's
+void fill_timers(TimerQueue& queue, int64_t count) {
+	std::mt19937 random(1);
+	for (int64_t i = 0; i < count; ++i)
+		queue.add_timer([]() {}, 1000 + random() % kTimerSpreadMillisecond, 1);
+}
+
+//add and delete,as a response waiting for its ack that comes in time
+void BM_TimerAddDel(benchmark::State& state) {
+	TimerQueue queue{};
+	fill_timers(queue, state.range(0));
+	for (auto _ : state) {
+		size_t timer_id = queue.add_timer([]() {}, 500, 1);
+		queue.del_timer(timer_id);
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_TimerAddDel)->ArgName("timers")->Arg(0)->Arg(1 << 10)->Arg(1 << 16)->Arg(1 << 20);
+
+//add a timer due now and tick,as a lease ending. timers due within the
+//millisecond ticked last fire on the next one,so they go in batches
+void BM_TimerFire(benchmark::State& state) {
+	TimerQueue queue{};
+	fill_timers(queue, state.range(0));
+	uint64_t fired = 0;
+	for (auto _ : state) {
+		queue.add_timer([&fired]() { ++fired; }, 0, 1);
+		queue.tick();
+	}
+	benchmark::DoNotOptimize(fired);
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_TimerFire)->ArgName("timers")->Arg(0)->Arg(1 << 10)->Arg(1 << 16)->Arg(1 << 20);
+
+//tick with nothing due,what every listen() of an event loop pays
+void BM_TimerIdleTick(benchmark::State& state) {
+	TimerQueue queue{};
+	fill_timers(queue, state.range(0));
+	for (auto _ : state)
+		queue.tick();
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_TimerIdleTick)->ArgName("timers")->Arg(0)->Arg(1 << 10)->Arg(1 << 16)->Arg(1 << 20);
+
+//as BM_TimerFire with one callback in kTimerThrowEvery throwing,the timers
+//due behind it go back to the wheel and fire with the next millisecond ticked
+const uint64_t kTimerThrowEvery = 64;
+void BM_TimerFireThrow(benchmark::State& state) {
+	TimerQueue queue{};
+	fill_timers(queue, state.range(0));
+	uint64_t fired = 0;
+	for (auto _ : state) {
+		queue.add_timer([&fired]() {
+			if (++fired % kTimerThrowEvery == 0)
+				throw std::runtime_error("timer");
+		}, 0, 1);
+		try {
+			queue.tick();
+		}
+		catch (const std::runtime_error&) {
+		}
+	}
+	benchmark::DoNotOptimize(fired);
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_TimerFireThrow)->ArgName("timers")->Arg(0)->Arg(1 << 10)->Arg(1 << 16)->Arg(1 << 20);
+
+//
+// one center per key count,shared by the threads of a case and kept for the
+// rest of the run,keys written once and left idle
+std::shared_ptr<CacheDataCenter<CacheDataType>> center_of(int64_t keys) {
+	static std::mutex mutex;
+	static std::unordered_map<int64_t, std::shared_ptr<CacheDataCenter<CacheDataType>>> centers;
+	std::lock_guard<std::mutex> lock(mutex);
+	auto& center = centers[keys];
+	if (!center) {
+		center = std::make_shared<CacheDataCenter<CacheDataType>>();
+		std::string value(100, 'v');
+		for (int64_t key = 0; key < keys; ++key)
+			center->restore((uint64_t)key, 1, value);
+	}
+	return center;
+}
+
+//read hits,the first read of a key grants its lease,later ones renew it
+void BM_CenterRead(benchmark::State& state) {
+	std::shared_ptr<CacheDataCenter<CacheDataType>> center = center_of(state.range(0));
+	std::mt19937_64 random(state.thread_index() + 1);
+	std::time_t expire{};
+	CacheDataType value{};
+	for (auto _ : state) {
+		OpResult ret = center->read_op(random() % (uint64_t)state.range(0), 1, &expire, &value, 1);
+		benchmark::DoNotOptimize(ret);
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_CenterRead)->ArgName("keys")->Arg(1 << 10)->Arg(1 << 16)->Arg(1 << 20)->Threads(1)->Threads(4)->UseRealTime();
+
+//updates of keys nobody holds,each one inserts,stores the value and grants a lease.
+//leased keys are never evicted,so iterations are capped to bound memory
+void BM_CenterInsert(benchmark::State& state) {
+	//threads of a run share a fresh center,thread 0 makes it,timing starts
+	//once every thread has it
+	static std::mutex mutex;
+	static std::shared_ptr<CacheDataCenter<CacheDataType>> shared;
+	std::shared_ptr<CacheDataCenter<CacheDataType>> center;
+	if (state.thread_index() == 0) {
+		std::lock_guard<std::mutex> lock(mutex);
+		shared = std::make_shared<CacheDataCenter<CacheDataType>>();
+	}
+	while (!center) {
+		std::lock_guard<std::mutex> lock(mutex);
+		center = shared;
+	}
+	std::string value(state.range(0), 'v');
+	uint64_t key = (uint64_t)state.thread_index() << 40;
+	std::time_t expire{};
+	for (auto _ : state) {
+		OpResult ret = center->update_op(key++, value, 1, nullptr, &expire, 1);
+		benchmark::DoNotOptimize(ret);
+	}
+	state.SetItemsProcessed(state.iterations());
+	state.SetBytesProcessed(state.iterations() * state.range(0));
+	if (state.thread_index() == 0) {
+		std::lock_guard<std::mutex> lock(mutex);
+		shared.reset();
+	}
+}
+BENCHMARK(BM_CenterInsert)->ArgName("bytes")->Arg(16)->Arg(100)->Arg(1000)->Threads(1)->Threads(4)->UseRealTime()
+	->Iterations(1 << 17);
+
+//updates of leased keys,the first one of a key is deferred,later ones find
+//it pending and retry,so this mostly measures the lookup and the retry
+void BM_CenterUpdateLeased(benchmark::State& state) {
+	std::shared_ptr<CacheDataCenter<CacheDataType>> center = center_of(state.range(0));
+	std::mt19937_64 random(state.thread_index() + 1);
+	std::string value(100, 'v');
+	std::time_t expire{};
+	std::vector<PeerId> holders{};
+	for (auto _ : state) {
+		OpResult ret = center->update_op(random() % (uint64_t)state.range(0), value, 1,
+			[](OpResult, uint32_t, std::time_t) {}, &expire, 2, 1, &holders);
+		benchmark::DoNotOptimize(ret);
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_CenterUpdateLeased)->ArgName("keys")->Arg(1 << 10)->Arg(1 << 16)->Arg(1 << 20)->Threads(1)->Threads(4)->UseRealTime();
+
+
+//
+// a center with its log,if any,in a directory of its own that goes with it
+struct DurableCenter {
+	std::shared_ptr<CacheDataCenter<CacheDataType>> center;
+	std::shared_ptr<CacheWal> wal;
+	std::string dir;
+	~DurableCenter() {
+		center.reset();
+		wal.reset();
+		if (!dir.empty()) {
+			std::error_code ec;
+			std::filesystem::remove_all(dir, ec);
+		}
+	}
+};
+//durability: 0 no log,1 kWalSyncNone,2 kWalSyncGroup
+std::shared_ptr<DurableCenter> durable_center(int64_t durability) {
+	std::shared_ptr<DurableCenter> durable = std::make_shared<DurableCenter>();
+	durable->center = std::make_shared<CacheDataCenter<CacheDataType>>();
+	if (durability) {
+		durable->dir = (std::filesystem::temp_directory_path() / "micro_bench_wal").string();
+		std::filesystem::remove_all(durable->dir);
+		std::filesystem::create_directories(durable->dir);
+		CacheWalOptions options{};
+		options.sync = durability == 1 ? CacheWalSync::kWalSyncNone : CacheWalSync::kWalSyncGroup;
+		durable->wal = std::make_shared<CacheWal>(durable->dir + "/wal", options);
+		durable->center->add_commit_listener(durable->wal);
+		durable->wal->start();
+	}
+	return durable;
+}
+
+//updates committed at once,the updater holds the only lease of its key,
+//by durability of the commit. responses don't wait for the log,so this is
+//the cost on the event loop,not the time to disk
+void BM_CenterUpdateDurable(benchmark::State& state) {
+	static std::mutex mutex;
+	static std::shared_ptr<DurableCenter> shared;
+	std::shared_ptr<DurableCenter> durable;
+	if (state.thread_index() == 0) {
+		std::lock_guard<std::mutex> lock(mutex);
+		shared = durable_center(state.range(0));
+	}
+	while (!durable) {
+		std::lock_guard<std::mutex> lock(mutex);
+		durable = shared;
+	}
+	std::mt19937_64 random(state.thread_index() + 1);
+	std::string value(state.range(1), 'v');
+	uint64_t keys = (uint64_t)state.thread_index() << 40;
+	std::time_t expire{};
+	uint32_t op_id = 0;
+	for (auto _ : state) {
+		OpResult ret = durable->center->update_op(keys | random() % (1 << 16), value, ++op_id,
+			[](OpResult, uint32_t, std::time_t) {}, &expire, 1);
+		benchmark::DoNotOptimize(ret);
+	}
+	state.SetItemsProcessed(state.iterations());
+	state.SetBytesProcessed(state.iterations() * state.range(1));
+	if (state.thread_index() == 0) {
+		if (durable->wal)
+			state.counters["groups"] = (double)durable->wal->stats().groups;
+		std::lock_guard<std::mutex> lock(mutex);
+		shared.reset();
+	}
+}
+BENCHMARK(BM_CenterUpdateDurable)->ArgNames({ "durability", "bytes" })->ArgsProduct({ { 0, 1, 2 }, { 100, 1000 } })
+	->Threads(1)->Threads(4)->UseRealTime();
+//the key index alone,FlatHashMap against std::unordered_map,one 8 byte value
+//per key. keys spread over 64 bits as hashed cache ids do,lookups hit.
+//bytes_per_key is heap taken by the filled index,from malloc statistics
+uint64_t index_key(uint64_t i) {
+	return i * 0x9E3779B97F4A7C15ull;
+}
+//a present key,without a division per lookup
+uint64_t pick(std::mt19937_64& random, uint64_t keys) {
+	return ((random() >> 32) * keys) >> 32;
+}
+size_t heap_in_use() {
+	struct mallinfo2 info = mallinfo2();
+	return info.uordblks + info.hblkhd;
+}
+
+void BM_IndexLookupFlat(benchmark::State& state) {
+	uint64_t keys = state.range(0);
+	size_t heap = heap_in_use();
+	FlatHashMap<uint64_t> index{};
+	for (uint64_t i = 0; i < keys; ++i)
+		*index.try_emplace(index_key(i)).first = i;
+	state.counters["bytes_per_key"] = double(heap_in_use() - heap) / keys;
+	std::mt19937_64 random(1);
+	for (auto _ : state) {
+		uint64_t* value = index.find(index_key(pick(random, keys)));
+		benchmark::DoNotOptimize(value);
+	}
+}
+BENCHMARK(BM_IndexLookupFlat)->ArgName("keys")->Arg(1 << 20)->Arg(10 << 20)->Arg(100 << 20);
+
+void BM_IndexLookupStd(benchmark::State& state) {
+	uint64_t keys = state.range(0);
+	size_t heap = heap_in_use();
+	std::unordered_map<uint64_t, uint64_t> index{};
+	for (uint64_t i = 0; i < keys; ++i)
+		index.emplace(index_key(i), i);
+	state.counters["bytes_per_key"] = double(heap_in_use() - heap) / keys;
+	std::mt19937_64 random(1);
+	for (auto _ : state) {
+		auto it = index.find(index_key(pick(random, keys)));
+		benchmark::DoNotOptimize(it);
+	}
+}
+BENCHMARK(BM_IndexLookupStd)->ArgName("keys")->Arg(1 << 20)->Arg(10 << 20)->Arg(100 << 20);
+
+//
+// lease transitions on one key,no locks,no index
+void BM_StateReadGuaranteed(benchmark::State& state) {
+	TimerQueue queue{};
+	CacheLease<std::string> lease{};
+	std::time_t expire{};
+	CacheStateManager::read_op(lease, &queue, 1, 1, &expire);
+	for (auto _ : state) {
+		OpResult ret = CacheStateManager::read_op(lease, &queue, 1, 1, &expire);
+		benchmark::DoNotOptimize(ret);
+	}
+	CacheStateManager::stop_expire(lease, &queue);
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_StateReadGuaranteed);
+
+//Idle --update--> Guaranteed,on a new lease every time
+void BM_StateUpdateIdle(benchmark::State& state) {
+	TimerQueue queue{};
+	std::string value(100, 'v');
+	std::time_t expire{};
+	for (auto _ : state) {
+		CacheLease<std::string> lease{};
+		OpResult ret = CacheStateManager::update_op(lease, &queue, value, 1, nullptr, 1, 0, nullptr, &expire);
+		benchmark::DoNotOptimize(ret);
+		CacheStateManager::stop_expire(lease, &queue);
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_StateUpdateIdle);
+
+//Guaranteed --update--> UpdateProtected --last ack--> Guaranteed,
+//a read by another peer,then an update invalidating it and committing on its ack
+void BM_StateUpdateInvalidate(benchmark::State& state) {
+	TimerQueue queue{};
+	CacheLease<std::string> lease{};
+	std::string value(100, 'v');
+	std::time_t expire{};
+	std::vector<PeerId> holders{};
+	uint64_t invalidate_id = 0;
+	CacheStateManager::read_op(lease, &queue, 1, 1, &expire);
+	for (auto _ : state) {
+		//updater and holder swap roles,so there is always one to invalidate
+		PeerId peer = (PeerId)(invalidate_id % 2 + 1);
+		CacheStateManager::read_op(lease, &queue, 1, 3 - peer, &expire);
+		OpResult ret = CacheStateManager::update_op(lease, &queue, value, 1,
+			[](OpResult, uint32_t, std::time_t) {}, peer, ++invalidate_id, &holders, &expire);
+		CacheStateManager::invalidate_acked(lease, &queue, invalidate_id);
+		benchmark::DoNotOptimize(ret);
+	}
+	CacheStateManager::stop_expire(lease, &queue);
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_StateUpdateInvalidate);
+
+//an update while another one is pending has to retry
+void BM_StateUpdateRetry(benchmark::State& state) {
+	TimerQueue queue{};
+	CacheLease<std::string> lease{};
+	std::string value(100, 'v');
+	std::time_t expire{};
+	std::vector<PeerId> holders{};
+	CacheStateManager::read_op(lease, &queue, 1, 1, &expire);
+	CacheStateManager::update_op(lease, &queue, value, 1, [](OpResult, uint32_t, std::time_t) {}, 2, 1, &holders, &expire);
+	for (auto _ : state) {
+		OpResult ret = CacheStateManager::update_op(lease, &queue, value, 2, [](OpResult, uint32_t, std::time_t) {},
+			2, 2, &holders, &expire);
+		benchmark::DoNotOptimize(ret);
+	}
+	CacheStateManager::stop_expire(lease, &queue);
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_StateUpdateRetry);
+
+//
+// messages as they go on the wire,a read response and a many response of 32
+void fill_op_response(CacheOpResponse* response, uint32_t cache_id, const std::string& value) {
+	response->set_result(kOperationOk);
+	response->set_timestamp((uint64_t)get_time_stamp(kDefaultExpireMillisecond));
+	response->set_expire(kDefaultExpireMillisecond);
+	response->set_cache_id(cache_id);
+	response->set_cache_data(value);
+}
+std::string encoded_message(bool many, size_t value_size) {
+	CacheMessage message{};
+	CacheMessageProto::CacheMessageHeader* header = message.mutable_header();
+	header->set_magic(HEADER_MAGIC);
+	header->set_version(HEADER_VERSION);
+	header->set_op_id(0x123456789ABCull);
+	std::string value(value_size, 'v');
+	if (many) {
+		header->set_type(CacheMessageProto::kReadManyResponse);
+		for (uint32_t i = 0; i < 32; ++i)
+			fill_op_response(message.add_op_responses(), i, value);
+	}
+	else {
+		header->set_type(CacheMessageProto::kReadResponse);
+		fill_op_response(message.mutable_op_response(), 1, value);
+	}
+	return message.SerializeAsString();
+}
+
+void BM_MessageSerialize(benchmark::State& state) {
+	CacheMessage message{};
+	message.ParseFromString(encoded_message(state.range(0) != 0, state.range(1)));
+	std::string out{};
+	for (auto _ : state) {
+		out.clear();
+		message.SerializeToString(&out);
+		benchmark::DoNotOptimize(out.data());
+	}
+	state.SetBytesProcessed(state.iterations() * out.size());
+}
+BENCHMARK(BM_MessageSerialize)->ArgNames({ "many", "bytes" })->ArgsProduct({ { 0, 1 }, { 16, 100, 1000 } });
+
+//a message of its own on the heap per datagram
+void BM_MessageParseHeap(benchmark::State& state) {
+	std::string data = encoded_message(state.range(0) != 0, state.range(1));
+	for (auto _ : state) {
+		CacheMessage message{};
+		bool parsed = message.ParseFromArray(data.data(), (int)data.size());
+		benchmark::DoNotOptimize(parsed);
+	}
+	state.SetBytesProcessed(state.iterations() * data.size());
+}
+BENCHMARK(BM_MessageParseHeap)->ArgNames({ "many", "bytes" })->ArgsProduct({ { 0, 1 }, { 16, 100, 1000 } });
+
+//as the server does,in an arena from the pool given back after the request
+void BM_MessageParseArena(benchmark::State& state) {
+	std::string data = encoded_message(state.range(0) != 0, state.range(1));
+	std::shared_ptr<ArenaPool> pool = std::make_shared<ArenaPool>();
+	for (auto _ : state) {
+		ArenaPtr arena = pool->acquire();
+		CacheMessage* message = google::protobuf::Arena::CreateMessage<CacheMessage>(arena.get());
+		bool parsed = message->ParseFromArray(data.data(), (int)data.size());
+		benchmark::DoNotOptimize(parsed);
+	}
+	state.SetBytesProcessed(state.iterations() * data.size());
+}
+BENCHMARK(BM_MessageParseArena)->ArgNames({ "many", "bytes" })->ArgsProduct({ { 0, 1 }, { 16, 100, 1000 } });
+}
+
+BENCHMARK_MAIN();
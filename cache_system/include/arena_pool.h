@@ -0,0 +1,95 @@
+/*
+ * arena_pool.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: rynzen <chuanrui123@126.com>
+ *
+ *  This file is part of a cache system of lease mechanism implemenation.
+ *
+ *  arena_pool.h is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  arena_pool.h is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with consistent_hashing.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+#include <memory>
+#include <vector>
+#include <mutex>
+#include <google/protobuf/arena.h>
+#include "common.h"
+
+CACHE_NAMESPACE_BEGIN
+using ArenaPtr = std::shared_ptr<google::protobuf::Arena>;
+//
+// recycled protobuf arenas,one per request(or batch of messages living together).
+// whoever keeps a message beyond the request(a deferred update,a response waiting
+// for its ack) keeps the ArenaPtr too,the arena is Reset() and returned to the pool
+// once the last holder lets it go,so memory stays flat under sustained load.
+// every arena owns a fixed first block,Reset() keeps it,a small request never mallocs.
+class ArenaPool :public std::enable_shared_from_this<ArenaPool> {
+	enum ArenaPoolDefault {
+		kDefaultBlockSize = 1024,
+		kDefaultMaxIdle = 64,
+	};
+	class PooledArena {
+	public:
+		explicit PooledArena(size_t block_size) :block_(new char[block_size]),
+			arena_(block_.get(), block_size) {}
+		google::protobuf::Arena* arena() { return &arena_; }
+	private:
+		//declared before arena_,outlives it
+		std::unique_ptr<char[]>	block_;
+		google::protobuf::Arena	arena_;
+	};
+public:
+	//block_size: first block of every arena
+	//max_idle: arenas kept for reuse,extra ones are freed
+	explicit ArenaPool(size_t block_size = kDefaultBlockSize, size_t max_idle = kDefaultMaxIdle) :
+		block_size_(block_size), max_idle_(max_idle), idle_(), mutex_() {}
+	ArenaPtr acquire() {
+		PooledArena* pooled = nullptr;
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			if (!idle_.empty()) {
+				pooled = idle_.back().release();
+				idle_.pop_back();
+			}
+		}
+		if (!pooled)
+			pooled = new PooledArena(block_size_);
+		std::weak_ptr<ArenaPool> pool = weak_from_this();
+		return ArenaPtr(pooled->arena(), [pooled, pool](google::protobuf::Arena*) {
+			std::shared_ptr<ArenaPool> owner = pool.lock();
+			if (owner)
+				owner->recycle(pooled);
+			else
+				delete pooled;
+		});
+	}
+	size_t idle() {
+		std::lock_guard<std::mutex> lock(mutex_);
+		return idle_.size();
+	}
+private:
+	void recycle(PooledArena* pooled) {
+		pooled->arena()->Reset();
+		std::lock_guard<std::mutex> lock(mutex_);
+		if (idle_.size() < max_idle_)
+			idle_.emplace_back(pooled);
+		else
+			delete pooled;
+	}
+	size_t									  block_size_;
+	size_t									  max_idle_;
+	std::vector<std::unique_ptr<PooledArena>> idle_;
+	std::mutex								  mutex_;
+};
+CACHE_NAMESPACE_END
\ No newline at end of file
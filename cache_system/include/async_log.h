@@ -0,0 +1,234 @@
+/*
+ * async_log.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: rynzen <chuanrui123@126.com>
+ *
+ *  This file is part of a cache system of lease mechanism implemenation.
+ *
+ *  async_log.h is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  async_log.h is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with consistent_hashing.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+#include <atomic>
+#include <memory>
+#include <tuple>
+#include <ctime>
+#include <cstdio>
+#include <cstring>
+#include <type_traits>
+#include <stdint.h>
+#include "common.h"
+
+//records below this level are compiled out
+#ifndef CACHE_LOG_LEVEL
+#define CACHE_LOG_LEVEL 0
+#endif
+
+CACHE_NAMESPACE_BEGIN
+enum LogLevel {
+	kLogDebug = 0,
+	kLogInfo,
+	kLogWarn,
+	kLogError,
+	kLogOff,
+};
+
+struct LogRecord;
+//return: length snprintf() would write
+using LogFormatter = int (*)(const LogRecord& record, char* out, size_t size);
+//one log call,arguments kept binary until the writer formats them
+struct LogRecord {
+	enum LogRecordLayout {
+		kRecordSize = 256,
+		kArgsSize = kRecordSize - 4 * sizeof(void*) - sizeof(std::time_t) - 2 * sizeof(uint32_t),
+	};
+	LogFormatter format;
+	//literals,live as long as the program
+	const char*	 fmt;
+	const char*	 file;
+	const char*	 func;
+	std::time_t	 timestamp;
+	uint32_t	 line;
+	uint32_t	 level;
+	char		 args[kArgsSize];
+};
+static_assert(sizeof(LogRecord) == LogRecord::kRecordSize, "log record should fill its slot");
+
+//
+// ring of records one thread writes and the writer thread reads,no lock,
+// a full ring drops the record and counts it
+class LogRing {
+public:
+	enum LogRingLayout {
+		kSlotCount = 4096,
+		kSlotMask = kSlotCount - 1,
+	};
+	LogRing() :head_(0), cached_head_(0), tail_(0), dropped_(0), retired_(false), slots_(new LogRecord[kSlotCount]) {}
+	//producer side,commit() publishes the slot
+	LogRecord* reserve() {
+		uint32_t tail = tail_.load(std::memory_order_relaxed);
+		if (unlikely(tail - cached_head_ == kSlotCount)) {
+			cached_head_ = head_.load(std::memory_order_acquire);
+			if (tail - cached_head_ == kSlotCount) {
+				dropped_.fetch_add(1, std::memory_order_relaxed);
+				return nullptr;
+			}
+		}
+		return &slots_[tail & kSlotMask];
+	}
+	void commit() {
+		tail_.store(tail_.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+	}
+	//consumer side
+	const LogRecord* front() const {
+		uint32_t head = head_.load(std::memory_order_relaxed);
+		if (head == tail_.load(std::memory_order_acquire))
+			return nullptr;
+		return &slots_[head & kSlotMask];
+	}
+	void pop() {
+		head_.store(head_.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+	}
+	uint64_t take_dropped() { return dropped_.exchange(0, std::memory_order_relaxed); }
+	//thread of the ring exited,it goes once drained
+	void retire() { retired_.store(true, std::memory_order_release); }
+	bool retired() const { return retired_.load(std::memory_order_acquire); }
+private:
+	alignas(64) std::atomic<uint32_t>	head_;
+	alignas(64) uint32_t				cached_head_;
+	std::atomic<uint32_t>				tail_;
+	std::atomic<uint64_t>				dropped_;
+	std::atomic<bool>					retired_;
+	std::unique_ptr<LogRecord[]>		slots_;
+};
+
+//how an argument is kept in a record,strings are copied,the rest bit for bit
+template <typename T>
+struct LogArg {
+	static_assert(std::is_trivially_copyable_v<T>, "log argument should be trivially copyable,pass strings as const char*");
+	using Type = T;
+	enum :size_t { kFixedSize = sizeof(T) };
+	static void put(char*& out, size_t& /*spare*/, T value) {
+		std::memcpy(out, &value, sizeof(T));
+		out += sizeof(T);
+	}
+	static T get(const char*& in) {
+		T value;
+		std::memcpy(&value, in, sizeof(T));
+		in += sizeof(T);
+		return value;
+	}
+};
+template <>
+struct LogArg<const char*> {
+	using Type = const char*;
+	//terminating NUL
+	enum :size_t { kFixedSize = 1 };
+	//spare:bytes left for string contents,a long string is cut short
+	static void put(char*& out, size_t& spare, const char* value) {
+		if (unlikely(!value))
+			value = "(null)";
+		size_t length = strnlen(value, spare);
+		std::memcpy(out, value, length);
+		out[length] = '\0';
+		out += length + 1;
+		spare -= length;
+	}
+	static const char* get(const char*& in) {
+		const char* value = in;
+		in += std::strlen(in) + 1;
+		return value;
+	}
+};
+template <>
+struct LogArg<char*> :LogArg<const char*> {};
+
+//
+// logging off the hot path. a log call copies its arguments into a ring of the
+// calling thread and returns,a background thread formats the records and
+// writes them out in batches,the time prefix is formatted once a second.
+// records below level() cost a load and a branch,below CACHE_LOG_LEVEL nothing
+class AsyncLogger {
+public:
+	static bool enabled(LogLevel level) {
+		return level >= level_.load(std::memory_order_relaxed);
+	}
+	static void set_level(LogLevel level) { level_.store(level, std::memory_order_relaxed); }
+	static LogLevel level() { return (LogLevel)level_.load(std::memory_order_relaxed); }
+	//block until records logged so far are written
+	static void flush();
+	template <typename... Args>
+	static void log(LogLevel level, const char* file, const char* func, uint32_t line, const char* fmt, Args... args) {
+		static_assert((size_t(0) + ... + size_t(LogArg<std::decay_t<Args>>::kFixedSize)) <= LogRecord::kArgsSize, "too many log arguments");
+		LogRing* ring = stopped_.load(std::memory_order_relaxed) ? nullptr : thread_ring();
+		LogRecord local;
+		LogRecord* record = ring ? ring->reserve() : &local;
+		if (unlikely(!record))
+			return;
+		record->format = &format<std::decay_t<Args>...>;
+		record->fmt = fmt;
+		record->file = file;
+		record->func = func;
+		record->timestamp = get_time_stamp();
+		record->line = line;
+		record->level = level;
+		if constexpr (sizeof...(Args) != 0) {
+			char* out = record->args;
+			size_t spare = LogRecord::kArgsSize - (size_t(0) + ... + size_t(LogArg<std::decay_t<Args>>::kFixedSize));
+			(LogArg<std::decay_t<Args>>::put(out, spare, args), ...);
+		}
+		if (likely(ring))
+			ring->commit();
+		else
+			write_now(local);
+	}
+private:
+	template <typename... Args>
+	static int format(const LogRecord& record, char* out, size_t size) {
+		[[maybe_unused]] const char* in = record.args;
+		//braced initializers are evaluated in order
+		std::tuple<typename LogArg<Args>::Type...> values{ LogArg<Args>::get(in)... };
+		return std::apply([&](auto... value) {
+#if !defined(OS_WINDOWS)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-security"
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+#endif
+			return snprintf(out, size, record.fmt, value...);
+#if !defined(OS_WINDOWS)
+#pragma GCC diagnostic pop
+#endif
+		}, values);
+	}
+	//ring of calling thread,registered with the writer on first use
+	static LogRing* thread_ring();
+	//logger stopped at exit,format and write in the calling thread
+	static void write_now(const LogRecord& record);
+	static std::atomic<int>	 level_;
+	static std::atomic<bool> stopped_;
+	friend class LogWriter;
+};
+CACHE_NAMESPACE_END
+
+#if defined(OS_WINDOWS)
+#define LOG_AT(level, fmt, ...)  do{ \
+	if ((level) >= CACHE_LOG_LEVEL && csn::AsyncLogger::enabled(level)) \
+		csn::AsyncLogger::log(level, __FILE__, __FUNCTION__, __LINE__, fmt"\r\n", __VA_ARGS__); \
+}while(0)
+#else
+#define LOG_AT(level, fmt, args ...)  do{ \
+	if ((level) >= CACHE_LOG_LEVEL && csn::AsyncLogger::enabled(level)) \
+		csn::AsyncLogger::log(level, __FILE__, __FUNCTION__, __LINE__, fmt"\r\n", ##args); \
+}while(0)
+#endif
@@ -26,94 +26,446 @@
 CACHE_NAMESPACE_BEGIN
 using UpdateCallHandler=std::function<void(OpResult status, uint32_t op_id, std::time_t expire)>;
 const uint32_t kDefaultExpireMillisecond = 10000u;
+//a read in the last part of a lease renews it,a lease never reaches further
+//than kDefaultExpireMillisecond ahead,so waiting that long outlives any of them
+const uint32_t kLeaseRenewMillisecond = kDefaultExpireMillisecond / 4;
 CACHE_NAMESPACE_END
 
 #include <string>
-#include <unordered_map>
+#include <unordered_set>
+#include <deque>
+#include <vector>
+#include <algorithm>
 #include <memory>
 #include <type_traits>
 #include <mutex>
+#include <atomic>
+#include "timer_queue.h"
 #include "cache_state_manager.h"
+#include "flat_hash_map.h"
+#include "value_slab.h"
 
 CACHE_NAMESPACE_BEGIN
+//heap bytes a value holds beyond its own object
+template <typename T>
+size_t value_heap_size(const T& value) { return 0; }
+template <typename C, typename Tr, typename A>
+size_t value_heap_size(const std::basic_string<C, Tr, A>& value) {
+	//short strings live inside the object
+	const char* data = reinterpret_cast<const char*>(value.data());
+	const char* self = reinterpret_cast<const char*>(&value);
+	if (data >= self && data < self + sizeof(value))
+		return 0;
+	return (value.capacity() + 1) * sizeof(C);
+}
+inline size_t value_heap_size(const SlabString& value) { return value.heap_size(); }
+
 template <typename T>
 struct CacheElement {
 	using ValueType=T;
 	static_assert(!std::is_reference_v<ValueType>&& !std::is_const_v<ValueType>, "value type should not be reference or const");
+	using Traits=CacheValueTraits<ValueType>;
 	//simple value 
-	CacheElement() :value_(), temp_value_(), call_(), state_(CacheStateManager()), mutex_() {}
-	void call_handle(OpResult status, uint32_t op_id, std::time_t expire) {
-		if (status == OpResult::kOperationOk)
-			value_ = std::move(temp_value_);
-		call_(status, op_id, expire);
-	}
-	OpResult read_op(uint32_t op_id/*IN*/, std::time_t * expire/*OUT*/, ValueType * value) {
-		*value = value_;
-		std::lock_guard<std::mutex> lock(mutex_);
-		return state_.read_op(op_id, expire);
+	//not threadsafe,element is guarded by the lock of its CacheDataCenter shard,
+	//queue is the timer queue of that shard,slab keeps value bytes of that shard
+	CacheElement() :lease_(), charge_(0), freq_(0) {}
+	//version:in the version reader holds,0 for none,value isn't loaded when it's current.
+	//		  out the version of value
+	OpResult read_op(TimerQueue* queue, uint32_t op_id/*IN*/, PeerId peer/*IN*/, std::time_t * expire/*OUT*/, ValueType * value,
+		uint64_t* version = nullptr) {
+		if (!version || *version != lease_.version)
+			Traits::load(lease_.value, value);
+		if (version)
+			*version = lease_.version;
+		return CacheStateManager::read_op(lease_, queue, op_id, peer, expire);
 	}
+	//value is copied into slab once,pending and committed value are the same block
+	//version:the one being replaced,holders drop leases up to it
 	template< typename U>
-	OpResult update_op(U && value, uint32_t op_id/*IN*/, UpdateCallHandler f, std::time_t * expire) 
+	OpResult update_op(TimerQueue* queue, ValueSlab* slab, U && value, uint32_t op_id/*IN*/, UpdateCallHandler f, PeerId peer/*IN*/,
+		uint64_t invalidate_id/*IN*/, std::vector<PeerId>* holders/*OUT*/, std::time_t * expire, uint64_t* version = nullptr/*OUT*/) 
 	{
-		OpResult r;
-		{
-			std::lock_guard<std::mutex> lock(mutex_);
-			r = state_.update_op(&CacheElement::call_handle, this, op_id, expire);
-		}
-		if (OpResult::kOperationOk == r)
-			value_ = std::move(value);
-		else if (OpResult::kOperationDefer == r) {
-			temp_value_ = std::move(value);
-			op_id_ = op_id;
-			call_ = std::move(f);
-		}
-		return r;
+		if (version)
+			*version = lease_.version;
+		return CacheStateManager::update_op(lease_, queue, Traits::store(slab, std::forward<U>(value)), op_id, std::move(f),
+			peer, invalidate_id, holders, expire);
+	}
+	void invalidate_acked(TimerQueue* queue, uint64_t invalidate_id) {
+		CacheStateManager::invalidate_acked(lease_, queue, invalidate_id);
 	}
+	//committed value of a previous run,replaces what element holds,no lease granted on it
+	template< typename U>
+	void restore(ValueSlab* slab, uint64_t version, U&& value) {
+		lease_.value = Traits::store(slab, std::forward<U>(value));
+		lease_.version = version;
+	}
+	//element just created,its first commit goes above version
+	void start_version(uint64_t version) { lease_.version = version; }
+	const typename Traits::StoreType& value() const { return lease_.value; }
+	uint64_t version() const { return lease_.version; }
+	//an update now would be kept pending until the lease ends
+	bool leased() const { return lease_.state == CacheState::kCacheGuaranteed; }
+	//no lease granted and no update pending,nobody relies on the value
+	bool evictable() const {
+		return lease_.state == CacheState::kCacheIdle && !lease_.pending && !lease_.timer_id;
+	}
+	//bytes held by element,pending value included
+	size_t measure() const {
+		size_t size = sizeof(*this) + value_heap_size(lease_.value) + lease_.holders.capacity() * sizeof(*lease_.holders.data());
+		if (lease_.pending)
+			size += sizeof(*lease_.pending) + value_heap_size(lease_.pending->value);
+		return size;
+	}
+	//charge:bytes accounted to the shard when last measured
+	size_t charge() const { return charge_; }
+	void set_charge(size_t charge) { charge_ = (uint32_t)charge; }
+	//access frequency for eviction,saturates at kMaxFreq
+	void touch() {
+		if (freq_ < kMaxFreq)
+			++freq_;
+	}
+	void cool() {
+		if (freq_)
+			--freq_;
+	}
+	uint8_t freq() const { return freq_; }
 private:
-	//for defer call back
-	uint32_t							 op_id_;
-	//acturally storage in cache
-	ValueType							 value_;
-	ValueType							 temp_value_;
-	UpdateCallHandler                    call_;
-	CacheStateManager					 state_;
-	std::mutex							 mutex_;
+	enum ElementFreq {
+		kMaxFreq = 3,
+	};
+	//value and lease state,timers point to it,element must not move
+	CacheLease<typename Traits::StoreType> lease_;
+	uint32_t							 charge_;
+	uint8_t								 freq_;
 };
 
+//0 for no limit,split evenly over the shards
+struct CacheBudget {
+	size_t max_entries;
+	size_t max_bytes;
+};
+struct CacheCenterStats {
+	//reads finding the key or not
+	uint64_t hits;
+	uint64_t misses;
+	uint64_t inserts;
+	uint64_t evictions;
+	//inserts of a key evicted not long ago,admitted straight to main queue
+	uint64_t ghost_hits;
+	//eviction candidates passed over because of a lease or pending update
+	uint64_t leased_skips;
+	size_t	 entries;
+	size_t	 bytes;
+	//memory the shards' slabs hold for values,free blocks included
+	size_t	 slab_bytes;
+};
+
+//told about every value committed,in commit order for each key.
+//on_commit() runs under the lock of the key's shard,it should just copy what it needs
+template <typename T>
+class CacheCommitListener {
+public:
+	using StoreType=typename CacheValueTraits<T>::StoreType;
+	virtual ~CacheCommitListener() = default;
+	virtual void on_commit(uint64_t cache_id, uint64_t version, const StoreType& value) = 0;
+};
+
+//
+// elements are spread over independently locked shards by a hash of cache_id,
+// each shard owns the timers of its elements,so operations on keys of different
+// shards never contend. tick() expires the shards' timers under their locks.
+// string values are copied once into the ValueSlab of their shard,short ones
+// stay inside the element.
+// with a CacheBudget set,an insert over budget evicts by S3-FIFO: new keys enter
+// a small fifo,keys read again move on to the main fifo,keys evicted from the
+// small one are remembered in a ghost fifo and readmitted to main. a key under
+// lease or with a pending update is never evicted,it goes round again.
 template <typename T>
-class CacheDataCenter : public std::enable_shared_from_this<CacheDataCenter<T>> {
+class CacheDataCenter : public std::enable_shared_from_this<CacheDataCenter<T>>, public TimerSource {
 public:
 	using ValueType=T;
 	using ElementType=CacheElement<ValueType>;
-	using iterator=typename std::unordered_map<uint64_t, std::unique_ptr<ElementType>>::iterator;
 	static_assert(!std::is_reference_v<ValueType> && !std::is_const_v<ValueType>, "value type should not be reference or const");
+	enum CacheShardDefault {
+		kDefaultShardCount = 16,
+		//small fifo share of the entries,in percent
+		kSmallQueuePercent = 10,
+		//candidates looked at per insert,leased keys can't stall an insert
+		kMaxEvictScan = 16,
+		//key of the node,index slot and tag beyond the element,at 6/7 load
+		kEntryOverhead = sizeof(uint64_t) + (sizeof(void*) + 1) * 7 / 6,
+	};
 
-	CacheDataCenter() = default;
+	//shard_count:rounded up to power of 2
+	explicit CacheDataCenter(size_t shard_count = kDefaultShardCount) :shard_bits_(0), shards_(), write_fence_(0), listeners_() {
+		while ((size_t(1) << shard_bits_) < shard_count)
+			++shard_bits_;
+		shards_.reserve(size_t(1) << shard_bits_);
+		for (size_t i = 0; i < (size_t(1) << shard_bits_); ++i)
+			shards_.emplace_back(std::make_unique<CacheShard>());
+	}
 	
-	OpResult read_op(uint64_t cache_id, uint32_t op_id/*IN*/, std::time_t* expire/*OUT*/, ValueType* value) {
-		iterator it = map_.find(cache_id);
-		if (it == map_.end()) {
+	//peer:reader,remembered as lease holder
+	//version:in the version reader holds,0 for none,value is left alone when that
+	//		  is still the current one. out the version of the value read
+	OpResult read_op(uint64_t cache_id, uint32_t op_id/*IN*/, std::time_t* expire/*OUT*/, ValueType* value,
+		PeerId peer = kNoPeer, uint64_t* version = nullptr) {
+		CacheShard& shard = shard_of(cache_id);
+		std::lock_guard<std::mutex> lock(shard.mutex);
+		ElementType* element = shard.map.find(cache_id);
+		if (element == nullptr) {
+			++shard.stats.misses;
 			return OpResult::kOperationErrorNoData;
 		}
-		return it->second->read_op(op_id, expire, value);
+		++shard.stats.hits;
+		element->touch();
+		return element->read_op(&shard.timers, op_id, peer, expire, value, version);
+	}
+	//peer:updater,remembered as lease holder
+	//invalidate_id,holders:when deferred,holders to push invalidate_id to,
+	//		each ack reported by invalidate_acked() and last one commits the update
+	//version:when deferred,the version being replaced,pushed along with invalidate_id
+	template< typename U>
+	OpResult update_op(uint64_t cache_id/*IN*/, U&& value/*IN*/, uint32_t op_id/*IN*/, UpdateCallHandler f/*IN*/, std::time_t* expire/*OUT*/,
+		PeerId peer = kNoPeer, uint64_t invalidate_id = 0, std::vector<PeerId>* holders = nullptr, uint64_t* version = nullptr) {
+		if (unlikely(write_fenced(expire)))
+			return OpResult::kOperationRetry;
+		CacheShard& shard = shard_of(cache_id);
+		std::lock_guard<std::mutex> lock(shard.mutex);
+		//no value yet,element is created idle
+		auto emplaced = shard.map.try_emplace(cache_id);
+		ElementType* element = emplaced.first;
+		if (emplaced.second) {
+			admit(shard, cache_id);
+			element->start_version(shard.version_floor);
+		}
+		else
+			element->touch();
+		//value commits later from a timer or the last ack,listeners hear of it then
+		if (unlikely(!listeners_.empty()) && element->leased() && f)
+			f = [this, &shard, cache_id, f = std::move(f)](OpResult status, uint32_t op_id, std::time_t expire) {
+				notify_commit(cache_id, *shard.map.find(cache_id));
+				f(status, op_id, expire);
+			};
+		OpResult ret = element->update_op(&shard.timers, &shard.values, std::forward<U>(value), op_id, std::move(f),
+			peer, invalidate_id, holders, expire, version);
+		if (ret == OpResult::kOperationOk)
+			notify_commit(cache_id, *element);
+		recharge(shard, *element);
+		//key just updated holds a lease,it is not a candidate
+		evict(shard);
+		return ret;
+	}
+	//a holder dropped its copy of cache_id
+	void invalidate_acked(uint64_t cache_id, uint64_t invalidate_id) {
+		CacheShard& shard = shard_of(cache_id);
+		std::lock_guard<std::mutex> lock(shard.mutex);
+		ElementType* element = shard.map.find(cache_id);
+		if (element != nullptr)
+			element->invalidate_acked(&shard.timers, invalidate_id);
 	}
-	//
+	//put back a value committed by a previous run,idle and without lease,
+	//before the center serves anybody. a later restore of the key replaces it,
+	//unless keep_newer and the value held is of version or later
+	//return: true when cache_id is new
 	template< typename U>
-	OpResult update_op(uint64_t cache_id/*IN*/, U&& value/*IN*/, uint32_t op_id/*IN*/, UpdateCallHandler f/*IN*/, std::time_t* expire/*OUT*/) {
-		iterator it = map_.find(cache_id);
-		if (it == map_.end()) {
-			//CacheDataCenter synchronized when insert or delete
-			std::lock_guard<std::mutex> lock(mutex_);
-			//no value
-			std::pair<iterator, bool> pair = map_.emplace(cache_id, std::make_unique<ElementType>());
-			if (unlikely(pair.second == false))
-				throw Exception(Exception::kErrorSysRoutine, "unordered_map insert data error !!!");
-			it = pair.first;
+	bool restore(uint64_t cache_id, uint64_t version, U&& value, bool keep_newer = false) {
+		CacheShard& shard = shard_of(cache_id);
+		std::lock_guard<std::mutex> lock(shard.mutex);
+		auto emplaced = shard.map.try_emplace(cache_id);
+		if (emplaced.second)
+			admit(shard, cache_id);
+		else if (keep_newer && emplaced.first->version() >= version)
+			return false;
+		shard.version_floor = std::max(shard.version_floor, version);
+		emplaced.first->restore(&shard.values, version, std::forward<U>(value));
+		recharge(shard, *emplaced.first);
+		evict(shard);
+		return emplaced.second;
+	}
+	//before the center serves anybody,listeners are read without a lock
+	void add_commit_listener(std::shared_ptr<CacheCommitListener<ValueType>> listener) {
+		listeners_.push_back(std::move(listener));
+	}
+	//f(uint64_t cache_id,uint64_t version,const StoreType& value) for every key of
+	//a shard,under its lock,so f should just copy what it needs
+	template <typename F>
+	void visit_shard(size_t index, F&& f) {
+		CacheShard& shard = *shards_[index];
+		std::lock_guard<std::mutex> lock(shard.mutex);
+		shard.map.for_each([&f](uint64_t cache_id, ElementType& element) {
+			f(cache_id, element.version(), element.value()); });
+	}
+	//updates are answered kOperationRetry until timestamp,a restarted server
+	//can't tell which leases of its previous run are still held
+	void fence_writes(std::time_t timestamp) {
+		write_fence_.store(timestamp, std::memory_order_relaxed);
+	}
+	//expire lease timers of all shards,deferred update callbacks run from here
+	void tick() override {
+		for (size_t i = 0; i < shards_.size(); ++i)
+			tick_shard(i);
+	}
+	uint32_t next_timeout_ms() override {
+		uint32_t timeout = kTimerIdle;
+		for (size_t i = 0; i < shards_.size(); ++i)
+			timeout = std::min(timeout, shard_next_timeout_ms(i));
+		return timeout;
+	}
+	//an event loop owning part of the shards ticks just them
+	void tick_shard(size_t index) {
+		CacheShard& shard = *shards_[index];
+		std::lock_guard<std::mutex> lock(shard.mutex);
+		shard.timers.tick();
+	}
+	uint32_t shard_next_timeout_ms(size_t index) {
+		return shards_[index]->timers.next_timeout_ms();
+	}
+	size_t shard_index(uint64_t cache_id) const {
+		//fibonacci hashing,sequential ids spread over all shards
+		if (unlikely(!shard_bits_))
+			return 0;
+		return (size_t)((cache_id * 0x9E3779B97F4A7C15ull) >> (64 - shard_bits_));
+	}
+	size_t shard_count() const { return shards_.size(); }
+	//takes effect with the next insert of each shard
+	void set_budget(const CacheBudget& budget) {
+		size_t count = shards_.size();
+		for (auto& shard : shards_) {
+			std::lock_guard<std::mutex> lock(shard->mutex);
+			shard->budget.max_entries = (budget.max_entries + count - 1) / count;
+			shard->budget.max_bytes = (budget.max_bytes + count - 1) / count;
+		}
+	}
+	CacheCenterStats stats() {
+		CacheCenterStats total{};
+		for (auto& shard : shards_) {
+			std::lock_guard<std::mutex> lock(shard->mutex);
+			total.hits += shard->stats.hits;
+			total.misses += shard->stats.misses;
+			total.inserts += shard->stats.inserts;
+			total.evictions += shard->stats.evictions;
+			total.ghost_hits += shard->stats.ghost_hits;
+			total.leased_skips += shard->stats.leased_skips;
+			total.entries += shard->map.size();
+			total.bytes += shard->bytes;
+			total.slab_bytes += shard->values.bytes();
 		}
-		return it->second->update_op(std::forward<U>(value), op_id, std::move(f), expire);
+		return total;
+	}
+	size_t size() {
+		size_t count = 0;
+		for (auto& shard : shards_) {
+			std::lock_guard<std::mutex> lock(shard->mutex);
+			count += shard->map.size();
+		}
+		return count;
 	}
 private:
-	std::unordered_map<uint64_t, std::unique_ptr<ElementType>> map_;
-	std::mutex	 mutex_;
+	//own cache line,neighbour shards' locks don't false share
+	struct alignas(64) CacheShard {
+		std::mutex	 mutex;
+		//lease timers point into map,both go away together with the shard
+		TimerQueue	 timers;
+		//value bytes of the elements,declared before map,outlives them
+		ValueSlab	 values;
+		//elements sit in a slab,they never move
+		FlatHashMap<ElementType> map;
+		//S3-FIFO queues,every key of map is in exactly one of small and main
+		std::deque<uint64_t>			small;
+		std::deque<uint64_t>			main;
+		std::deque<uint64_t>			ghost;
+		std::unordered_set<uint64_t>	ghost_keys;
+		size_t							bytes = 0;
+		//no key that left the shard or was restored had a version above it
+		uint64_t						version_floor = 0;
+		CacheBudget						budget{};
+		CacheCenterStats				stats{};
+	};
+	void notify_commit(uint64_t cache_id, const ElementType& element) {
+		for (auto& listener : listeners_)
+			listener->on_commit(cache_id, element.version(), element.value());
+	}
+	//expire:OUT,end of the fence
+	bool write_fenced(std::time_t* expire) {
+		std::time_t fence = write_fence_.load(std::memory_order_relaxed);
+		if (likely(!fence))
+			return false;
+		if (get_time_stamp() >= fence) {
+			write_fence_.compare_exchange_strong(fence, 0, std::memory_order_relaxed);
+			return false;
+		}
+		*expire = fence;
+		return true;
+	}
+	CacheShard& shard_of(uint64_t cache_id) {
+		return *shards_[shard_index(cache_id)];
+	}
+	void admit(CacheShard& shard, uint64_t cache_id) {
+		++shard.stats.inserts;
+		if (shard.ghost_keys.erase(cache_id)) {
+			++shard.stats.ghost_hits;
+			shard.main.push_back(cache_id);
+		}
+		else
+			shard.small.push_back(cache_id);
+	}
+	void recharge(CacheShard& shard, ElementType& element) {
+		size_t charge = element.measure() + kEntryOverhead;
+		shard.bytes = shard.bytes - element.charge() + charge;
+		element.set_charge(charge);
+	}
+	bool over_budget(const CacheShard& shard) const {
+		return (shard.budget.max_entries && shard.map.size() > shard.budget.max_entries)
+			|| (shard.budget.max_bytes && shard.bytes > shard.budget.max_bytes);
+	}
+	//pop candidates until back under budget or kMaxEvictScan looked at,
+	//the rest is left to next insert
+	void evict(CacheShard& shard) {
+		for (uint32_t scan = 0; scan < kMaxEvictScan && over_budget(shard); ++scan) {
+			size_t total = shard.small.size() + shard.main.size();
+			bool from_small = !shard.small.empty() &&
+				(shard.main.empty() || shard.small.size() * 100 > total * kSmallQueuePercent);
+			std::deque<uint64_t>& queue = from_small ? shard.small : shard.main;
+			if (unlikely(queue.empty()))
+				return;
+			uint64_t cache_id = queue.front();
+			queue.pop_front();
+			ElementType& element = *shard.map.find(cache_id);
+			recharge(shard, element);
+			if (!element.evictable()) {
+				++shard.stats.leased_skips;
+				queue.push_back(cache_id);
+				continue;
+			}
+			if (element.freq()) {
+				//read again since admitted,small promotes it,main gives another round
+				element.cool();
+				shard.main.push_back(cache_id);
+				continue;
+			}
+			if (from_small)
+				remember_ghost(shard, cache_id);
+			shard.bytes -= element.charge();
+			shard.version_floor = std::max(shard.version_floor, element.version());
+			shard.map.erase(cache_id);
+			++shard.stats.evictions;
+		}
+	}
+	//ghost remembers as many keys as the shard holds
+	void remember_ghost(CacheShard& shard, uint64_t cache_id) {
+		if (!shard.ghost_keys.insert(cache_id).second)
+			return;
+		shard.ghost.push_back(cache_id);
+		while (shard.ghost.size() > std::max<size_t>(shard.map.size(), 1)) {
+			shard.ghost_keys.erase(shard.ghost.front());
+			shard.ghost.pop_front();
+		}
+	}
+	uint32_t								 shard_bits_;
+	std::vector<std::unique_ptr<CacheShard>> shards_;
+	//0 when updates are accepted
+	std::atomic<std::time_t>				 write_fence_;
+	std::vector<std::shared_ptr<CacheCommitListener<ValueType>>> listeners_;
 };
-CACHE_NAMESPACE_END
+CACHE_NAMESPACE_END
\ No newline at end of file
@@ -0,0 +1,271 @@
+/*
+ * cache_metrics.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: rynzen <chuanrui123@126.com>
+ *
+ *  This file is part of a cache system of lease mechanism implemenation.
+ *
+ *  cache_metrics.h is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  cache_metrics.h is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with consistent_hashing.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <algorithm>
+#include <functional>
+#include <condition_variable>
+#include <stdint.h>
+#include "common.h"
+
+//0 compiles counting and timing out
+#ifndef CACHE_METRICS
+#define CACHE_METRICS 1
+#endif
+
+CACHE_NAMESPACE_BEGIN
+enum OpResultCount {
+	kOpResultCount = kOperationTimeout + 1,
+};
+enum MetricCounter {
+	//results of single and many operations,one per key,indexed by OpResult
+	kMetricReadResults = 0,
+	kMetricUpdateResults = kMetricReadResults + kOpResultCount,
+	//reads renewing the lease on a value the client holds,answered without it
+	kMetricReadsNotModified = kMetricUpdateResults + kOpResultCount,
+	//responses sent again as their ack didn't come in time
+	kMetricAckRetransmits,
+	//responses sent again on a request resent by the client
+	kMetricAckResends,
+	//acks of no response waiting,late or duplicated
+	kMetricAckUnmatched,
+	kMetricTimersFired,
+	kMetricCounterCount,
+};
+enum MetricHistogram {
+	//request processing on the server,receive to send
+	kMetricReadLatency = 0,
+	kMetricUpdateLatency,
+	kMetricReadManyLatency,
+	kMetricUpdateManyLatency,
+	kMetricAckLatency,
+	//response sent to its ack received
+	kMetricAckRoundTrip,
+	//deferred update waiting for its lease to end
+	kMetricDeferWait,
+	//timer fired this late
+	kMetricTimerLag,
+	kMetricHistogramCount,
+};
+
+//
+// log-linear buckets as in HdrHistogram,every power of two is split in
+// kSubBucketCount,so a value is kept within 1/kSubBucketCount of itself.
+// values are nanoseconds,anything above ~4.9 hours lands in the last bucket
+struct MetricBuckets {
+	enum MetricBucketsLayout {
+		kSubBucketBits = 4,
+		kSubBucketCount = 1 << kSubBucketBits,
+		kMaxValueBits = 44,
+		kBucketCount = (kMaxValueBits - kSubBucketBits + 1) * kSubBucketCount,
+	};
+	static uint32_t highest_bit(uint64_t value) {
+#if defined(_MSC_VER)
+		unsigned long index;
+		_BitScanReverse64(&index, value);
+		return (uint32_t)index;
+#else
+		return (uint32_t)(63 - __builtin_clzll(value));
+#endif
+	}
+	static uint32_t index_of(uint64_t value) {
+		if (value < kSubBucketCount)
+			return (uint32_t)value;
+		uint32_t top = highest_bit(value);
+		if (unlikely(top >= kMaxValueBits))
+			return kBucketCount - 1;
+		uint32_t shift = top - kSubBucketBits;
+		return (shift + 1) * kSubBucketCount + (uint32_t)((value >> shift) & (kSubBucketCount - 1));
+	}
+	//smallest value of bucket index
+	static uint64_t lower_of(uint32_t index) {
+		if (index < kSubBucketCount)
+			return index;
+		uint32_t shift = index / kSubBucketCount - 1;
+		return (uint64_t)(kSubBucketCount + index % kSubBucketCount) << shift;
+	}
+	static uint64_t width_of(uint32_t index) {
+		return index < kSubBucketCount ? 1 : (uint64_t)1 << (index / kSubBucketCount - 1);
+	}
+};
+
+struct HistogramSnapshot {
+	std::vector<uint64_t> buckets;
+	uint64_t count;
+	//nanoseconds
+	uint64_t sum;
+	//q:0..1,return: middle of the bucket holding the q-th value,0 when empty
+	uint64_t value_at(double q) const {
+		if (!count)
+			return 0;
+		uint64_t rank = std::max<uint64_t>((uint64_t)(q * (double)count + 0.5), 1);
+		uint64_t seen = 0;
+		for (uint32_t i = 0; i < buckets.size(); ++i) {
+			seen += buckets[i];
+			if (seen >= rank)
+				return MetricBuckets::lower_of(i) + MetricBuckets::width_of(i) / 2;
+		}
+		return MetricBuckets::lower_of((uint32_t)buckets.size() - 1);
+	}
+};
+struct MetricsSnapshot {
+	std::array<uint64_t, kMetricCounterCount> counters;
+	std::array<HistogramSnapshot, kMetricHistogramCount> histograms;
+};
+
+//
+// counters and histograms of one thread. only that thread writes them,so an
+// update is a relaxed load and store,no locked instruction,no shared cache line.
+// a snapshot reads them relaxed from another thread and may be a few updates behind
+struct MetricShard {
+	struct Histogram {
+		std::array<std::atomic<uint64_t>, MetricBuckets::kBucketCount> buckets;
+		std::atomic<uint64_t> count;
+		std::atomic<uint64_t> sum;
+	};
+	static void bump(std::atomic<uint64_t>& value, uint64_t delta) {
+		value.store(value.load(std::memory_order_relaxed) + delta, std::memory_order_relaxed);
+	}
+	void count(MetricCounter counter, uint64_t delta) {
+		bump(counters[counter], delta);
+	}
+	void record(MetricHistogram histogram, uint64_t value) {
+		Histogram& h = histograms[histogram];
+		bump(h.buckets[MetricBuckets::index_of(value)], 1);
+		bump(h.count, 1);
+		bump(h.sum, value);
+	}
+	std::array<std::atomic<uint64_t>, kMetricCounterCount> counters;
+	std::array<Histogram, kMetricHistogramCount> histograms;
+};
+
+//
+// every thread counting gets a shard on first use,the registry keeps shards of
+// exited threads too so counters never go back. locks are taken only when a
+// thread first counts,when a source is added and when a snapshot is taken
+class CacheMetrics {
+public:
+	//appends its own lines in prometheus text format to out
+	using MetricSource = std::function<void(std::string& out)>;
+	static void count(MetricCounter counter, uint64_t delta = 1) {
+		if constexpr (CACHE_METRICS)
+			thread_shard()->count(counter, delta);
+	}
+	static void count_result(MetricCounter results, OpResult ret) {
+		if (likely((uint32_t)ret < kOpResultCount))
+			count((MetricCounter)(results + ret));
+	}
+	//value:nanoseconds
+	static void record(MetricHistogram histogram, uint64_t value) {
+		if constexpr (CACHE_METRICS)
+			thread_shard()->record(histogram, value);
+	}
+	//start of a measured span,0 when metrics are compiled out
+	static uint64_t now() {
+		if constexpr (!CACHE_METRICS)
+			return 0;
+		return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+			std::chrono::steady_clock::now().time_since_epoch()).count();
+	}
+	static void record_since(MetricHistogram histogram, uint64_t start) {
+		if constexpr (CACHE_METRICS)
+			record(histogram, now() - start);
+	}
+	static MetricsSnapshot snapshot();
+	//prometheus text exposition of a snapshot and of the sources
+	static std::string render();
+	static void add_source(MetricSource source);
+	//entries and bytes of a data center as gauges,hits,misses,inserts and evictions as counters
+	template <typename CenterType>
+	static void watch_data_center(const std::shared_ptr<CenterType>& center) {
+		std::weak_ptr<CenterType> weak = center;
+		add_source([weak](std::string& out) {
+			std::shared_ptr<CenterType> center = weak.lock();
+			if (!center)
+				return;
+			auto stats = center->stats();
+			append_metric(out, "csn_data_center_entries", "gauge", "keys held", (double)stats.entries);
+			append_metric(out, "csn_data_center_bytes", "gauge", "bytes of keys and values held", (double)stats.bytes);
+			append_metric(out, "csn_data_center_slab_bytes", "gauge", "memory of value slabs,free blocks included", (double)stats.slab_bytes);
+			append_metric(out, "csn_data_center_hits_total", "counter", "reads finding the key", (double)stats.hits);
+			append_metric(out, "csn_data_center_misses_total", "counter", "reads missing the key", (double)stats.misses);
+			append_metric(out, "csn_data_center_inserts_total", "counter", "keys inserted", (double)stats.inserts);
+			append_metric(out, "csn_data_center_evictions_total", "counter", "keys evicted", (double)stats.evictions);
+		});
+	}
+	static void append_metric(std::string& out, const char* name, const char* type, const char* help, double value);
+private:
+	static MetricShard* thread_shard() {
+		static thread_local MetricShard* shard = nullptr;
+		if (unlikely(!shard))
+			shard = attach();
+		return shard;
+	}
+	static MetricShard* attach();
+};
+
+//
+// writes CacheMetrics::render() out every interval_ms from a thread of its own,
+// to a file replaced as a whole(e.g. for a node_exporter textfile collector),
+// or as one datagram to a udp "host:port" or a unix datagram socket path
+class MetricsExporter {
+public:
+	enum MetricsTarget {
+		kExportFile = 0,
+		kExportUdp,
+		kExportUnix,
+	};
+	enum MetricsExporterDefault {
+		kDefaultInterval = 10000,
+	};
+	MetricsExporter(MetricsTarget target, std::string address, uint32_t interval_ms = kDefaultInterval) :
+		target_(target), address_(std::move(address)), interval_ms_(interval_ms),
+		thread_(), mutex_(), cond_(), running_(false), fd_(-1) {}
+	MetricsExporter(const MetricsExporter&) = delete;
+	MetricsExporter& operator=(const MetricsExporter&) = delete;
+	~MetricsExporter();
+	void start();
+	//writes a last time before it returns
+	void stop();
+	//throw csn::Exception when the target can't be written
+	void export_now();
+private:
+	void run();
+	void write_file(const std::string& text);
+	void send_datagram(const std::string& text);
+	MetricsTarget			target_;
+	std::string				address_;
+	uint32_t				interval_ms_;
+	std::thread				thread_;
+	std::mutex				mutex_;
+	std::condition_variable cond_;
+	bool					running_;
+	int						fd_;
+};
+CACHE_NAMESPACE_END
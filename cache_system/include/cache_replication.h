@@ -0,0 +1,444 @@
+/*
+ * cache_replication.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: rynzen <chuanrui123@126.com>
+ *
+ *  This file is part of a cache system of lease mechanism implemenation.
+ *
+ *  cache_replication.h is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  cache_replication.h is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with consistent_hashing.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <deque>
+#include <vector>
+#include <string>
+#include <memory>
+#include <functional>
+#include <random>
+#include "common.h"
+#include "timer_queue.h"
+#include "cache_data_center.h"
+#include "cache_state_manager.h"
+#include "protobuf_message_common.h"
+#include "protobuf_message_server_impl.h"
+#include "socket_group_epoll_impl.h"
+
+#if !defined(OS_LINUX)
+#error "cache_replication.h needs linux epoll and eventfd"
+#endif
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+CACHE_NAMESPACE_BEGIN
+struct CacheReplicatorStats {
+	uint64_t items;
+	uint64_t batches;
+	uint64_t retransmits;
+	//backups given up on,too far behind to catch up or restarted
+	uint64_t dropped_backups;
+};
+
+//
+// primary side of replication,attached to the CacheDataCenter as commit listener.
+// committed values are packed into kReplicateUpdates batches numbered from 1 and
+// sent to every backup from a thread of its own,with its own socket per backup.
+// a backup acks cumulatively with the batch it expects next,batches not acked in
+// kRetransmitMs are sent again from there on(go back n),an idle backup gets a
+// heartbeat so it knows the primary is alive. batches are kept until every
+// backup acked them,a backup kMaxWindow batches behind is given up on,so is one
+// whose acks come from a new session,it restarted and lost what it had applied.
+// either needs a snapshot to join again.
+// Example:
+//		std::shared_ptr<CacheReplicator> replicator = std::make_shared<CacheReplicator>();
+//		replicator->add_backup("127.0.0.1", 3825);
+//		center->add_commit_listener(replicator);
+//		replicator->start();
+class CacheReplicator :public CacheCommitListener<std::string>, public TimerSource {
+	enum CacheReplicatorDefault {
+		kRetransmitMs = 100,
+		kHeartbeatMs = 100,
+		//batches resent to a backup per retransmit
+		kResendBurst = 64,
+		kMaxWindow = 1 << 16,
+	};
+	struct ReplicateItem {
+		uint64_t	cache_id;
+		uint64_t	version;
+		std::string value;
+	};
+	class BackupSocket :public MmsgUdpSocket {
+	public:
+		BackupSocket(CacheReplicator& owner, size_t index) :owner_(owner), index_(index) {}
+		void on_receive(std::string_view data) override {
+			owner_.on_ack(index_, data);
+		}
+	private:
+		CacheReplicator& owner_;
+		size_t			 index_;
+	};
+	struct Backup {
+		std::shared_ptr<BackupSocket> socket;
+		//batch the backup expects next
+		uint64_t	acked;
+		//of its first ack,0 before
+		uint64_t	session;
+		std::time_t last_sent;
+		std::time_t resend_at;
+		bool		dropped;
+	};
+public:
+	CacheReplicator() :event_fd_(-1), backups_(), thread_(), running_(false), mutex_(), pending_(),
+		window_(), window_base_(1), next_sequence_(1), next_tick_(0), stats_{} {}
+	CacheReplicator(const CacheReplicator&) = delete;
+	CacheReplicator& operator=(const CacheReplicator&) = delete;
+	~CacheReplicator() {
+		stop();
+		if (event_fd_ >= 0)
+			::close(event_fd_);
+	}
+	//before start(),binds a socket of its own for the backup's acks
+	void add_backup(const std::string& host, uint16_t port) {
+		std::shared_ptr<BackupSocket> socket = std::make_shared<BackupSocket>(*this, backups_.size());
+		socket->initialize("*", 0, host, port);
+		backups_.push_back(Backup{ socket, 1, 0, 0, 0, false });
+	}
+	void start() {
+		if (running_.exchange(true))
+			throw csn::Exception(csn::Exception::kErrorIllUsage, "CacheReplicator already started");
+		event_fd_ = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+		if (event_fd_ < 0)
+			throw csn::Exception(csn::Exception::kErrorSysRoutine, "eventfd failure");
+		thread_ = std::thread(&CacheReplicator::run, this);
+	}
+	//batches not acked yet are lost for the backups
+	void stop() {
+		if (!running_.exchange(false))
+			return;
+		wake();
+		thread_.join();
+	}
+	void on_commit(uint64_t cache_id, uint64_t version, const SlabString& value) override {
+		bool first = false;
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			first = pending_.empty();
+			pending_.push_back(ReplicateItem{ cache_id, version, std::string(value.view()) });
+		}
+		if (first)
+			wake();
+	}
+	CacheReplicatorStats stats() {
+		std::lock_guard<std::mutex> lock(mutex_);
+		return stats_;
+	}
+	uint32_t next_timeout_ms() override {
+		int64_t left = (int64_t)next_tick_ - (int64_t)get_time_stamp();
+		return (uint32_t)std::max<int64_t>(left, 0);
+	}
+	//retransmit,heartbeat and trim the window
+	void tick() override {
+		std::time_t now = get_time_stamp();
+		if (now < next_tick_)
+			return;
+		next_tick_ = now + std::min<uint32_t>(kRetransmitMs, kHeartbeatMs) / 2;
+		std::string heartbeat;
+		for (Backup& backup : backups_) {
+			if (backup.dropped)
+				continue;
+			if (backup.acked < next_sequence_ && now >= backup.resend_at) {
+				uint64_t end = std::min<uint64_t>(next_sequence_, backup.acked + kResendBurst);
+				for (uint64_t sequence = backup.acked; sequence < end; ++sequence)
+					send(backup, window_[sequence - window_base_], now);
+				backup.resend_at = now + kRetransmitMs;
+				std::lock_guard<std::mutex> lock(mutex_);
+				stats_.retransmits += end - backup.acked;
+			}
+			else if (now - backup.last_sent >= kHeartbeatMs) {
+				if (heartbeat.empty())
+					heartbeat = make_batch(next_sequence_, nullptr, 0, 0);
+				send(backup, heartbeat, now);
+			}
+		}
+		trim();
+	}
+private:
+	void wake() {
+		uint64_t one = 1;
+		if (::write(event_fd_, &one, sizeof(one)) < 0)
+			LOG_OUT("replicator wake up failure");
+	}
+	void run() {
+		SocketGroupEpollImpl group{};
+		for (Backup& backup : backups_)
+			group.register_socket(backup.socket);
+		group.register_handler(event_fd_, std::bind(&CacheReplicator::drain, this));
+		group.add_timer_source(this);
+		while (running_) {
+			try {
+				group.listen(-1);
+			}
+			catch (csn::Exception e) { LOG_OUT("replicator csn::Exception code:%d describe:%s", e.code(), e.what()); }
+			catch (std::exception e) { LOG_OUT("replicator std::exception code:%s", e.what()); }
+		}
+		drain();
+		for (Backup& backup : backups_)
+			backup.socket->flush();
+	}
+	//pack committed values into batches and send them to every backup
+	void drain() {
+		uint64_t count;
+		if (::read(event_fd_, &count, sizeof(count)) < 0 && errno != EAGAIN)
+			LOG_OUT("replicator read eventfd failure");
+		std::vector<ReplicateItem> items;
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			items.swap(pending_);
+			stats_.items += items.size();
+		}
+		std::time_t now = get_time_stamp();
+		size_t first = 0;
+		while (first < items.size()) {
+			size_t size = 0, last = first;
+			//one item at least,a value came in a datagram,it fits one
+			do {
+				size += item_size(items[last]);
+				++last;
+			} while (last < items.size() && size + item_size(items[last]) <= kMaxUdpPacketSize - kMaxManyHeaderSize);
+			window_.push_back(make_batch(next_sequence_, items.data(), first, last));
+			for (Backup& backup : backups_) {
+				if (backup.dropped)
+					continue;
+				//nothing outstanding,retransmit clock starts with this batch
+				if (backup.acked == next_sequence_)
+					backup.resend_at = now + kRetransmitMs;
+				send(backup, window_.back(), now);
+			}
+			++next_sequence_;
+			first = last;
+			std::lock_guard<std::mutex> lock(mutex_);
+			++stats_.batches;
+		}
+		trim();
+	}
+	void on_ack(size_t index, std::string_view data) {
+		CacheMessage ack;
+		if (!ack.ParseFromArray(data.data(), (int)data.size()) || !header_available(&ack)
+			|| ack.header().type() != CacheMessageProto::kOperationAck)
+			return;
+		Backup& backup = backups_[index];
+		if (backup.dropped)
+			return;
+		if (!backup.session)
+			backup.session = ack.replicate().session();
+		else if (ack.replicate().session() != backup.session) {
+			drop(backup, "restarted");
+			return;
+		}
+		//an older ack came late
+		uint64_t expected = std::min<uint64_t>(ack.header().op_id(), next_sequence_);
+		if (expected <= backup.acked)
+			return;
+		backup.acked = expected;
+		backup.resend_at = get_time_stamp() + kRetransmitMs;
+	}
+	//forget batches every backup has,give up on a backup holding too many
+	void trim() {
+		uint64_t acked = next_sequence_;
+		for (Backup& backup : backups_) {
+			if (backup.dropped)
+				continue;
+			if (next_sequence_ - backup.acked > kMaxWindow)
+				drop(backup, "too far behind");
+			else
+				acked = std::min(acked, backup.acked);
+		}
+		while (window_base_ < acked) {
+			window_.pop_front();
+			++window_base_;
+		}
+	}
+	void drop(Backup& backup, const char* reason) {
+		backup.dropped = true;
+		LOG_OUT("replication to a backup stopped,%s,it needs a snapshot to join again", reason);
+		std::lock_guard<std::mutex> lock(mutex_);
+		++stats_.dropped_backups;
+	}
+	void send(Backup& backup, const std::string& batch, std::time_t now) {
+		backup.socket->do_send(batch);
+		backup.last_sent = now;
+	}
+	static size_t item_size(const ReplicateItem& item) {
+		size_t size = 1 + google::protobuf::io::CodedOutputStream::VarintSize64(item.cache_id)
+			+ 1 + google::protobuf::io::CodedOutputStream::VarintSize64(item.version)
+			+ 1 + google::protobuf::io::CodedOutputStream::VarintSize32((uint32_t)item.value.size()) + item.value.size();
+		return 1 + google::protobuf::io::CodedOutputStream::VarintSize32((uint32_t)size) + size;
+	}
+	//items [first,last) of items,a heartbeat when there are none
+	static std::string make_batch(uint64_t sequence, const ReplicateItem* items, size_t first, size_t last) {
+		CacheMessage message;
+		CacheMessageHeader* header = message.mutable_header();
+		header->set_magic(HEADER_MAGIC);
+		header->set_version(HEADER_VERSION);
+		header->set_type(CacheMessageProto::kReplicateUpdates);
+		header->set_op_id(sequence);
+		CacheReplicate* replicate = message.mutable_replicate();
+		for (size_t i = first; i < last; ++i) {
+			CacheReplicateItem* item = replicate->add_items();
+			item->set_cache_id(items[i].cache_id);
+			item->set_version(items[i].version);
+			item->set_cache_data(items[i].value);
+		}
+		return message.SerializeAsString();
+	}
+	int						  event_fd_;
+	//touched by the replicator thread only once started
+	std::vector<Backup>		  backups_;
+	std::thread				  thread_;
+	std::atomic<bool>		  running_;
+	std::mutex				  mutex_;
+	//committed values not packed yet
+	std::vector<ReplicateItem> pending_;
+	//serialized batches from window_base_ on,not acked by every backup
+	std::deque<std::string>	  window_;
+	uint64_t				  window_base_;
+	uint64_t				  next_sequence_;
+	std::time_t				  next_tick_;
+	CacheReplicatorStats	  stats_;
+};
+
+//
+// backup side of replication,installed on the ProtobufMessageServerImpl the primary
+// sends to. batches are applied in sequence,a gap is left for the primary to fill.
+// a backup answers no client,leases it granted would bind nobody. promote() makes
+// it the primary,but leases the old primary granted may still be held,so clients
+// are answered only kDefaultExpireMillisecond later. with failover_ms set,a backup
+// that heard the primary once promotes itself when it hears nothing for that long,
+// meant for one backup,several would all promote themselves.
+// the replica is a timer source of the server's event loop and outlives the server.
+// Example:
+//		CacheReplica replica(impl, 1000);
+//		replica.set_promote_handler([]() { LOG_OUT("promoted"); });
+//		group.add_timer_source(&replica);
+class CacheReplica :public TimerSource {
+	enum CacheReplicaDefault {
+		kFailoverCheckMs = 50,
+	};
+	struct ReplicaState {
+		//batch expected next
+		uint64_t	expected = 1;
+		std::time_t last_heard = 0;
+		//0 while a backup,clients are answered from then on
+		std::time_t serve_after = 0;
+		bool		serving = false;
+		uint64_t	applied = 0;
+		//sent in every ack,nonzero
+		uint64_t	session = 0;
+	};
+	class CacheReplicateOperation :public CacheOperationInterface {
+	public:
+		CacheReplicateOperation(const std::shared_ptr<csn::CacheDataCenter<CacheDataType>>& center, ReplicaState& state) :
+			CacheOperationInterface(center), state_(state) {}
+		void on_process(const std::shared_ptr<ProtoSocket>& socket, PeerId peer, CacheMessage* request, const ArenaPtr& arena) override {
+			if (unlikely(!request || !request->has_replicate()))
+				return;
+			if (state_.serve_after) {
+				LOG_OUT("drop replicated batch,promoted to primary");
+				return;
+			}
+			state_.last_heard = get_time_stamp();
+			//a heartbeat carries the next batch,nothing to apply
+			if (request->header().op_id() == state_.expected && request->replicate().items_size()) {
+				for (const CacheReplicateItem& item : request->replicate().items())
+					center_->restore(item.cache_id(), item.version(), item.cache_data());
+				state_.applied += request->replicate().items_size();
+				++state_.expected;
+			}
+			CacheMessage* ack = google::protobuf::Arena::CreateMessage<CacheMessage>(arena.get());
+			CacheMessageHeader* header = ack->mutable_header();
+			header->set_magic(HEADER_MAGIC);
+			header->set_version(HEADER_VERSION);
+			header->set_type(CacheMessageProto::kOperationAck);
+			header->set_op_id(state_.expected);
+			ack->mutable_replicate()->set_session(state_.session);
+			do_send_cache_message(socket, ack, peer);
+		}
+	private:
+		ReplicaState& state_;
+	};
+public:
+	using PromoteHandler = std::function<void(void)>;
+	//failover_ms:0 to promote by hand only
+	CacheReplica(const std::shared_ptr<ProtobufMessageServerImpl>& server, uint32_t failover_ms = 0) :
+		center_(server->data_center()), failover_ms_(failover_ms), state_(), next_check_(0), promoted_() {
+		std::random_device random{};
+		state_.session = ((uint64_t)random() << 32 | random()) | 1;
+		server->set_operation(CacheMessageProto::kReplicateUpdates,
+			std::make_shared<CacheReplicateOperation>(center_, state_));
+		server->set_dispatch_filter(std::bind(&CacheReplica::dispatch, this,
+			std::placeholders::_1, std::placeholders::_2));
+	}
+	//takes over as primary,clients are answered kDefaultExpireMillisecond later
+	void promote() {
+		if (state_.serve_after)
+			return;
+		state_.serve_after = get_time_stamp(kDefaultExpireMillisecond);
+		center_->fence_writes(state_.serve_after);
+		LOG_OUT("promoted to primary after batch %llu,serving in %u ms",
+			(unsigned long long)state_.expected - 1, kDefaultExpireMillisecond);
+		if (promoted_)
+			promoted_();
+	}
+	//handle:runs on promotion,e.g. to replicate to the remaining backups
+	void set_promote_handler(PromoteHandler handle) { promoted_ = std::move(handle); }
+	bool serving() const { return state_.serving; }
+	//values applied from the primary
+	uint64_t applied() const { return state_.applied; }
+	uint32_t next_timeout_ms() override {
+		if (!failover_ms_ || state_.serve_after)
+			return kTimerIdle;
+		int64_t left = (int64_t)next_check_ - (int64_t)get_time_stamp();
+		return (uint32_t)std::max<int64_t>(left, 0);
+	}
+	void tick() override {
+		if (!failover_ms_ || state_.serve_after)
+			return;
+		std::time_t now = get_time_stamp();
+		if (now < next_check_)
+			return;
+		next_check_ = now + kFailoverCheckMs;
+		if (state_.last_heard && now - state_.last_heard > failover_ms_) {
+			LOG_OUT("primary silent for %u ms", failover_ms_);
+			promote();
+		}
+	}
+private:
+	bool dispatch(std::string_view, CacheMessage* request) {
+		if (request->header().type() == CacheMessageProto::kReplicateUpdates || state_.serving)
+			return true;
+		if (state_.serve_after && get_time_stamp() >= state_.serve_after) {
+			state_.serving = true;
+			return true;
+		}
+		return false;
+	}
+	std::shared_ptr<csn::CacheDataCenter<CacheDataType>> center_;
+	uint32_t		failover_ms_;
+	ReplicaState	state_;
+	std::time_t		next_check_;
+	PromoteHandler	promoted_;
+};
+CACHE_NAMESPACE_END
@@ -0,0 +1,310 @@
+/*
+ * cache_snapshot.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: rynzen <chuanrui123@126.com>
+ *
+ *  This file is part of a cache system of lease mechanism implemenation.
+ *
+ *  cache_snapshot.h is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  cache_snapshot.h is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with consistent_hashing.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <vector>
+#include <string>
+#include <string_view>
+#include <memory>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include "common.h"
+#include "cache_data_center.h"
+#include "cache_state_manager.h"
+#include "cache_wal.h"
+
+#if defined(OS_LINUX)
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+CACHE_NAMESPACE_BEGIN
+//
+// point in time copy of a CacheDataCenter<std::string> on disk,so a restarted
+// server comes back warm instead of sending every client to the backing store.
+// each shard is copied under its own lock into a buffer and written after the
+// lock is released,event loops wait on one shard at a time,never on the disk.
+// file layout,host byte order:
+//		SnapshotHeader
+//		SnapshotSection[section_count]		one per shard of the writer
+//		records of section 0,1...			cache_id:u64 version:u64 size:u32 bytes
+// a snapshot goes to path.tmp and is renamed over path once complete.
+// load() maps the file and puts sections back from several threads,values come
+// back without lease. leases granted before the restart may still be held by
+// clients,so load() fences updates off for kDefaultExpireMillisecond.
+class CacheSnapshot {
+	enum SnapshotFormat {
+		kSnapshotMagic = 0x534E4150,
+		kSnapshotVersion = 1,
+		//cache_id,version,size
+		kRecordHeaderSize = 8 + 8 + 4,
+	};
+	struct SnapshotHeader {
+		uint32_t magic;
+		uint32_t version;
+		uint32_t section_count;
+		uint32_t reserved;
+		uint64_t entry_count;
+	};
+	struct SnapshotSection {
+		//from the start of the file
+		uint64_t offset;
+		uint64_t size;
+		uint64_t count;
+	};
+public:
+	using CenterType = CacheDataCenter<std::string>;
+	//return: keys written
+	static uint64_t save(CenterType& center, const std::string& path) {
+		std::string temp_path = path + ".tmp";
+		std::unique_ptr<FILE, int(*)(FILE*)> file(std::fopen(temp_path.c_str(), "wb"), &std::fclose);
+		if (!file)
+			throw Exception(Exception::kErrorWrite, "open snapshot " + temp_path + " failure");
+		SnapshotHeader header{ kSnapshotMagic, kSnapshotVersion, (uint32_t)center.shard_count(), 0, 0 };
+		std::vector<SnapshotSection> sections(header.section_count);
+		uint64_t offset = sizeof(header) + sections.size() * sizeof(SnapshotSection);
+		if (std::fseek(file.get(), (long)offset, SEEK_SET) != 0)
+			throw Exception(Exception::kErrorWrite, "seek snapshot failure");
+		//reused by every shard,grows to the largest one
+		std::string buffer;
+		for (size_t i = 0; i < sections.size(); ++i) {
+			buffer.clear();
+			uint64_t count = 0;
+			center.visit_shard(i, [&buffer, &count](uint64_t cache_id, uint64_t version, const SlabString& value) {
+				append_record(&buffer, cache_id, version, value.view());
+				++count;
+			});
+			write_all(file.get(), buffer.data(), buffer.size());
+			sections[i] = SnapshotSection{ offset, buffer.size(), count };
+			offset += buffer.size();
+			header.entry_count += count;
+		}
+		std::rewind(file.get());
+		write_all(file.get(), &header, sizeof(header));
+		write_all(file.get(), sections.data(), sections.size() * sizeof(SnapshotSection));
+		if (std::fflush(file.get()) != 0)
+			throw Exception(Exception::kErrorWrite, "flush snapshot failure");
+#if defined(OS_LINUX)
+		if (::fsync(::fileno(file.get())) != 0)
+			throw Exception(Exception::kErrorWrite, "fsync snapshot failure");
+#endif
+		file.reset();
+		if (std::rename(temp_path.c_str(), path.c_str()) != 0)
+			throw Exception(Exception::kErrorWrite, "rename snapshot " + temp_path + " failure");
+		return header.entry_count;
+	}
+	//threads:sections are spread over them,0 for hardware concurrency
+	//return: keys restored,into an empty center before it serves anybody
+	static uint64_t load(CenterType& center, const std::string& path, uint32_t threads = 0) {
+		SnapshotFile file(path);
+		std::string_view data = file.data();
+		SnapshotHeader header;
+		if (data.size() < sizeof(header))
+			throw Exception(Exception::kErrorReadFormat, "snapshot too short");
+		std::memcpy(&header, data.data(), sizeof(header));
+		if (header.magic != kSnapshotMagic || header.version != kSnapshotVersion
+			|| (data.size() - sizeof(header)) / sizeof(SnapshotSection) < header.section_count)
+			throw Exception(Exception::kErrorReadFormat, "bad snapshot header");
+		std::vector<SnapshotSection> sections(header.section_count);
+		std::memcpy(sections.data(), data.data() + sizeof(header), sections.size() * sizeof(SnapshotSection));
+		for (const SnapshotSection& section : sections) {
+			if (section.offset > data.size() || section.size > data.size() - section.offset)
+				throw Exception(Exception::kErrorReadFormat, "snapshot section out of range");
+		}
+		if (!threads)
+			threads = std::max<uint32_t>(std::thread::hardware_concurrency(), 1);
+		threads = (uint32_t)std::min<size_t>(threads, std::max<size_t>(sections.size(), 1));
+		std::atomic<uint64_t> restored(0);
+		std::atomic<bool> corrupted(false);
+		auto load_sections = [&](uint32_t first) {
+			for (size_t i = first; i < sections.size(); i += threads) {
+				std::string_view section = data.substr(sections[i].offset, sections[i].size);
+				if (!load_section(center, section, &restored)) {
+					corrupted = true;
+					return;
+				}
+			}
+		};
+		std::vector<std::thread> workers;
+		for (uint32_t i = 1; i < threads; ++i)
+			workers.emplace_back(load_sections, i);
+		load_sections(0);
+		for (std::thread& worker : workers)
+			worker.join();
+		center.fence_writes(get_time_stamp(kDefaultExpireMillisecond));
+		if (corrupted)
+			throw Exception(Exception::kErrorReadFormat, "snapshot record out of range");
+		return restored;
+	}
+private:
+	//whole file in memory,mapped where possible
+	class SnapshotFile {
+	public:
+		explicit SnapshotFile(const std::string& path) :data_(), size_(0), buffer_() {
+#if defined(OS_LINUX)
+			int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+			if (fd < 0)
+				throw Exception(Exception::kErrorRead, "open snapshot " + path + " failure");
+			struct stat st;
+			if (::fstat(fd, &st) != 0) {
+				::close(fd);
+				throw Exception(Exception::kErrorRead, "stat snapshot failure");
+			}
+			size_ = (size_t)st.st_size;
+			if (size_) {
+				void* map = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE | MAP_POPULATE, fd, 0);
+				if (map == MAP_FAILED) {
+					::close(fd);
+					throw Exception(Exception::kErrorRead, "mmap snapshot failure");
+				}
+				data_ = static_cast<const char*>(map);
+			}
+			::close(fd);
+#else
+			std::ifstream in(path, std::ios::binary);
+			if (!in)
+				throw Exception(Exception::kErrorRead, "open snapshot " + path + " failure");
+			buffer_.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+			data_ = buffer_.data();
+			size_ = buffer_.size();
+#endif
+		}
+		SnapshotFile(const SnapshotFile&) = delete;
+		SnapshotFile& operator=(const SnapshotFile&) = delete;
+		~SnapshotFile() {
+#if defined(OS_LINUX)
+			if (data_)
+				::munmap(const_cast<char*>(data_), size_);
+#endif
+		}
+		std::string_view data() const { return std::string_view(data_, size_); }
+	private:
+		const char* data_;
+		size_t		size_;
+		//file read in,where it can't be mapped
+		std::string buffer_;
+	};
+	static void append_record(std::string* buffer, uint64_t cache_id, uint64_t version, std::string_view value) {
+		uint32_t size = (uint32_t)value.size();
+		size_t at = buffer->size();
+		buffer->resize(at + kRecordHeaderSize + size);
+		char* p = &(*buffer)[at];
+		std::memcpy(p, &cache_id, 8);
+		std::memcpy(p + 8, &version, 8);
+		std::memcpy(p + 16, &size, 4);
+		if (size)
+			std::memcpy(p + kRecordHeaderSize, value.data(), size);
+	}
+	//return: false when a record runs past the section
+	static bool load_section(CenterType& center, std::string_view section, std::atomic<uint64_t>* restored) {
+		uint64_t count = 0;
+		while (!section.empty()) {
+			if (section.size() < kRecordHeaderSize)
+				return false;
+			uint64_t cache_id, version;
+			uint32_t size;
+			std::memcpy(&cache_id, section.data(), 8);
+			std::memcpy(&version, section.data() + 8, 8);
+			std::memcpy(&size, section.data() + 16, 4);
+			if (section.size() - kRecordHeaderSize < size)
+				return false;
+			center.restore(cache_id, version, section.substr(kRecordHeaderSize, size));
+			++count;
+			section.remove_prefix(kRecordHeaderSize + size);
+		}
+		*restored += count;
+		return true;
+	}
+	static void write_all(FILE* file, const void* data, size_t size) {
+		if (size && std::fwrite(data, 1, size, file) != size)
+			throw Exception(Exception::kErrorWrite, "write snapshot failure");
+	}
+};
+
+//
+// saves a snapshot of center every interval from a thread of its own,
+// segments of wal the snapshot covers are dropped once it is saved
+// Example:
+//		CacheSnapshotWriter writer(center, "/var/lib/cache/snapshot", 60000);
+//		writer.start();
+class CacheSnapshotWriter {
+public:
+	//wal:may be null
+	CacheSnapshotWriter(const std::shared_ptr<CacheSnapshot::CenterType>& center, std::string path, uint32_t interval_ms,
+		std::shared_ptr<CacheWal> wal = nullptr) :
+		center_(center), path_(std::move(path)), interval_ms_(interval_ms), wal_(std::move(wal)),
+		thread_(), mutex_(), cond_(), running_(false) {}
+	~CacheSnapshotWriter() {
+		stop();
+	}
+	void start() {
+		std::lock_guard<std::mutex> lock(mutex_);
+		if (running_)
+			throw Exception(Exception::kErrorIllUsage, "CacheSnapshotWriter already started");
+		running_ = true;
+		thread_ = std::thread(&CacheSnapshotWriter::run, this);
+	}
+	//a snapshot being written is finished first
+	void stop() {
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			if (!running_)
+				return;
+			running_ = false;
+		}
+		cond_.notify_all();
+		thread_.join();
+	}
+private:
+	void run() {
+		std::unique_lock<std::mutex> lock(mutex_);
+		while (!cond_.wait_for(lock, std::chrono::milliseconds(interval_ms_), [this]() { return !running_; })) {
+			lock.unlock();
+			try {
+				//commits from here on go to the new segment,earlier ones are in the snapshot
+				uint64_t segment = wal_ ? wal_->rotate() : 0;
+				uint64_t count = CacheSnapshot::save(*center_, path_);
+				if (wal_)
+					wal_->drop_before(segment);
+				LOG_OUT("snapshot %llu keys to %s", (unsigned long long)count, path_.c_str());
+			}
+			catch (csn::Exception e) { LOG_OUT("snapshot csn::Exception code:%d describe:%s", e.code(), e.what()); }
+			lock.lock();
+		}
+	}
+	std::shared_ptr<CacheSnapshot::CenterType> center_;
+	std::string				path_;
+	uint32_t				interval_ms_;
+	std::shared_ptr<CacheWal> wal_;
+	std::thread				thread_;
+	std::mutex				mutex_;
+	std::condition_variable cond_;
+	bool					running_;
+};
+CACHE_NAMESPACE_END
@@ -22,159 +22,233 @@
 #pragma once
 #include <memory>
 #include <functional>
+#include <vector>
+#include <algorithm>
+#include <ctime>
 #include "timer_queue.h"
 #include "common.h"
 #include "cache_data_center.h"
 
 CACHE_NAMESPACE_BEGIN
-class CacheStateManager {
-private:
-	enum class CacheState:uint32_t{ kCacheIdle = 0, kCacheGuaranteed, kCacheUpdateProtected, kCacheStateCount };
-	class CacheStateInterface :public std::enable_shared_from_this<CacheStateInterface> {
-	public:
-		//CacheStateInterface is private defined and used inside the CacheStateManager
-		//so just use a refenence of CacheStateManager
-		CacheStateInterface(CacheStateManager& mng) :mng_(mng) {}
-		virtual ~CacheStateInterface() = default;
-		//op_id:  request operation id 
-		//return: OpResult
-		virtual OpResult update_op(uint32_t op_id/*IN*/, UpdateCallHandler f/*IN*/, std::time_t* tp/*OUT*/) = 0;
-		//op_id:  request operation id 
-		//return: expire timepoint for this operation,usually is now()+kDefaultExpireMillisecond,
-		//		  when enter CacheUpdateProtectedState,operation returns now();
-		virtual OpResult read_op(uint32_t op_id/*IN*/, std::time_t* tp/*OUT*/) = 0;
+enum class CacheState :uint8_t { kCacheIdle = 0, kCacheGuaranteed, kCacheUpdateProtected };
 
-		//enter this with operation id
-		virtual void enter_state() = 0;
-	protected:
-		CacheStateManager& mng_;
+//
+// everything a key holds: the value,its lease and the peers holding it.
+// an update waiting for the lease to end is the only other thing on the heap,
+// and only while it waits.
+template <typename T>
+struct CacheLease {
+	using ValueType=T;
+	struct PendingUpdate {
+		ValueType		  value;
+		uint32_t		  op_id;
+		UpdateCallHandler call;
+		//updater,holds the lease once committed
+		PeerId			  peer;
+		//invalidation pushed to the holders and acks still missing
+		uint64_t		  invalidate_id;
+		uint32_t		  outstanding;
+	};
+	//a peer granted a lease and when its lease ends,a renewal by others
+	//doesn't extend it
+	struct LeaseHolder {
+		PeerId			  peer;
+		std::time_t		  expire;
 	};
-	class CacheIdleState :public CacheStateInterface {
-	public:
-		CacheIdleState(CacheStateManager& mng) :CacheStateInterface(mng) {}
-		OpResult update_op(uint32_t op_id/*IN*/, UpdateCallHandler f/*IN*/, std::time_t* tp/*OUT*/) override {
-			mng_.set_cache_state(CacheState::kCacheGuaranteed);
-			*tp = mng_.expire_time();
+	ValueType						value{};
+	//of the value,see CacheStateManager::kVersionClockShift
+	uint64_t						version = 0;
+	std::time_t						expire = 0;
+	//0 when no timer armed
+	size_t							timer_id = 0;
+	std::unique_ptr<PendingUpdate>	pending;
+	//peers granted current lease,lapsed ones dropped on renewal and update
+	std::vector<LeaseHolder>		holders;
+	CacheState						state = CacheState::kCacheIdle;
+};
+
+//
+// lease transitions,stateless,all state lives in the CacheLease and its timers
+// in the TimerQueue passed in,which also runs the expire callbacks.
+//		Idle --read/update--> Guaranteed --update--> UpdateProtected
+//		  ^          expire       |  ^                     | expire,commit pending
+//		  +-----------------------+  +---------------------+
+// a read in the last kLeaseRenewMillisecond of a Guaranteed lease renews it,
+// earlier ones share the running lease and leave its timer alone,so a hot key
+// stays Guaranteed without rearming a timer per read. a read in UpdateProtected
+// gets the old value without lease,an update in UpdateProtected has to retry.
+// an update in Guaranteed hands back the holders to be invalidated,once all of
+// them acked the pending value commits without waiting for the lease to end.
+// holders whose own lease ended are left out,a peer gone for good can't hold
+// an update up,and are dropped as the lease renews,so the list stays bounded.
+// an updater holding the lease alone commits right away.
+// a lease is erased only after stop_expire(),or together with its queue
+class CacheStateManager {
+public:
+	enum CacheVersionClock {
+		//a commit takes the next version,at least the millisecond it commits at
+		//shifted by this. a key created again after eviction,restored from a
+		//snapshot missing its last updates or failed over to a backup behind
+		//the primary never hands out a version an earlier life did,as long as
+		//the clock doesn't go back and a key sees under 2^20 updates a millisecond
+		kVersionClockShift = 20,
+	};
+	//op_id:  request operation id
+	//return: expire timepoint for this operation,at most now()+kDefaultExpireMillisecond,
+	//		  in UpdateProtected state returns now()
+	//peer:   reader,holds the lease granted
+	template <typename T>
+	static OpResult read_op(CacheLease<T>& lease, TimerQueue* queue, uint32_t op_id/*IN*/, PeerId peer/*IN*/, std::time_t* tp/*OUT*/) {
+		switch (lease.state) {
+		case CacheState::kCacheIdle:
+			enter_guaranteed(lease, queue);
+			hold(lease, peer);
+			*tp = lease.expire;
 			return kOperationOk;
-		}
-		OpResult read_op(uint32_t op_id/*IN*/, std::time_t* tp/*OUT*/) override {
-			mng_.set_cache_state(CacheState::kCacheGuaranteed);
-			*tp = mng_.expire_time();
+		case CacheState::kCacheGuaranteed: {
+			std::time_t now = get_time_stamp();
+			if (lease.expire < now + kLeaseRenewMillisecond) {
+				drop_lapsed(lease, now);
+				enter_guaranteed(lease, queue);
+			}
+			hold(lease, peer);
+			*tp = lease.expire;
 			return kOperationOk;
 		}
-		void enter_state() override {
-			mng_.set_timer_id(0);
-			mng_.set_expire_time(0);
+		default:
+			*tp = get_time_stamp();
+			return kOperationOk;
 		}
-	};
-	struct CacheGuaranteedState :public CacheStateInterface {
-	public:
-		CacheGuaranteedState(CacheStateManager& mng) :CacheStateInterface(mng) {}
-		OpResult update_op(uint32_t op_id/*IN*/, UpdateCallHandler f/*IN*/, std::time_t* tp/*OUT*/) override {
+	}
+	//op_id:  request operation id
+	//f:      called with the new expire when a deferred update commits
+	//peer:   updater,holds the lease once value is stored
+	//invalidate_id,holders: on kOperationDefer,other holders of the lease to push
+	//		  invalidate_id to,each acked by invalidate_acked()
+	//return: kOperationDefer when value is kept pending until current lease ends
+	template <typename T, typename U>
+	static OpResult update_op(CacheLease<T>& lease, TimerQueue* queue, U&& value/*IN*/,
+		uint32_t op_id/*IN*/, UpdateCallHandler f/*IN*/, PeerId peer/*IN*/, uint64_t invalidate_id/*IN*/,
+		std::vector<PeerId>* holders/*OUT*/, std::time_t* tp/*OUT*/) {
+		switch (lease.state) {
+		case CacheState::kCacheIdle:
+			commit_value(lease, queue, std::forward<U>(value), peer);
+			*tp = lease.expire;
+			return kOperationOk;
+		case CacheState::kCacheGuaranteed:
 			if (unlikely(!op_id || !f))
 				throw Exception(Exception::kErrorIllArgument, "CacheGuaranteedState update_op with error argument");
-			mng_.set_op_id(op_id);
-			mng_.set_call_handle(f);
-			mng_.set_cache_state(CacheState::kCacheUpdateProtected);
-			*tp = mng_.expire_time();
-			return  kOperationDefer;
-		}
-		OpResult read_op(uint32_t op_id/*IN*/, std::time_t* tp/*OUT*/) override {
-			mng_.set_op_id(op_id);
-			mng_.set_cache_state(CacheState::kCacheGuaranteed);
-			*tp = mng_.expire_time();
-			return kOperationOk;
-		}
-		void enter_state() override {
-			mng_.start_expire([this]() {
-				mng_.set_cache_state(CacheState::kCacheIdle); },
-				kDefaultExpireMillisecond);
-		}
-	};
-	class CacheUpdateProtectedState :public CacheStateInterface {
-	public:
-		CacheUpdateProtectedState(CacheStateManager& mng) :CacheStateInterface(mng) {}
-		OpResult update_op(uint32_t op_id/*IN*/, UpdateCallHandler f/*IN*/, std::time_t* tp/*OUT*/) override {
+			//updater dropped its own copy before asking
+			if (peer != kNoPeer)
+				lease.holders.erase(std::remove_if(lease.holders.begin(), lease.holders.end(),
+					[peer](const typename CacheLease<T>::LeaseHolder& holder) { return holder.peer == peer; }), lease.holders.end());
+			drop_lapsed(lease, get_time_stamp());
+			//read then write by the only live holder,no copy left to wait for
+			if (lease.holders.empty()) {
+				commit_value(lease, queue, std::forward<U>(value), peer);
+				*tp = lease.expire;
+				return kOperationOk;
+			}
+			lease.pending.reset(new typename CacheLease<T>::PendingUpdate{ std::forward<U>(value), op_id, std::move(f),
+				peer, invalidate_id, 0 });
+			if (holders && invalidate_id) {
+				lease.pending->outstanding = (uint32_t)lease.holders.size();
+				holders->clear();
+				for (const typename CacheLease<T>::LeaseHolder& holder : lease.holders)
+					holders->push_back(holder.peer);
+			}
+			enter_update_protected(lease, queue);
+			*tp = lease.expire;
+			return kOperationDefer;
+		default:
 			if (!op_id)
 				throw Exception(Exception::kErrorIllArgument, "CacheUpdateProtectedState update_op with error argument");
-			*tp = mng_.expire_time();
+			*tp = lease.expire;
 			return kOperationRetry;
 		}
-		OpResult read_op(uint32_t op_id/*IN*/, std::time_t* tp/*OUT*/) override {
-			*tp = get_time_stamp();
-			return kOperationOk;
+	}
+	//a holder dropped its copy,the last one commits the pending value right away
+	template <typename T>
+	static void invalidate_acked(CacheLease<T>& lease, TimerQueue* queue, uint64_t invalidate_id) {
+		if (lease.state != CacheState::kCacheUpdateProtected || !lease.pending
+			|| lease.pending->invalidate_id != invalidate_id || !lease.pending->outstanding)
+			return;
+		if (--lease.pending->outstanding == 0)
+			commit_pending(lease, queue);
+	}
+	template <typename T>
+	static void stop_expire(CacheLease<T>& lease, TimerQueue* queue) {
+		if (lease.timer_id) {
+			queue->del_timer(lease.timer_id);
+			lease.timer_id = 0;
 		}
-		void enter_state() override {
-			int32_t  timer_delay = mng_.expire_time() - get_time_stamp();
-			if (unlikely(timer_delay <= 0))
-				throw Exception(Exception::kErrorSysRoutine, "timer is expire,should not run here");
-
-			auto function = [this]() {
-				mng_.set_cache_state(CacheState::kCacheGuaranteed);
-				(mng_.get_call_handle())(kOperationOk, mng_.op_id(), mng_.expire_time());
-			};
-			mng_.start_expire(std::move(function), (uint32_t)timer_delay);
+	}
+private:
+	//peer holds the lease until it ends now
+	template <typename T>
+	static void hold(CacheLease<T>& lease, PeerId peer) {
+		for (typename CacheLease<T>::LeaseHolder& holder : lease.holders) {
+			if (holder.peer == peer) {
+				holder.expire = lease.expire;
+				return;
+			}
 		}
-	};
-public:
-	explicit CacheStateManager() :timer_id_{},expire_time_ {}, op_id_{}, callhandle_{}, 
-		current_state_(CacheState::kCacheIdle),
-		states_{std::make_shared<CacheIdleState>(*this),
-		std::make_shared<CacheGuaranteedState>(*this),
-		std::make_shared<CacheUpdateProtectedState>(*this)}
-	{
+		lease.holders.push_back(typename CacheLease<T>::LeaseHolder{ peer, lease.expire });
 	}
-	~CacheStateManager() { stop_expire(); }
-	template <typename Function, typename ClassType>
-	OpResult update_op(const Function& f/*IN*/, ClassType* t, uint32_t op_id/*IN*/, std::time_t* tp/*OUT*/) {
-		using namespace std::placeholders;
-		return cache_state()->update_op(op_id, std::bind(f, t, _1, _2, _3), tp);
+	//holders whose lease ended by now rely on nothing
+	template <typename T>
+	static void drop_lapsed(CacheLease<T>& lease, std::time_t now) {
+		lease.holders.erase(std::remove_if(lease.holders.begin(), lease.holders.end(),
+			[now](const typename CacheLease<T>::LeaseHolder& holder) { return holder.expire <= now; }), lease.holders.end());
 	}
-	template <typename Function>
-	OpResult update_op(Function f/*IN*/, uint32_t op_id/*IN*/, std::time_t* tp/*OUT*/) {
-		return cache_state()->update_op(op_id, f, tp);
+	template <typename T>
+	static void enter_idle(CacheLease<T>& lease) {
+		lease.timer_id = 0;
+		lease.expire = 0;
+		lease.holders.clear();
+		lease.state = CacheState::kCacheIdle;
 	}
-
-	OpResult read_op(uint32_t op_id/*IN*/, std::time_t* tp/*OUT*/) {
-		return cache_state()->read_op(op_id, tp);
+	template <typename T>
+	static void enter_guaranteed(CacheLease<T>& lease, TimerQueue* queue) {
+		//lease and queue only,callback stays in std::function inline storage
+		start_expire(lease, queue, [&lease]() { enter_idle(lease); }, kDefaultExpireMillisecond);
+		lease.state = CacheState::kCacheGuaranteed;
 	}
-	std::shared_ptr<CacheStateInterface> cache_state()  noexcept {
-		return states_[static_cast<uint32_t>(current_state_)]->shared_from_this();
+	template <typename T>
+	static void enter_update_protected(CacheLease<T>& lease, TimerQueue* queue) {
+		int64_t timer_delay = (int64_t)lease.expire - (int64_t)get_time_stamp();
+		//lease over but its timer not ticked yet,commit on next tick
+		if (unlikely(timer_delay <= 0))
+			timer_delay = 1;
+		std::time_t expire = lease.expire;
+		start_expire(lease, queue, [&lease, queue]() {
+			lease.timer_id = 0;
+			commit_pending(lease, queue); }, (uint32_t)timer_delay);
+		//pending update doesn't extend the lease readers hold
+		lease.expire = expire;
+		lease.state = CacheState::kCacheUpdateProtected;
 	}
-	void set_cache_state(CacheState state){
-		states_[static_cast<uint32_t>(state)]->enter_state();
-		current_state_ = state;
+	//value takes place,guaranteed to its updater from now on
+	template <typename T, typename U>
+	static void commit_value(CacheLease<T>& lease, TimerQueue* queue, U&& value, PeerId peer) {
+		lease.value = std::forward<U>(value);
+		lease.version = std::max<uint64_t>(lease.version + 1, (uint64_t)get_time_stamp() << kVersionClockShift);
+		enter_guaranteed(lease, queue);
+		lease.holders.assign(1, typename CacheLease<T>::LeaseHolder{ peer, lease.expire });
 	}
-
-	size_t timer_id() { return timer_id_; }
-	void   set_timer_id(size_t timer_id) { timer_id_ = timer_id; }
-
-	std::time_t	 expire_time() { return expire_time_; }
-	void   set_expire_time(size_t expire_time) { expire_time_ = expire_time; }
-
-	uint32_t op_id() { return op_id_; }
-	void   set_op_id(uint32_t op_id) { op_id_ = op_id; }
-
-	UpdateCallHandler& get_call_handle() { return callhandle_; }
-	void   set_call_handle(UpdateCallHandler call_handle) { callhandle_ = call_handle; }
-
-	void start_expire(TimerQueue::TimerCallHandler&& call_back, uint32_t timeout_ms) {
-		stop_expire();
-		expire_time_ = get_time_stamp(timeout_ms);
-		timer_id_ = TimerQueue::get_timer_queue()->add_timer(std::move(call_back), timeout_ms, 1);
+	//lease ended,pending value takes place and is guaranteed from now on
+	template <typename T>
+	static void commit_pending(CacheLease<T>& lease, TimerQueue* queue) {
+		std::unique_ptr<typename CacheLease<T>::PendingUpdate> pending = std::move(lease.pending);
+		commit_value(lease, queue, std::move(pending->value), pending->peer);
+		pending->call(kOperationOk, pending->op_id, lease.expire);
 	}
-	void stop_expire() {
-		if (timer_id_ && expire_time_ > get_time_stamp()) {
-			TimerQueue::get_timer_queue()->del_timer(timer_id_);
-			timer_id_ = 0;
-		}
+	template <typename T>
+	static void start_expire(CacheLease<T>& lease, TimerQueue* queue,
+		TimerQueue::TimerCallHandler&& call_back, uint32_t timeout_ms) {
+		stop_expire(lease, queue);
+		lease.expire = get_time_stamp(timeout_ms);
+		lease.timer_id = queue->add_timer(std::move(call_back), timeout_ms, 1);
 	}
-private:
-	size_t									timer_id_;
-	std::time_t								expire_time_;
-	uint32_t								op_id_;
-	UpdateCallHandler						callhandle_;
-	CacheState							    current_state_;
-	std::array<std::shared_ptr<CacheStateInterface>, static_cast<uint32_t>(CacheState::kCacheStateCount)> states_;
 };
 CACHE_NAMESPACE_END
\ No newline at end of file
@@ -0,0 +1,371 @@
+/*
+ * cache_wal.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: rynzen <chuanrui123@126.com>
+ *
+ *  This file is part of a cache system of lease mechanism implemenation.
+ *
+ *  cache_wal.h is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  cache_wal.h is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with consistent_hashing.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <vector>
+#include <string>
+#include <string_view>
+#include <memory>
+#include <algorithm>
+#include <filesystem>
+#include <cstdio>
+#include <cstring>
+#include <cinttypes>
+#include "common.h"
+#include "cache_data_center.h"
+#include "cache_state_manager.h"
+
+#if defined(OS_LINUX)
+#include <unistd.h>
+#endif
+
+CACHE_NAMESPACE_BEGIN
+enum class CacheWalSync :uint8_t {
+	//written to the page cache,survives a crash of the process,not of the host
+	kWalSyncNone = 0,
+	//every group fsynced before the next one is written
+	kWalSyncGroup,
+};
+struct CacheWalOptions {
+	CacheWalSync sync = CacheWalSync::kWalSyncGroup;
+	//a group is written once this old or this big,whichever comes first
+	uint32_t	 group_window_ms = 2;
+	size_t		 group_bytes = 256 * 1024;
+};
+struct CacheWalStats {
+	uint64_t records;
+	uint64_t bytes;
+	//groups written
+	uint64_t groups;
+	uint64_t syncs;
+};
+
+//
+// append only log of the values a CacheDataCenter<std::string> commits,attached
+// as its commit listener. on_commit() copies the record into the open group under
+// a mutex and returns,an I/O thread of its own writes and fsyncs whole groups,
+// so an event loop never waits on the disk. responses don't wait for the group
+// either: a crash loses at most the group being written.
+// the log is a row of segments path.<16 hex digits>,each start() opens a new one.
+// snapshots bound it: rotate() before a snapshot starts,drop_before() the
+// returned segment once it is saved,every record dropped is in the snapshot.
+// record,host byte order: checksum:u32 size:u32 cache_id:u64 version:u64 bytes,
+// checksum covers the rest,replay stops a segment at a torn record.
+// Example:
+//		std::shared_ptr<CacheWal> wal = std::make_shared<CacheWal>("/var/lib/cache/wal");
+//		CacheWal::replay(*center, "/var/lib/cache/wal");
+//		center->add_commit_listener(wal);
+//		wal->start();
+class CacheWal :public CacheCommitListener<std::string> {
+	enum CacheWalFormat {
+		//checksum,size,cache_id,version
+		kRecordHeaderSize = 4 + 4 + 8 + 8,
+		kSegmentDigits = 16,
+		//read by replay at a time
+		kReplayChunk = 1 << 20,
+	};
+	//records of one segment waiting for the I/O thread
+	struct WalGroup {
+		uint64_t	segment;
+		std::string bytes;
+	};
+public:
+	using CenterType = CacheDataCenter<std::string>;
+	explicit CacheWal(std::string path, CacheWalOptions options = CacheWalOptions()) :
+		path_(std::move(path)), options_(options), thread_(), mutex_(), cond_(), running_(false),
+		segment_(0), first_segment_(0), open_(), sealed_(), stats_{} {}
+	CacheWal(const CacheWal&) = delete;
+	CacheWal& operator=(const CacheWal&) = delete;
+	~CacheWal() {
+		stop();
+	}
+	//records go to a new segment after the ones on disk
+	void start() {
+		std::vector<uint64_t> segments = list_segments(path_);
+		std::lock_guard<std::mutex> lock(mutex_);
+		if (running_)
+			throw Exception(Exception::kErrorIllUsage, "CacheWal already started");
+		segment_ = segments.empty() ? 1 : segments.back() + 1;
+		first_segment_ = segments.empty() ? segment_ : segments.front();
+		running_ = true;
+		thread_ = std::thread(&CacheWal::run, this);
+	}
+	//what is buffered is written first
+	void stop() {
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			if (!running_)
+				return;
+			running_ = false;
+		}
+		cond_.notify_all();
+		thread_.join();
+	}
+	void on_commit(uint64_t cache_id, uint64_t version, const SlabString& value) override {
+		bool full = false;
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			append_record(&open_, cache_id, version, value.view());
+			full = open_.size() >= options_.group_bytes;
+		}
+		if (full)
+			cond_.notify_one();
+	}
+	//return: segment records go to from now on
+	uint64_t rotate() {
+		std::lock_guard<std::mutex> lock(mutex_);
+		sealed_.push_back(WalGroup{ segment_, std::string() });
+		sealed_.back().bytes.swap(open_);
+		return ++segment_;
+	}
+	//remove segments before segment,their records are saved elsewhere
+	void drop_before(uint64_t segment) {
+		uint64_t first = 0;
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			first = first_segment_;
+			first_segment_ = std::max(first_segment_, segment);
+		}
+		for (uint64_t i = first; i < segment; ++i) {
+			std::error_code ec;
+			std::filesystem::remove(segment_path(path_, i), ec);
+		}
+	}
+	CacheWalStats stats() {
+		std::lock_guard<std::mutex> lock(mutex_);
+		return stats_;
+	}
+	//apply every record of the log at path to center,before it serves anybody.
+	//threads each read the whole log and apply the keys of their shards,so the
+	//records of a key are applied in order. load a snapshot first,if any,
+	//records no newer than the value it restored are skipped.
+	//return: records read
+	static uint64_t replay(CenterType& center, const std::string& path, uint32_t threads = 0) {
+		std::vector<uint64_t> segments = list_segments(path);
+		if (!threads)
+			threads = std::max<uint32_t>(std::thread::hardware_concurrency(), 1);
+		threads = (uint32_t)std::min<size_t>(threads, center.shard_count());
+		std::atomic<uint64_t> applied(0);
+		auto replay_part = [&](uint32_t part) {
+			uint64_t count = 0;
+			for (uint64_t segment : segments)
+				count += replay_segment(center, segment_path(path, segment), part, threads);
+			applied += count;
+		};
+		std::vector<std::thread> workers;
+		for (uint32_t i = 1; i < threads; ++i)
+			workers.emplace_back(replay_part, i);
+		replay_part(0);
+		for (std::thread& worker : workers)
+			worker.join();
+		if (!segments.empty())
+			center.fence_writes(get_time_stamp(kDefaultExpireMillisecond));
+		return applied;
+	}
+private:
+	void run() {
+		FILE* file = nullptr;
+		uint64_t file_segment = 0;
+		std::string bytes;
+		std::unique_lock<std::mutex> lock(mutex_);
+		while (true) {
+			cond_.wait_for(lock, std::chrono::milliseconds(options_.group_window_ms), [this]() {
+				return !running_ || !sealed_.empty() || open_.size() >= options_.group_bytes; });
+			WalGroup group{ segment_, std::string() };
+			if (!sealed_.empty()) {
+				group = std::move(sealed_.front());
+				sealed_.pop_front();
+			}
+			else {
+				if (open_.empty()) {
+					if (!running_)
+						break;
+					continue;
+				}
+				//buffers are swapped back and forth,no allocation once warmed up
+				group.bytes.swap(bytes);
+				group.bytes.swap(open_);
+			}
+			bool dropped = group.segment < first_segment_;
+			lock.unlock();
+			if (!dropped) {
+				if (group.segment != file_segment) {
+					close_segment(file);
+					file = open_segment(group.segment);
+					file_segment = group.segment;
+				}
+				write_group(file, group.bytes);
+			}
+			lock.lock();
+			++stats_.groups;
+			stats_.bytes += group.bytes.size();
+			if (!dropped && options_.sync == CacheWalSync::kWalSyncGroup)
+				++stats_.syncs;
+			group.bytes.clear();
+			if (bytes.capacity() < group.bytes.capacity())
+				bytes.swap(group.bytes);
+		}
+		lock.unlock();
+		close_segment(file);
+	}
+	FILE* open_segment(uint64_t segment) {
+		std::string path = segment_path(path_, segment);
+		FILE* file = std::fopen(path.c_str(), "ab");
+		if (!file)
+			LOG_OUT("open wal segment %s failure", path.c_str());
+		return file;
+	}
+	void close_segment(FILE* file) {
+		if (file)
+			std::fclose(file);
+	}
+	void write_group(FILE* file, const std::string& bytes) {
+		if (unlikely(!file))
+			return;
+		if (std::fwrite(bytes.data(), 1, bytes.size(), file) != bytes.size() || std::fflush(file) != 0) {
+			LOG_OUT("write wal group of %zu bytes failure", bytes.size());
+			return;
+		}
+#if defined(OS_LINUX)
+		if (options_.sync == CacheWalSync::kWalSyncGroup && ::fdatasync(::fileno(file)) != 0)
+			LOG_OUT("fdatasync wal failure");
+#endif
+	}
+	static uint32_t checksum(const char* data, size_t size, uint32_t hash = 2166136261u) {
+		//FNV-1a
+		for (size_t i = 0; i < size; ++i)
+			hash = (hash ^ (uint8_t)data[i]) * 16777619u;
+		return hash;
+	}
+	//caller holds mutex_,counts the record
+	void append_record(std::string* buffer, uint64_t cache_id, uint64_t version, std::string_view value) {
+		uint32_t size = (uint32_t)value.size();
+		size_t at = buffer->size();
+		buffer->resize(at + kRecordHeaderSize + size);
+		char* p = &(*buffer)[at];
+		std::memcpy(p + 4, &size, 4);
+		std::memcpy(p + 8, &cache_id, 8);
+		std::memcpy(p + 16, &version, 8);
+		if (size)
+			std::memcpy(p + kRecordHeaderSize, value.data(), size);
+		uint32_t sum = checksum(p + 4, kRecordHeaderSize - 4 + size);
+		std::memcpy(p, &sum, 4);
+		++stats_.records;
+	}
+	//return: records of part read,stale ones included
+	static uint64_t replay_segment(CenterType& center, const std::string& path, uint32_t part, uint32_t parts) {
+		std::unique_ptr<FILE, int(*)(FILE*)> file(std::fopen(path.c_str(), "rb"), &std::fclose);
+		if (!file)
+			return 0;
+		uint64_t count = 0;
+		std::vector<char> buffer(kReplayChunk);
+		size_t filled = 0;
+		bool eof = false;
+		while (!eof || filled) {
+			if (!eof) {
+				size_t got = std::fread(buffer.data() + filled, 1, buffer.size() - filled, file.get());
+				filled += got;
+				eof = filled < buffer.size();
+			}
+			size_t used = 0;
+			while (filled - used >= kRecordHeaderSize) {
+				const char* p = buffer.data() + used;
+				uint32_t sum, size;
+				uint64_t cache_id, version;
+				std::memcpy(&sum, p, 4);
+				std::memcpy(&size, p + 4, 4);
+				if (filled - used - kRecordHeaderSize < size)
+					break;
+				if (sum != checksum(p + 4, kRecordHeaderSize - 4 + size)) {
+					if (part == 0)
+						LOG_OUT("wal %s torn at a record,rest of it skipped", path.c_str());
+					return count;
+				}
+				std::memcpy(&cache_id, p + 8, 8);
+				std::memcpy(&version, p + 16, 8);
+				//a record no newer than what the snapshot or an earlier one restored is stale
+				if (center.shard_index(cache_id) % parts == part) {
+					center.restore(cache_id, version, std::string_view(p + kRecordHeaderSize, size), true);
+					++count;
+				}
+				used += kRecordHeaderSize + size;
+			}
+			if (!used) {
+				if (eof) {
+					if (filled && part == 0)
+						LOG_OUT("wal %s ends in a partial record", path.c_str());
+					return count;
+				}
+				//record bigger than the buffer
+				if (filled == buffer.size())
+					buffer.resize(buffer.size() * 2);
+				continue;
+			}
+			std::memmove(buffer.data(), buffer.data() + used, filled - used);
+			filled -= used;
+		}
+		return count;
+	}
+	static std::string segment_path(const std::string& path, uint64_t segment) {
+		char suffix[kSegmentDigits + 2];
+		std::snprintf(suffix, sizeof(suffix), ".%016" PRIx64, segment);
+		return path + suffix;
+	}
+	//return: segments on disk,oldest first
+	static std::vector<uint64_t> list_segments(const std::string& path) {
+		namespace fs = std::filesystem;
+		std::vector<uint64_t> segments;
+		fs::path base(path);
+		fs::path dir = base.has_parent_path() ? base.parent_path() : fs::path(".");
+		std::string prefix = base.filename().string() + ".";
+		std::error_code ec;
+		for (fs::directory_iterator it(dir, ec), end; !ec && it != end; it.increment(ec)) {
+			std::string name = it->path().filename().string();
+			if (name.size() != prefix.size() + kSegmentDigits || name.compare(0, prefix.size(), prefix) != 0
+				|| name.find_first_not_of("0123456789abcdef", prefix.size()) != std::string::npos)
+				continue;
+			segments.push_back(std::stoull(name.substr(prefix.size()), nullptr, 16));
+		}
+		std::sort(segments.begin(), segments.end());
+		return segments;
+	}
+	std::string				path_;
+	CacheWalOptions			options_;
+	std::thread				thread_;
+	std::mutex				mutex_;
+	std::condition_variable cond_;
+	bool					running_;
+	//segment open_ goes to
+	uint64_t				segment_;
+	//segments before it are dropped
+	uint64_t				first_segment_;
+	//group being filled
+	std::string				open_;
+	//groups of segments rotated away,not written yet
+	std::deque<WalGroup>	sealed_;
+	CacheWalStats			stats_;
+};
+CACHE_NAMESPACE_END
@@ -0,0 +1,230 @@
+/*
+ * cluster_client.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: rynzen <chuanrui123@126.com>
+ *
+ *  This file is part of a cache system of lease mechanism implemenation.
+ *
+ *  cluster_client.h is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  cluster_client.h is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with consistent_hashing.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <unordered_map>
+#include <stdint.h>
+#include "common.h"
+#include "socket_group.h"
+#include "protobuf_message_client_impl.h"
+
+CACHE_NAMESPACE_BEGIN
+struct ClusterServerStats {
+	std::string name;
+	//operations sent and not yet answered
+	uint64_t	outstanding;
+	//operations routed to the server so far
+	uint64_t	routed;
+	//removed from the ring,kept until outstanding drops to 0
+	bool		draining;
+};
+
+//
+// one client over many servers,each cache_id goes to the server owning it on a
+// consistent hash ring. every server sits on the ring at kDefaultVirtualNodes
+// points,a key belongs to the first point clockwise of its hash,so adding or
+// removing one of N servers moves only ~1/N of the keys and spreads them
+// evenly over the others. a removed server keeps its connection until the
+// operations sent to it are answered or time out. not threadsafe,driven by
+// the thread listening on group,which ticks its TimerQueue.
+template <class SocketGroupImplType>
+class ClusterClient {
+	using SocketType=typename SocketGroupImplType::SocketType;
+	using ClientType=MessageClient<SocketType>;
+public:
+	using CallbackHandleType=MessageClientImpl::CallbackHandleType;
+	using CacheItems=MessageClientImpl::CacheItems;
+	enum ClusterClientDefault {
+		//keeps the load of each server within a few percent of 1/N
+		kDefaultVirtualNodes = 160,
+	};
+	ClusterClient(SocketGroup<SocketGroupImplType>& group, uint8_t datacenter_id, uint8_t worker_id,
+		uint32_t virtual_nodes = kDefaultVirtualNodes) :group_(group), datacenter_id_(datacenter_id),
+		worker_id_(worker_id), virtual_nodes_(std::max<uint32_t>(virtual_nodes, 1)),
+		operation_timeout_(ProtobufMessageClientImpl::kDefaultOperationTimeout), servers_(), draining_(), ring_() {}
+	ClusterClient(const ClusterClient&) = delete;
+	ClusterClient& operator=(const ClusterClient&) = delete;
+	~ClusterClient() {
+		for (auto& server : servers_)
+			group_.unregister_socket(server.second->client);
+		for (auto& server : draining_)
+			group_.unregister_socket(server->client);
+	}
+	//connect to a server and give it its share of the ring,local_port 0 picks any
+	void add_server(const std::string& host, uint16_t port, const std::string& local_host = "*", uint16_t local_port = 0) {
+		reap_drained();
+		std::string name = server_name(host, port);
+		if (servers_.count(name))
+			throw csn::Exception(csn::Exception::kErrorIllUsage, "server already in cluster " + name);
+		std::unique_ptr<ServerEntry> server(new ServerEntry());
+		server->name = name;
+		server->impl = std::make_shared<ProtobufMessageClientImpl>(datacenter_id_, worker_id_);
+		server->impl->set_operation_timeout(operation_timeout_);
+		server->client = std::make_shared<ClientType>();
+		server->client->set_message_impl(server->impl);
+		server->client->initialize(local_host, local_port, host, port);
+		group_.register_socket(server->client);
+		servers_.emplace(name, std::move(server));
+		rebuild_ring();
+	}
+	//keys of the server move to the others,operations on the way still complete,
+	//the connection closes on a later add/remove once they did.
+	//add/remove are not to be called from a callback
+	void remove_server(const std::string& host, uint16_t port) {
+		auto it = servers_.find(server_name(host, port));
+		if (it == servers_.end())
+			throw csn::Exception(csn::Exception::kErrorIllUsage, "server not in cluster " + server_name(host, port));
+		it->second->draining = true;
+		draining_.push_back(std::move(it->second));
+		servers_.erase(it);
+		rebuild_ring();
+		reap_drained();
+	}
+	void read_cache_async(uint32_t cache_id, CallbackHandleType handle) {
+		ServerEntry* server = route(cache_id);
+		server->client->read_cache_async(cache_id, track(server, 1, std::move(handle)));
+	}
+	void update_cache_async(uint32_t cache_id, CacheDataType cache_data, CallbackHandleType handle) {
+		ServerEntry* server = route(cache_id);
+		server->client->update_cache_async(cache_id, std::move(cache_data), track(server, 1, std::move(handle)));
+	}
+	//keys are split by server,each server gets its part in as few datagrams as fit
+	void read_many_async(const std::vector<uint32_t>& cache_ids, CallbackHandleType handle) {
+		std::unordered_map<ServerEntry*, std::vector<uint32_t>> parts{};
+		for (uint32_t cache_id : cache_ids)
+			parts[route(cache_id)].push_back(cache_id);
+		for (auto& part : parts)
+			part.first->client->read_many_async(part.second, track(part.first, part.second.size(), handle));
+	}
+	void update_many_async(CacheItems items, CallbackHandleType handle) {
+		std::unordered_map<ServerEntry*, CacheItems> parts{};
+		for (auto& item : items)
+			parts[route(item.first)].push_back(std::move(item));
+		for (auto& part : parts) {
+			size_t count = part.second.size();
+			part.first->client->update_many_async(std::move(part.second), track(part.first, count, handle));
+		}
+	}
+	//deadline of operations started from now on,on every server
+	void set_operation_timeout(uint32_t timeout_ms) {
+		operation_timeout_ = timeout_ms;
+		for (auto& server : servers_)
+			server.second->impl->set_operation_timeout(timeout_ms);
+	}
+	//"host:port" of the server owning cache_id
+	const std::string& server_of(uint32_t cache_id) const {
+		return route(cache_id)->name;
+	}
+	size_t server_count() const { return servers_.size(); }
+	std::vector<ClusterServerStats> stats() const {
+		std::vector<ClusterServerStats> stats{};
+		for (auto& server : servers_)
+			stats.push_back({ server.first, server.second->outstanding, server.second->routed, false });
+		for (auto& server : draining_)
+			stats.push_back({ server->name, server->outstanding, server->routed, true });
+		return stats;
+	}
+private:
+	struct ServerEntry {
+		std::string									name;
+		std::shared_ptr<ProtobufMessageClientImpl>	impl;
+		std::shared_ptr<ClientType>					client;
+		uint64_t									outstanding = 0;
+		uint64_t									routed = 0;
+		bool										draining = false;
+	};
+	struct RingPoint {
+		uint64_t	 hash;
+		ServerEntry* server;
+		bool operator<(const RingPoint& other) const { return hash < other.hash; }
+	};
+	static std::string server_name(const std::string& host, uint16_t port) {
+		return host + ":" + std::to_string(port);
+	}
+	//splitmix64 finalizer,spreads neighbouring ids all over the ring
+	static uint64_t mix(uint64_t value) {
+		value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+		value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+		return value ^ (value >> 31);
+	}
+	//fnv-1a over "host:port" then the point index,same points on every client
+	static uint64_t point_hash(const std::string& name, uint32_t index) {
+		uint64_t hash = 14695981039346656037ULL;
+		for (char c : name)
+			hash = (hash ^ (uint8_t)c) * 1099511628211ULL;
+		return mix(hash ^ index);
+	}
+	void rebuild_ring() {
+		ring_.clear();
+		ring_.reserve(servers_.size() * virtual_nodes_);
+		for (auto& server : servers_) {
+			for (uint32_t i = 0; i < virtual_nodes_; ++i)
+				ring_.push_back({ point_hash(server.first, i), server.second.get() });
+		}
+		std::sort(ring_.begin(), ring_.end());
+	}
+	ServerEntry* route(uint32_t cache_id) const {
+		if (unlikely(ring_.empty()))
+			throw csn::Exception(csn::Exception::kErrorIllUsage, "cluster has no server");
+		RingPoint key{ mix(cache_id), nullptr };
+		auto it = std::lower_bound(ring_.begin(), ring_.end(), key);
+		return it == ring_.end() ? ring_.front().server : it->server;
+	}
+	//count results expected from server,handle is called once per key
+	CallbackHandleType track(ServerEntry* server, size_t count, CallbackHandleType handle) {
+		server->outstanding += count;
+		server->routed += count;
+		return [server, handle = std::move(handle)](csn::OpResult result, std::time_t expire,
+			uint32_t cache_id, CacheDataType cache_data) {
+			if (likely(server->outstanding))
+				--server->outstanding;
+			handle(result, expire, cache_id, std::move(cache_data));
+		};
+	}
+	//close removed servers with nothing on the way,only from add/remove so a
+	//socket is never closed while it receives or holds acks not flushed yet
+	void reap_drained() {
+		for (auto it = draining_.begin(); it != draining_.end();) {
+			if ((*it)->outstanding) {
+				++it;
+				continue;
+			}
+			group_.unregister_socket((*it)->client);
+			it = draining_.erase(it);
+		}
+	}
+	SocketGroup<SocketGroupImplType>&						group_;
+	uint8_t													datacenter_id_;
+	uint8_t													worker_id_;
+	uint32_t												virtual_nodes_;
+	uint32_t												operation_timeout_;
+	std::map<std::string, std::unique_ptr<ServerEntry>>		servers_;
+	std::vector<std::unique_ptr<ServerEntry>>				draining_;
+	//sorted by hash
+	std::vector<RingPoint>									ring_;
+};
+CACHE_NAMESPACE_END
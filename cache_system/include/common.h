@@ -45,7 +45,11 @@ enum OpResult {
 	kOperationRetry,
 	kOperationErrorArgument,
 	kOperationErrorNoData,
+	kOperationTimeout, //no response before the operation deadline
 };
+//identify a client of a socket,kNoPeer when the socket doesn't tell clients apart
+using PeerId=uint32_t;
+const PeerId kNoPeer = 0;
 
 class Exception {
 public:
@@ -89,14 +93,14 @@ extern int write_log(const char* file_path, const char* func_name, const int lin
 
 CACHE_NAMESPACE_END
 
+#include "async_log.h"
 #if defined(OS_WINDOWS)
-#define LOG_OUT(fmt,...)  do{ \
-	csn::write_log(__FILE__,__FUNCTION__, __LINE__, fmt"\r\n",__VA_ARGS__); \
-}while(0)
+#define LOG_OUT(fmt,...)	LOG_AT(csn::kLogInfo, fmt, __VA_ARGS__)
+#define LOG_DEBUG(fmt,...)	LOG_AT(csn::kLogDebug, fmt, __VA_ARGS__)
 #else
-#define LOG_OUT(fmt, args ...)  do{ \
-	csn::write_log(__FILE__,__FUNCTION__, __LINE__, fmt"\r\n", ##args); \
-}while(0)
+#define LOG_OUT(fmt, args ...)		LOG_AT(csn::kLogInfo, fmt, ##args)
+//packet tracing,off unless AsyncLogger::set_level(kLogDebug)
+#define LOG_DEBUG(fmt, args ...)	LOG_AT(csn::kLogDebug, fmt, ##args)
 #endif
 
 #include <exception>
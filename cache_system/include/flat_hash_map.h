@@ -0,0 +1,265 @@
+/*
+ * flat_hash_map.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: rynzen <chuanrui123@126.com>
+ *
+ *  This file is part of a cache system of lease mechanism implemenation.
+ *
+ *  flat_hash_map.h is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  flat_hash_map.h is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with consistent_hashing.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+#include <memory>
+#include <vector>
+#include <utility>
+#include <new>
+#include <cstring>
+#include <stdint.h>
+#include "common.h"
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+CACHE_NAMESPACE_BEGIN
+//
+// open addressing index in swiss table style,sized to the cache line: a group
+// is 7 one byte tags(7 bits of the hash),an overflow count and 7 pointers,64
+// bytes in all. tags of a group are matched at once as one 8 byte word,a hit
+// costs the group line and the node line,no more.
+// nodes(key and element) sit in fixed size slab chunks and never move,so a
+// rehash only rebuilds the groups and pointers to elements stay valid.
+// overflow counts keys that probed past a group,a lookup stops at the first
+// group with none,an erase just clears the tag,no tombstones.
+// keyed by uint64_t,T is default constructed by try_emplace.
+template <typename T>
+class FlatHashMap {
+	enum FlatMapLayout {
+		kGroupSlots = 7,
+		kMinGroups = 1,
+		//nodes per slab chunk
+		kSlabChunk = 256,
+		kOverflowSaturated = 0xFF,
+	};
+	struct Node {
+		uint64_t key;
+		T		 value;
+	};
+	struct alignas(64) Group {
+		//0 empty,0x80|h2 full
+		uint8_t tags[kGroupSlots];
+		uint8_t overflow;
+		Node*	nodes[kGroupSlots];
+	};
+	static_assert(sizeof(Group) == 64 || sizeof(void*) != 8, "group should fill one cache line");
+	//node storage,chunks are kept until the map goes
+	class Slab {
+	public:
+		Slab() :chunks_(), free_(), used_(0) {}
+		~Slab() = default;
+		Node* allocate(uint64_t key) {
+			void* place = nullptr;
+			if (!free_.empty()) {
+				place = free_.back();
+				free_.pop_back();
+			}
+			else {
+				if (used_ == chunks_.size() * kSlabChunk)
+					chunks_.emplace_back(new Storage[kSlabChunk]);
+				place = &chunks_[used_ / kSlabChunk][used_ % kSlabChunk];
+				++used_;
+			}
+			return new (place) Node{ key, T() };
+		}
+		void release(Node* node) {
+			node->~Node();
+			free_.push_back(node);
+		}
+		size_t bytes() const {
+			return chunks_.size() * kSlabChunk * sizeof(Storage) + free_.capacity() * sizeof(void*);
+		}
+	private:
+		struct Storage {
+			alignas(Node) unsigned char bytes[sizeof(Node)];
+		};
+		std::vector<std::unique_ptr<Storage[]>> chunks_;
+		std::vector<void*>						free_;
+		//nodes handed out of chunks so far
+		size_t									used_;
+	};
+public:
+	FlatHashMap() :groups_(), group_count_(0), size_(0), slab_() {}
+	FlatHashMap(const FlatHashMap&) = delete;
+	FlatHashMap& operator=(const FlatHashMap&) = delete;
+	~FlatHashMap() {
+		for_each_node([](Node* node) { node->~Node(); });
+	}
+	//return: nullptr when key is absent
+	T* find(uint64_t key) {
+		if (unlikely(!group_count_))
+			return nullptr;
+		size_t slot = 0;
+		Group* group = find_group(key, hash(key), &slot);
+		return group ? &group->nodes[slot]->value : nullptr;
+	}
+	//return: element of key,true when it was just created
+	std::pair<T*, bool> try_emplace(uint64_t key) {
+		uint64_t h = hash(key);
+		if (likely(group_count_)) {
+			size_t slot = 0;
+			if (Group* group = find_group(key, h, &slot))
+				return { &group->nodes[slot]->value, false };
+		}
+		//at most 6 of 7 slots used on average
+		if (unlikely((size_ + 1) * kGroupSlots > group_count_ * (kGroupSlots - 1) * kGroupSlots))
+			rehash(std::max<size_t>(group_count_ * 2, kMinGroups));
+		Node* node = slab_.allocate(key);
+		place(node, h);
+		++size_;
+		return { &node->value, true };
+	}
+	//element is destroyed,pointers to it dangle
+	bool erase(uint64_t key) {
+		if (unlikely(!group_count_))
+			return false;
+		uint64_t h = hash(key);
+		size_t slot = 0;
+		Group* found = find_group(key, h, &slot);
+		if (!found)
+			return false;
+		//groups probed past on the way to found overflowed on its account
+		size_t mask = group_count_ - 1;
+		size_t index = h1(h) & mask;
+		for (size_t step = 1; &groups_[index] != found; ++step) {
+			if (groups_[index].overflow != kOverflowSaturated)
+				--groups_[index].overflow;
+			index = (index + step) & mask;
+		}
+		slab_.release(found->nodes[slot]);
+		found->tags[slot] = 0;
+		found->nodes[slot] = nullptr;
+		--size_;
+		return true;
+	}
+	//f(uint64_t key,T& element),must not insert or erase
+	template <typename F>
+	void for_each(F&& f) {
+		for_each_node([&f](Node* node) { f(node->key, node->value); });
+	}
+	size_t size() const { return size_; }
+	bool empty() const { return size_ == 0; }
+	size_t capacity() const { return group_count_ * kGroupSlots; }
+	//index and node storage together
+	size_t memory_bytes() const {
+		return group_count_ * sizeof(Group) + slab_.bytes();
+	}
+private:
+	static uint64_t hash(uint64_t key) {
+		//murmur3 finalizer,shard selection took the high bits of another mix
+		key ^= key >> 33;
+		key *= 0xff51afd7ed558ccdull;
+		key ^= key >> 33;
+		key *= 0xc4ceb9fe1a85ec53ull;
+		key ^= key >> 33;
+		return key;
+	}
+	static uint8_t h2(uint64_t h) { return (uint8_t)(0x80 | (h & 0x7F)); }
+	static size_t h1(uint64_t h) { return (size_t)(h >> 7); }
+	//0x80 in byte i of result when tags[i]==tag,little endian lanes
+	static uint64_t match(const Group& group, uint8_t tag) {
+		const uint64_t kLow7 = 0x7F7F7F7F7F7F7F7Full;
+		//overflow byte never takes part
+		const uint64_t kSlotLanes = 0x0080808080808080ull;
+		uint64_t word;
+		std::memcpy(&word, group.tags, sizeof(word));
+		uint64_t x = word ^ (0x0101010101010101ull * tag);
+		//exact zero byte test,no borrow between lanes
+		return ~(((x & kLow7) + kLow7) | x | kLow7) & kSlotLanes;
+	}
+	static size_t lowest_lane(uint64_t mask) {
+#if defined(_MSC_VER)
+		unsigned long index;
+		_BitScanForward64(&index, mask);
+		return (size_t)index / 8;
+#else
+		return (size_t)__builtin_ctzll(mask) / 8;
+#endif
+	}
+	//probing visits groups in triangular order,which covers all of them since
+	//the count is a power of 2
+	Group* find_group(uint64_t key, uint64_t h, size_t* slot) {
+		size_t mask = group_count_ - 1;
+		size_t index = h1(h) & mask;
+		uint8_t tag = h2(h);
+		for (size_t step = 1; step <= group_count_; ++step) {
+			Group& group = groups_[index];
+			for (uint64_t lanes = match(group, tag); lanes; lanes &= lanes - 1) {
+				size_t lane = lowest_lane(lanes);
+				if (likely(group.nodes[lane]->key == key)) {
+					*slot = lane;
+					return &group;
+				}
+			}
+			if (likely(!group.overflow))
+				return nullptr;
+			index = (index + step) & mask;
+		}
+		return nullptr;
+	}
+	//first empty slot on the probe sequence of h,load factor leaves one
+	void place(Node* node, uint64_t h) {
+		size_t mask = group_count_ - 1;
+		size_t index = h1(h) & mask;
+		for (size_t step = 1;; ++step) {
+			Group& group = groups_[index];
+			if (uint64_t lanes = match(group, 0)) {
+				size_t lane = lowest_lane(lanes);
+				group.tags[lane] = h2(h);
+				group.nodes[lane] = node;
+				return;
+			}
+			if (group.overflow != kOverflowSaturated)
+				++group.overflow;
+			index = (index + step) & mask;
+		}
+	}
+	template <typename F>
+	void for_each_node(F&& f) {
+		for (size_t i = 0; i < group_count_; ++i) {
+			for (size_t lane = 0; lane < kGroupSlots; ++lane) {
+				if (groups_[i].tags[lane])
+					f(groups_[i].nodes[lane]);
+			}
+		}
+	}
+	//rebuild groups only,nodes stay where they are
+	void rehash(size_t group_count) {
+		std::unique_ptr<Group[]> groups = std::move(groups_);
+		size_t old_count = group_count_;
+		groups_.reset(new Group[group_count]);
+		std::memset(static_cast<void*>(groups_.get()), 0, group_count * sizeof(Group));
+		group_count_ = group_count;
+		for (size_t i = 0; i < old_count; ++i) {
+			for (size_t lane = 0; lane < kGroupSlots; ++lane) {
+				if (groups[i].tags[lane])
+					place(groups[i].nodes[lane], hash(groups[i].nodes[lane]->key));
+			}
+		}
+	}
+	std::unique_ptr<Group[]> groups_;
+	//power of 2
+	size_t					 group_count_;
+	size_t					 size_;
+	Slab					 slab_;
+};
+CACHE_NAMESPACE_END
\ No newline at end of file
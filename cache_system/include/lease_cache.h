@@ -0,0 +1,168 @@
+/*
+ * lease_cache.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: rynzen <chuanrui123@126.com>
+ *
+ *  This file is part of a cache system of lease mechanism implemenation.
+ *
+ *  lease_cache.h is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  lease_cache.h is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with consistent_hashing.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+#include <unordered_map>
+#include <algorithm>
+#include <random>
+#include <type_traits>
+#include "common.h"
+#include "cache_data_center.h"
+
+CACHE_NAMESPACE_BEGIN
+//
+// client side copy of the values the server guaranteed to us.
+// server promises a value won't change for the expire of its CacheOpResponse,
+// the client counts it from its own first send of the request,so until then a
+// read could be answered from memory without any round trip.
+// a lease read again in its last kLeaseRenewMillisecond asks to be renewed once,
+// at a random point of that window so clients holding the same key don't come
+// together. a value whose lease ran out is kept until purged,a read of it sends
+// its version and the server answers not modified when it's still current.
+// an invalidation voids its version for as long as a lease on it could last,
+// a read response granting one that comes in after the ack is not kept.
+// not threadsafe, owned and driven by the client thread
+template <typename T>
+class LeaseCache {
+	enum LeaseCacheLimits {
+		//expire is on our clock and ends before the server's lease,give it up a
+		//bit early still,for clocks ticking whole milliseconds
+		kLeaseSafetyMillisecond = 5,
+		//sweep expired leases when map grows past this
+		kPurgeThreshold = 4096,
+	};
+	struct LeaseEntry {
+		std::time_t expire;
+		//0 when not to renew,renewal asked or server didn't tell version
+		std::time_t renew_at;
+		uint64_t	version;
+		T			value;
+	};
+	struct VoidedVersion {
+		uint64_t	version;
+		//a lease granted before the invalidation has ended by then
+		std::time_t until;
+	};
+public:
+	using ValueType=T;
+	static_assert(!std::is_reference_v<ValueType> && !std::is_const_v<ValueType>, "value type should not be reference or const");
+
+	LeaseCache() :map_(), voided_(), purge_threshold_(kPurgeThreshold), random_(std::random_device{}()) {}
+	//return: true if cache_id holds a valid lease,expire and value are filled
+	//renew:  set once per lease when it's time to ask for renewal
+	bool lookup(uint32_t cache_id/*IN*/, std::time_t* expire/*OUT*/, ValueType* value/*OUT*/, bool* renew = nullptr/*OUT*/) {
+		auto it = map_.find(cache_id);
+		if (it == map_.end() || !lease_valid(it->second.expire))
+			return false;
+		LeaseEntry& entry = it->second;
+		if (renew && entry.renew_at && entry.renew_at <= get_time_stamp()) {
+			entry.renew_at = 0;
+			*renew = true;
+		}
+		*expire = entry.expire;
+		*value = entry.value;
+		return true;
+	}
+	//value held whether its lease is valid or not,to be revalidated by version
+	//return: its version,0 when there is none and value is left alone
+	uint64_t held(uint32_t cache_id/*IN*/, ValueType* value/*OUT*/) const {
+		auto it = map_.find(cache_id);
+		if (it == map_.end() || !it->second.version)
+			return 0;
+		*value = it->second.value;
+		return it->second.version;
+	}
+	//keep value until expire,a lease already expired is dropped.
+	//version:0 when server didn't tell,such a lease is never renewed
+	template <typename U>
+	void store(uint32_t cache_id, std::time_t expire, U&& value, uint64_t version = 0) {
+		if (!lease_valid(expire) || voided(cache_id, version)) {
+			map_.erase(cache_id);
+			return;
+		}
+		auto emplaced = map_.try_emplace(cache_id);
+		LeaseEntry& entry = emplaced.first->second;
+		//a renewal that didn't push the lease further isn't asked again
+		bool extended = emplaced.second || entry.version != version || expire > entry.expire;
+		entry.expire = expire;
+		entry.renew_at = extended && version ? renew_point(expire) : 0;
+		entry.version = version;
+		entry.value = std::forward<U>(value);
+		if (unlikely(map_.size() >= purge_threshold_))
+			purge_expired();
+	}
+	//version:replaced on server,leases on it and older ones are refused from now on,
+	//0 when only the local copy is dropped
+	void invalidate(uint32_t cache_id, uint64_t version = 0) {
+		map_.erase(cache_id);
+		if (!version)
+			return;
+		VoidedVersion& voided = voided_[cache_id];
+		voided.version = std::max(voided.version, version);
+		voided.until = get_time_stamp(kDefaultExpireMillisecond);
+	}
+	void purge_expired() {
+		std::time_t now = get_time_stamp();
+		for (auto it = map_.begin(); it != map_.end();) {
+			if (it->second.expire <= now + kLeaseSafetyMillisecond)
+				it = map_.erase(it);
+			else
+				++it;
+		}
+		for (auto it = voided_.begin(); it != voided_.end();) {
+			if (it->second.until <= now)
+				it = voided_.erase(it);
+			else
+				++it;
+		}
+		//all alive,don't sweep again until map doubles
+		purge_threshold_ = std::max<size_t>(kPurgeThreshold, map_.size() * 2);
+	}
+	size_t size() const { return map_.size(); }
+private:
+	static bool lease_valid(std::time_t expire) {
+		return expire > get_time_stamp(kLeaseSafetyMillisecond);
+	}
+	//version 0 is a lease server didn't tell the version of,an update's own
+	bool voided(uint32_t cache_id, uint64_t version) {
+		if (voided_.empty() || !version)
+			return false;
+		auto it = voided_.find(cache_id);
+		if (it == voided_.end())
+			return false;
+		//any lease on a voided version has run out by now
+		if (it->second.until <= get_time_stamp()) {
+			voided_.erase(it);
+			return false;
+		}
+		return version <= it->second.version;
+	}
+	//somewhere in the first half of the renew window
+	std::time_t renew_point(std::time_t expire) {
+		std::uniform_int_distribution<uint32_t> jitter(kLeaseRenewMillisecond / 2, kLeaseRenewMillisecond);
+		return expire - jitter(random_);
+	}
+	std::unordered_map<uint32_t, LeaseEntry> map_;
+	std::unordered_map<uint32_t, VoidedVersion> voided_;
+	size_t									 purge_threshold_;
+	std::minstd_rand						 random_;
+};
+CACHE_NAMESPACE_END
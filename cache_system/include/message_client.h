@@ -23,6 +23,9 @@
 #pragma once
 #include <memory>
 #include <string>
+#include <string_view>
+#include <vector>
+#include <utility>
 #include <functional>
 #include "common.h"
 #include "socket_group.h"
@@ -33,14 +36,18 @@ class MessageClientImpl :public std::enable_shared_from_this<MessageClientImpl>
 public:
 	using CallbackHandleType=std::function<void(csn::OpResult result, std::time_t expire,
 		uint32_t cache_id, CacheDataType cache_data)>;
+	using CacheItems=std::vector<std::pair<uint32_t, CacheDataType>>;
 	MessageClientImpl() = default;
 	void bind_socket(std::shared_ptr<ProtoSocket> socket) {
 		socket_ = socket;
 	}
 	virtual ~MessageClientImpl() = default;
-	virtual void on_receive( const std::string& data) = 0;
+	virtual void on_receive(std::string_view data) = 0;
 	virtual void read_cache_async(uint32_t cache_id, CallbackHandleType handle) = 0;
 	virtual void update_cache_async(uint32_t cache_id, CacheDataType cache_data, CallbackHandleType handle)=0;
+	//many keys in as few datagrams as fit,handle is called once per cache_id
+	virtual void read_many_async(const std::vector<uint32_t>& cache_ids, CallbackHandleType handle) = 0;
+	virtual void update_many_async(CacheItems items, CallbackHandleType handle) = 0;
 protected:
 	std::shared_ptr<ProtoSocket> socket_;
 };
@@ -55,7 +62,7 @@ public:
 		if (impl_)
 			impl_->bind_socket(this->shared_from_this());
 	}
-	void on_receive(const std::string& data) override
+	void on_receive(std::string_view data) override
 	{
 		if (!impl_)
 			throw csn::Exception(csn::Exception::kErrorIllUsage, "on_receive null implment");
@@ -71,6 +78,16 @@ public:
 			throw csn::Exception(csn::Exception::kErrorIllUsage, "update_cache_async null implment");
 		impl_->update_cache_async(cache_id, cache_data,std::move(handle));
 	}
+	void read_many_async(const std::vector<uint32_t>& cache_ids, MessageClientImpl::CallbackHandleType handle) {
+		if (!impl_)
+			throw csn::Exception(csn::Exception::kErrorIllUsage, "read_many_async null implment");
+		impl_->read_many_async(cache_ids, std::move(handle));
+	}
+	void update_many_async(MessageClientImpl::CacheItems items, MessageClientImpl::CallbackHandleType handle) {
+		if (!impl_)
+			throw csn::Exception(csn::Exception::kErrorIllUsage, "update_many_async null implment");
+		impl_->update_many_async(std::move(items), std::move(handle));
+	}
 private:
 	std::shared_ptr<MessageClientImpl> impl_;
 };
@@ -22,6 +22,7 @@
 #pragma once
 #include <memory>
 #include <string>
+#include <string_view>
 #include <type_traits>
 #include "common.h"
 #include "socket_group.h"
@@ -34,7 +35,7 @@ public:
 		socket_ = socket;
 	}
 	virtual ~MessageServerImpl() = default;
-	virtual void on_receive(const std::string& data)=0;
+	virtual void on_receive(std::string_view data)=0;
 protected:
 	std::shared_ptr<ProtoSocket> socket_;
 };
@@ -49,7 +50,7 @@ public:
 		if(impl_)
 			impl_->bind_socket(this->shared_from_this());
 	}
-	void on_receive(const std::string& data) override
+	void on_receive(std::string_view data) override
 	{
 		if(unlikely(!impl_))
 			throw csn::Exception(csn::Exception::kErrorIllUsage, "null implment");
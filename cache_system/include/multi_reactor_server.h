@@ -0,0 +1,295 @@
+/*
+ * multi_reactor_server.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: rynzen <chuanrui123@126.com>
+ *
+ *  This file is part of a cache system of lease mechanism implemenation.
+ *
+ *  multi_reactor_server.h is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  multi_reactor_server.h is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with consistent_hashing.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <vector>
+#include <unordered_map>
+#include <map>
+#include <memory>
+#include <string>
+#include "common.h"
+#include "timer_queue.h"
+#include "cache_data_center.h"
+#include "message_server.h"
+#include "socket_group_epoll_impl.h"
+#include "protobuf_message_server_impl.h"
+
+#include <sys/eventfd.h>
+
+CACHE_NAMESPACE_BEGIN
+//
+// N event loop threads,each with its own SO_REUSEPORT socket,epoll loop,arena and
+// timer queue,all bound to the same port. shards of the shared CacheDataCenter are
+// owned round robin by the reactors,a request the kernel hashed to a reactor not
+// owning its key is handed off to the owner through a queue and an eventfd,the
+// owner answers from its own socket. acks follow their request the same way.
+// Example:
+//		MultiReactorServer server(4);
+//		server.start("*", 3824);
+//		server.join();
+class MultiReactorServer {
+	enum MultiReactorDefault {
+		kShardsPerReactor = 4,
+		//forget a handed off operation whose ack never came
+		kForwardTimeout = 2000,
+		//sequences of many responses carry reactor index+1 above this bit
+		kSequenceShift = 24,
+	};
+	struct Handoff {
+		std::string		 data;
+		//ids of the process wide PeerTable mean the same peer to every reactor
+		PeerId			 peer;
+	};
+	//op_ids of different clients may collide
+	using ForwardKey = std::pair<PeerId, uint64_t>;
+	struct Forward {
+		uint32_t		 owner;
+		//tells the timer of a resent request from the timers of earlier sends
+		uint64_t		 generation;
+	};
+	class Reactor;
+public:
+	explicit MultiReactorServer(uint32_t reactor_count) :
+		reactor_count_(std::max<uint32_t>(reactor_count, 1)),
+		center_(std::make_shared<CacheDataCenter<CacheDataType>>(reactor_count_ * kShardsPerReactor)),
+		reactors_(), running_(false) {}
+	~MultiReactorServer() {
+		stop();
+	}
+	std::shared_ptr<CacheDataCenter<CacheDataType>> data_center() { return center_; }
+	//bind every reactor socket on the caller thread,so errors throw from here
+	void start(const std::string& host_local, uint16_t local_port) {
+		if (running_.exchange(true))
+			throw csn::Exception(csn::Exception::kErrorIllUsage, "MultiReactorServer already started");
+		for (uint32_t i = 0; i < reactor_count_; ++i) {
+			reactors_.emplace_back(std::make_unique<Reactor>(*this, i));
+			reactors_.back()->open(host_local, local_port);
+		}
+		for (auto& reactor : reactors_)
+			reactor->start();
+	}
+	void stop() {
+		if (!running_.exchange(false))
+			return;
+		for (auto& reactor : reactors_)
+			reactor->wake();
+		join();
+	}
+	void join() {
+		for (auto& reactor : reactors_)
+			reactor->join();
+	}
+	uint32_t reactor_count() const { return reactor_count_; }
+private:
+	uint32_t owner_of(uint64_t cache_id) const {
+		return (uint32_t)(center_->shard_index(cache_id) % reactor_count_);
+	}
+	class Reactor {
+		//expires the lease timers of shards this reactor owns
+		class ShardTimers :public TimerSource {
+		public:
+			ShardTimers(const std::shared_ptr<CacheDataCenter<CacheDataType>>& center,
+				uint32_t index, uint32_t reactor_count) :center_(center), shards_() {
+				for (size_t i = index; i < center_->shard_count(); i += reactor_count)
+					shards_.push_back(i);
+			}
+			uint32_t next_timeout_ms() override {
+				uint32_t timeout = kTimerIdle;
+				for (size_t shard : shards_)
+					timeout = std::min(timeout, center_->shard_next_timeout_ms(shard));
+				return timeout;
+			}
+			void tick() override {
+				for (size_t shard : shards_)
+					center_->tick_shard(shard);
+			}
+		private:
+			std::shared_ptr<CacheDataCenter<CacheDataType>> center_;
+			std::vector<size_t> shards_;
+		};
+	public:
+		Reactor(MultiReactorServer& server, uint32_t index) :server_(server), index_(index),
+			event_fd_(-1), socket_(), impl_(), thread_(), mutex_(), handoffs_(), forwarded_(), forward_generation_(0),
+			shard_timers_(server.center_, index, server.reactor_count_) {}
+		~Reactor() {
+			if (event_fd_ >= 0)
+				::close(event_fd_);
+		}
+		void open(const std::string& host_local, uint16_t local_port) {
+			event_fd_ = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+			if (event_fd_ < 0)
+				throw csn::Exception(csn::Exception::kErrorSysRoutine, "eventfd failure");
+			socket_ = std::make_shared<MessageServer<MmsgUdpSocket>>();
+			socket_->set_reuse_port(true);
+			socket_->initialize(host_local, local_port, "*", 0);
+		}
+		void start() {
+			thread_ = std::thread(&Reactor::run, this);
+		}
+		void join() {
+			if (thread_.joinable())
+				thread_.join();
+		}
+		void wake() {
+			uint64_t one = 1;
+			if (::write(event_fd_, &one, sizeof(one)) < 0)
+				LOG_OUT("reactor %u wake up failure", index_);
+		}
+		void post(Handoff&& handoff) {
+			{
+				std::lock_guard<std::mutex> lock(mutex_);
+				handoffs_.emplace_back(std::move(handoff));
+			}
+			wake();
+		}
+	private:
+		//everything touching thread local timer queue and ack manager is created here
+		void run() {
+			impl_ = std::make_shared<ProtobufMessageServerImpl>(server_.center_);
+			impl_->set_sequence_base((index_ + 1) << kSequenceShift);
+			impl_->set_dispatch_filter(std::bind(&Reactor::dispatch, this,
+				std::placeholders::_1, std::placeholders::_2));
+			socket_->set_message_impl(impl_);
+			SocketGroupEpollImpl group{};
+			group.register_socket(socket_);
+			group.register_handler(event_fd_, std::bind(&Reactor::drain_handoffs, this));
+			group.add_timer_source(TimerQueue::get_timer_queue());
+			group.add_timer_source(&shard_timers_);
+			while (server_.running_) {
+				try {
+					group.listen(-1);
+				}
+				catch (csn::Exception e) { LOG_OUT("reactor %u csn::Exception code:%d describe:%s", index_, e.code(), e.what()); }
+				catch (std::exception e) { LOG_OUT("reactor %u std::exception code:%s", index_, e.what()); }
+			}
+			group.unregister_socket(socket_);
+		}
+		bool dispatch(std::string_view data, CacheMessage* request) {
+			const CacheMessageHeader& header = request->header();
+			ForwardKey key(socket_->remote_peer(), header.op_id());
+			uint32_t owner = index_;
+			switch (header.type()) {
+			case CacheMessageProto::kReadRequest:
+				owner = server_.owner_of(request->read_request().cache_id());
+				break;
+			case CacheMessageProto::kUpdateRequest:
+				owner = server_.owner_of(request->update_request().cache_id());
+				break;
+			case CacheMessageProto::kReadManyRequest:
+				//reads only touch leases under their shard lock,any reactor answers
+				return true;
+			case CacheMessageProto::kUpdateManyRequest:
+				return split_update_many(request);
+			case CacheMessageProto::kOperationAck: {
+				//datagram of a many response,sequence tells who sent it
+				if (uint32_t sender = header.sequence() >> kSequenceShift) {
+					owner = sender - 1;
+					break;
+				}
+				auto it = forwarded_.find(key);
+				if (it == forwarded_.end())
+					return true;
+				owner = it->second.owner;
+				forwarded_.erase(it);
+				break;
+			}
+			default:
+				return true;
+			}
+			if (owner == index_)
+				return true;
+			if (header.type() != CacheMessageProto::kOperationAck) {
+				//same peer hashes to this reactor again,its ack has to follow
+				uint64_t generation = ++forward_generation_;
+				forwarded_[key] = Forward{ owner, generation };
+				TimerQueue::get_timer_queue()->add_timer([this, key, generation]() {
+					auto it = forwarded_.find(key);
+					if (it != forwarded_.end() && it->second.generation == generation)
+						forwarded_.erase(it); }, kForwardTimeout);
+			}
+			//datagram buffer is reused by next receive,the handoff owns a copy
+			Handoff handoff{ std::string(data), socket_->remote_peer() };
+			server_.reactors_[owner]->post(std::move(handoff));
+			return false;
+		}
+		//keys of a many update may belong to several reactors,a deferred one is
+		//committed by the reactor ticking its shard,so each owner gets its part
+		//return: true when some items are left for this reactor
+		bool split_update_many(CacheMessage* request) {
+			auto* items = request->mutable_update_many_request()->mutable_items();
+			std::unordered_map<uint32_t, CacheMessage> parts;
+			int kept = 0;
+			for (int i = 0; i < items->size(); ++i) {
+				uint32_t owner = server_.owner_of(items->Get(i).cache_id());
+				if (owner == index_) {
+					items->SwapElements(kept++, i);
+					continue;
+				}
+				CacheMessage& part = parts[owner];
+				if (!part.has_header()) {
+					part.mutable_header()->CopyFrom(request->header());
+					part.mutable_update_many_request()->set_timestamp(request->update_many_request().timestamp());
+					part.mutable_update_many_request()->set_expire(request->update_many_request().expire());
+				}
+				part.mutable_update_many_request()->add_items()->CopyFrom(items->Get(i));
+			}
+			for (auto& part : parts) {
+				Handoff handoff{ part.second.SerializeAsString(), socket_->remote_peer() };
+				server_.reactors_[part.first]->post(std::move(handoff));
+			}
+			if (!parts.empty())
+				items->DeleteSubrange(kept, items->size() - kept);
+			return kept > 0;
+		}
+		void drain_handoffs() {
+			uint64_t count;
+			if (::read(event_fd_, &count, sizeof(count)) < 0 && errno != EAGAIN)
+				LOG_OUT("reactor %u read eventfd failure", index_);
+			std::vector<Handoff> handoffs;
+			{
+				std::lock_guard<std::mutex> lock(mutex_);
+				handoffs.swap(handoffs_);
+			}
+			for (Handoff& handoff : handoffs)
+				socket_->receive_from(handoff.data, handoff.peer);
+		}
+		MultiReactorServer&								 server_;
+		uint32_t										 index_;
+		int												 event_fd_;
+		std::shared_ptr<MessageServer<MmsgUdpSocket>>	 socket_;
+		std::shared_ptr<ProtobufMessageServerImpl>		 impl_;
+		std::thread										 thread_;
+		std::mutex										 mutex_;
+		std::vector<Handoff>							 handoffs_;
+		//peer and op_id handed off to owner reactor,only touched by this reactor thread
+		std::map<ForwardKey, Forward>					 forwarded_;
+		uint64_t										 forward_generation_;
+		ShardTimers										 shard_timers_;
+	};
+	uint32_t								 reactor_count_;
+	std::shared_ptr<CacheDataCenter<CacheDataType>> center_;
+	std::vector<std::unique_ptr<Reactor>>	 reactors_;
+	std::atomic<bool>						 running_;
+};
+CACHE_NAMESPACE_END
@@ -0,0 +1,204 @@
+/*
+ * peer_table.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: rynzen <chuanrui123@126.com>
+ *
+ *  This file is part of a cache system of lease mechanism implemenation.
+ *
+ *  peer_table.h is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  peer_table.h is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with consistent_hashing.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+#include <deque>
+#include <vector>
+#include <atomic>
+#include <algorithm>
+#include <unordered_map>
+#include <shared_mutex>
+#include <mutex>
+#include <cstring>
+#include "common.h"
+
+#if defined(OS_WINDOWS)
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#else
+#include <sys/socket.h>
+#include <netinet/in.h>
+#endif
+
+CACHE_NAMESPACE_BEGIN
+//
+// source addresses of datagrams interned to a small PeerId,lease holders and
+// responses waiting for an ack keep the id instead of the address.
+// ids start at 1(kNoPeer is 0). an id nothing was received from for
+// kPeerIdleMillisecond is reclaimed and given to a new address,so ephemeral
+// ports and spoofed sources can't grow the table for ever. a peer idle that
+// long has no response waiting for an ack and its leases have ended,a holder
+// list may still name it but the state manager drops lapsed holders before
+// invalidating,so the new owner of the id is never sent one for them.
+// one table per process,so an id means the same peer on every socket and
+// event loop sharing the data center.
+class PeerTable {
+	enum PeerTableLimits {
+		//far beyond a lease and a client's operation deadline
+		kPeerIdleMillisecond = 120000,
+		//sweep idle peers when table grows past this
+		kSweepThreshold = 4096,
+	};
+	//family,port and address bytes,no padding left to compare
+	struct PeerKey {
+		uint8_t  address[16];
+		uint32_t scope;
+		uint16_t port;
+		uint16_t family;
+		bool operator==(const PeerKey& other) const {
+			return std::memcmp(this, &other, sizeof(PeerKey)) == 0;
+		}
+	};
+	struct PeerKeyHash {
+		size_t operator()(const PeerKey& key) const {
+			//fnv-1a over the key bytes
+			const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&key);
+			uint64_t hash = 14695981039346656037ULL;
+			for (size_t i = 0; i < sizeof(PeerKey); ++i)
+				hash = (hash ^ bytes[i]) * 1099511628211ULL;
+			return (size_t)hash;
+		}
+	};
+	struct PeerAddress {
+		sockaddr_storage		 addr;
+		//0 while the id is free
+		socklen_t				 length;
+		//last datagram received,updated under the shared lock
+		std::atomic<std::time_t> seen;
+	};
+public:
+	PeerTable() :mutex_(), ids_(), addresses_(), free_(), sweep_threshold_(kSweepThreshold), reclaimed_(0) {}
+	PeerTable(const PeerTable&) = delete;
+	PeerTable& operator=(const PeerTable&) = delete;
+	//return: id of addr,kNoPeer for a family other than ipv4/ipv6
+	PeerId intern(const sockaddr* addr, socklen_t length) {
+		PeerKey key{};
+		if (unlikely(!make_key(addr, length, &key)))
+			return kNoPeer;
+		std::time_t now = get_time_stamp();
+		{
+			std::shared_lock<std::shared_mutex> lock(mutex_);
+			auto it = ids_.find(key);
+			if (likely(it != ids_.end())) {
+				touch(it->second, now);
+				return it->second;
+			}
+		}
+		std::unique_lock<std::shared_mutex> lock(mutex_);
+		auto it = ids_.find(key);
+		if (it != ids_.end()) {
+			touch(it->second, now);
+			return it->second;
+		}
+		if (free_.empty() && addresses_.size() >= sweep_threshold_)
+			sweep_idle(now);
+		PeerId peer{};
+		if (!free_.empty()) {
+			peer = free_.back();
+			free_.pop_back();
+		}
+		else {
+			addresses_.emplace_back();
+			peer = (PeerId)addresses_.size();
+		}
+		PeerAddress& address = addresses_[peer - 1];
+		std::memcpy(&address.addr, addr, length);
+		address.length = length;
+		address.seen.store(now, std::memory_order_relaxed);
+		ids_.emplace(key, peer);
+		return peer;
+	}
+	//return: false when peer was never interned
+	bool lookup(PeerId peer, sockaddr_storage* addr, socklen_t* length) {
+		std::shared_lock<std::shared_mutex> lock(mutex_);
+		if (unlikely(peer == kNoPeer || peer > addresses_.size()))
+			return false;
+		const PeerAddress& address = addresses_[peer - 1];
+		if (unlikely(!address.length))
+			return false;
+		std::memcpy(addr, &address.addr, address.length);
+		*length = address.length;
+		return true;
+	}
+	//peers holding an id
+	size_t size() {
+		std::shared_lock<std::shared_mutex> lock(mutex_);
+		return ids_.size();
+	}
+	//ids taken back from idle peers so far
+	uint64_t reclaimed() {
+		std::shared_lock<std::shared_mutex> lock(mutex_);
+		return reclaimed_;
+	}
+	static PeerTable* get_peer_table() {
+		static PeerTable table{};
+		return &table;
+	}
+private:
+	//one store a second at most,the cache line stays shared between readers
+	void touch(PeerId peer, std::time_t now) {
+		std::atomic<std::time_t>& seen = addresses_[peer - 1].seen;
+		if (seen.load(std::memory_order_relaxed) + 1000 <= now)
+			seen.store(now, std::memory_order_relaxed);
+	}
+	//under the unique lock
+	void sweep_idle(std::time_t now) {
+		for (auto it = ids_.begin(); it != ids_.end();) {
+			PeerAddress& address = addresses_[it->second - 1];
+			if (address.seen.load(std::memory_order_relaxed) + kPeerIdleMillisecond <= now) {
+				address.length = 0;
+				free_.push_back(it->second);
+				++reclaimed_;
+				it = ids_.erase(it);
+			}
+			else
+				++it;
+		}
+		//all alive,don't sweep again until table doubles
+		sweep_threshold_ = std::max<size_t>(kSweepThreshold, ids_.size() * 2);
+	}
+	static bool make_key(const sockaddr* addr, socklen_t length, PeerKey* key) {
+		if (addr->sa_family == AF_INET && length >= (socklen_t)sizeof(sockaddr_in)) {
+			const sockaddr_in* in = reinterpret_cast<const sockaddr_in*>(addr);
+			std::memcpy(key->address, &in->sin_addr, sizeof(in->sin_addr));
+			key->port = in->sin_port;
+		}
+		else if (addr->sa_family == AF_INET6 && length >= (socklen_t)sizeof(sockaddr_in6)) {
+			const sockaddr_in6* in6 = reinterpret_cast<const sockaddr_in6*>(addr);
+			std::memcpy(key->address, &in6->sin6_addr, sizeof(in6->sin6_addr));
+			key->port = in6->sin6_port;
+			key->scope = in6->sin6_scope_id;
+		}
+		else
+			return false;
+		key->family = addr->sa_family;
+		return true;
+	}
+	std::shared_mutex								 mutex_;
+	std::unordered_map<PeerKey, PeerId, PeerKeyHash> ids_;
+	//indexed by id-1,a deque as its elements hold atomics and must not move
+	std::deque<PeerAddress>							 addresses_;
+	//ids reclaimed and not given out again
+	std::vector<PeerId>								 free_;
+	size_t											 sweep_threshold_;
+	uint64_t										 reclaimed_;
+};
+CACHE_NAMESPACE_END
\ No newline at end of file
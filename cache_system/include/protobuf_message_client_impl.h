@@ -20,6 +20,10 @@
  *  along with consistent_hashing.  If not, see <http://www.gnu.org/licenses/>.
  */
 #pragma once
+#include <cmath>
+#include <vector>
+#include <unordered_map>
+#include <unordered_set>
 #include <google/protobuf/arena.h>
 #include "cache_data_center.h"
 #include "snowflake.h"
@@ -27,16 +31,62 @@
 #include "common.h"
 #include "protobuf_message_common.h"
 #include "message_client.h"
+#include "lease_cache.h"
+#include "arena_pool.h"
+#include "timer_queue.h"
 CACHE_NAMESPACE_BEGIN
+//
+// retransmission timeout of one server,srtt and rttvar smoothed the way tcp
+// does(rfc 6298),an operation resent doubles its own timeout up to the cap
+class RttEstimator {
+public:
+	enum RttDefault {
+		//no sample yet
+		kInitialRtoMillisecond = 200,
+		kMinRtoMillisecond = 10,
+		kMaxRtoMillisecond = 1000,
+	};
+	RttEstimator() :sampled_(false), srtt_(0), rttvar_(0), rto_(kInitialRtoMillisecond) {}
+	void sample(uint32_t rtt_ms) {
+		double rtt = rtt_ms;
+		if (!sampled_) {
+			srtt_ = rtt;
+			rttvar_ = rtt / 2;
+			sampled_ = true;
+		}
+		else {
+			rttvar_ = 0.75 * rttvar_ + 0.25 * std::fabs(srtt_ - rtt);
+			srtt_ = 0.875 * srtt_ + 0.125 * rtt;
+		}
+		//clock ticks in whole milliseconds
+		uint32_t rto = (uint32_t)std::ceil(srtt_ + std::max(1.0, 4 * rttvar_));
+		rto_ = std::min<uint32_t>(std::max<uint32_t>(rto, kMinRtoMillisecond), kMaxRtoMillisecond);
+	}
+	uint32_t rto() const { return rto_; }
+	uint32_t srtt() const { return (uint32_t)srtt_; }
+	static uint32_t backoff(uint32_t rto) {
+		return std::min<uint32_t>(rto * 2, kMaxRtoMillisecond);
+	}
+private:
+	bool	 sampled_;
+	double	 srtt_;
+	double	 rttvar_;
+	uint32_t rto_;
+};
+
 class CacheClientOperation {
 public:
-	using CallbackHandleType=std::function<void(csn::OpResult result, std::time_t expire, uint32_t cache_id, CacheDataType cache_data)>;
-	CacheClientOperation(std::shared_ptr<google::protobuf::Arena> arena,
-		uint64_t op_id, CallbackHandleType handle,
-		std::shared_ptr<ProtoSocket> socket) :arena_(arena),
-		op_id_(op_id), cache_id_(), handle_(std::move(handle)), socket_(socket) {}
+	//expire:lease end on our clock,version:of the value,0 when server didn't tell
+	using ResultHandleType=std::function<void(csn::OpResult result, std::time_t expire, uint32_t cache_id,
+		uint64_t version, CacheDataType cache_data)>;
+	CacheClientOperation(std::shared_ptr<ArenaPool> arena_pool,
+		uint64_t op_id, ResultHandleType handle,
+		std::shared_ptr<ProtoSocket> socket) :arena_pool_(arena_pool),
+		op_id_(op_id), cache_id_(), handle_(std::move(handle)), socket_(socket),
+		started_at_(get_time_stamp()), sent_at_(0), deadline_(0), rto_(0), timer_id_(0), deferred_(false) {}
 	virtual ~CacheClientOperation() = default;
-	virtual void process_response(CacheMessage* response) {
+	//return: true when operation got all its results
+	virtual bool process_response(CacheMessage* response) {
 		google::protobuf::Arena* arena_ptr = response->GetArena();
 		if (!arena_ptr) {
 			LOG_OUT("get Arena failure !!!!");
@@ -52,12 +102,20 @@ public:
 			LOG_OUT("match error cache_id %u when expect cache_id %u", op_response->cache_id(), cache_id_);
 			throw csn::Exception(csn::Exception::kErrorSysRoutine, "match error cache_id");
 		}
-		handle_((csn::OpResult)op_response->result(), op_response->expire(), op_response->cache_id(), op_response->cache_data());
+		//a resent update still pending on server,the result comes on commit
+		if (op_response->result() == csn::kOperationDefer) {
+			deferred_ = true;
+			return false;
+		}
+		handle_((csn::OpResult)op_response->result(), local_expire(*op_response), op_response->cache_id(),
+			op_response->version(), take_cache_data(op_response));
 		//send ack to server
 		do_send_ack(response);
+		return true;
 	}
+	//ack lives in the arena of response
 	void do_send_ack(CacheMessage* response) {
-		CacheMessage* ack = google::protobuf::Arena::CreateMessage<CacheMessage>(arena_.get());
+		CacheMessage* ack = google::protobuf::Arena::CreateMessage<CacheMessage>(response->GetArena());
 		CacheMessageRaii ack_raii(ack);
 		ack->unsafe_arena_set_allocated_header(response->unsafe_arena_release_header());
 		prepare_header(CacheMessageProto::kOperationAck, ack);
@@ -65,6 +123,37 @@ public:
 		do_send_cache_message(socket_, ack);
 		PRINTF_MESSAGE_INFO("send", ack);
 	}
+	//send request again with expire_time_ms left
+	//return: false when it mustn't be resent,the deadline is waited out
+	virtual bool resend(uint32_t expire_time_ms) { return false; }
+	//deadline passed,every key still waiting gets kOperationTimeout
+	virtual void expire() {
+		handle_(csn::kOperationTimeout, 0, cache_id_, 0, CacheDataType());
+	}
+	//response time is one round trip,not a lease waited out on server
+	virtual bool rtt_sample() const { return false; }
+	void schedule(std::time_t deadline, uint32_t rto) {
+		sent_at_ = get_time_stamp();
+		deadline_ = deadline;
+		rto_ = rto;
+	}
+	//resent:no rtt is sampled from it any more(karn)
+	void backoff() {
+		sent_at_ = 0;
+		rto_ = RttEstimator::backoff(rto_);
+	}
+	//return: round trip of a first send,once,-1 if there is none
+	int32_t take_rtt() {
+		if (!rtt_sample() || !sent_at_)
+			return -1;
+		int32_t rtt = (int32_t)(get_time_stamp() - sent_at_);
+		sent_at_ = 0;
+		return std::max<int32_t>(rtt, 0);
+	}
+	std::time_t deadline() const { return deadline_; }
+	uint32_t rto() const { return rto_; }
+	size_t timer_id() const { return timer_id_; }
+	void set_timer_id(size_t timer_id) { timer_id_ = timer_id; }
 protected:
 	void prepare_header(CacheMessageProto::CacheMessageType type/*IN*/, CacheMessage* message/*OUT*/) {
 		//set response header
@@ -75,53 +164,110 @@ protected:
 		header->set_op_id(op_id_);
 	}
 	virtual void prepare_request(CacheMessage* message/*OUT*/, uint32_t expire_time_ms) {}
+	//server's timestamp is on its clock,expire is what was left of the lease
+	//when it answered,after the first send. counted from that send on our
+	//clock it ends no later than the server's,whatever the skew
+	std::time_t local_expire(const CacheOpResponse& op_response) const {
+		return started_at_ + op_response.expire();
+	}
+	//value handed to user,moved out of the response arena
+	virtual CacheDataType take_cache_data(CacheOpResponse* op_response) {
+		return std::move(*op_response->mutable_cache_data());
+	}
 protected:
-	std::shared_ptr<google::protobuf::Arena> arena_;
+	std::shared_ptr<ArenaPool>		 arena_pool_;
 	uint64_t						 op_id_;
 	uint32_t						 cache_id_;
-	CallbackHandleType				 handle_;
+	ResultHandleType				 handle_;
 	std::shared_ptr<ProtoSocket>	 socket_;
+	//created right before the first send
+	std::time_t						 started_at_;
+	std::time_t						 sent_at_;
+	std::time_t						 deadline_;
+	uint32_t						 rto_;
+	size_t							 timer_id_;
+	//server told a resend the update is waiting for a lease to end
+	bool							 deferred_;
 };
 
 class CacheClientReadOpration :public CacheClientOperation {
 public:
-	CacheClientReadOpration(std::shared_ptr<google::protobuf::Arena> arena,
-		uint64_t op_id, CallbackHandleType handle, std::shared_ptr<ProtoSocket> socket) :
-		CacheClientOperation(arena, op_id, handle, socket) {}
-	void do_send_request(uint32_t cache_id, uint32_t expire_time_ms)
+	CacheClientReadOpration(std::shared_ptr<ArenaPool> arena_pool,
+		uint64_t op_id, ResultHandleType handle, std::shared_ptr<ProtoSocket> socket) :
+		CacheClientOperation(arena_pool, op_id, handle, socket), version_(0), held_() {}
+	bool resend(uint32_t expire_time_ms) override {
+		send_request(expire_time_ms);
+		return true;
+	}
+	bool rtt_sample() const override { return true; }
+	//version,held:value client already has,0 for none,a not modified response
+	//renews its lease and hands held back as the value read
+	void do_send_request(uint32_t cache_id, uint32_t expire_time_ms, uint64_t version = 0, CacheDataType held = CacheDataType())
 	{
-		CacheMessage* request = google::protobuf::Arena::CreateMessage<CacheMessage>(arena_.get());
-		CacheMessageRaii req_raii(request);
 		cache_id_ = cache_id;
+		version_ = version;
+		held_ = std::move(held);
+		send_request(expire_time_ms);
+	}
+protected:
+	void send_request(uint32_t expire_time_ms)
+	{
+		//request is gone once sent,arena goes back to the pool
+		ArenaPtr arena = arena_pool_->acquire();
+		CacheMessage* request = google::protobuf::Arena::CreateMessage<CacheMessage>(arena.get());
+		CacheMessageRaii req_raii(request);
 		prepare_header(CacheMessageProto::kReadRequest, request);
 		prepare_request(request, expire_time_ms);
 		do_send_cache_message(socket_, request);
 	}
-protected:
 	void prepare_request(CacheMessage* message/*OUT*/, uint32_t expire_time_ms) override {
 		CacheMessageProto::CacheReadRequest* read_request = message->mutable_read_request();
 		read_request->set_cache_id(cache_id_);
 		read_request->set_timestamp(get_time_stamp());
 		read_request->set_expire(expire_time_ms);
+		read_request->set_version(version_);
 	}
+	CacheDataType take_cache_data(CacheOpResponse* op_response) override {
+		if (op_response->not_modified())
+			return std::move(held_);
+		return CacheClientOperation::take_cache_data(op_response);
+	}
+private:
+	uint64_t	  version_;
+	CacheDataType held_;
 };
 class CacheClientUpdateOpration :public CacheClientOperation {
 public:
-	CacheClientUpdateOpration(std::shared_ptr<google::protobuf::Arena> arena,
-		uint64_t op_id, CallbackHandleType handle,
+	CacheClientUpdateOpration(std::shared_ptr<ArenaPool> arena_pool,
+		uint64_t op_id, ResultHandleType handle,
 		std::shared_ptr<ProtoSocket> socket) :
-		CacheClientOperation(arena, op_id, handle, socket) {}
+		CacheClientOperation(arena_pool, op_id, handle, socket) {}
 	void do_send_request(uint32_t cache_id, CacheDataType cache_data, uint32_t expire_time_ms)
 	{
-		CacheMessage* request = google::protobuf::Arena::CreateMessage<CacheMessage>(arena_.get());
-		CacheMessageRaii req_raii(request);
 		cache_id_ = cache_id;
-		cache_data_ = cache_data;
+		cache_data_ = std::move(cache_data);
+		send_request(expire_time_ms);
+	}
+	//server answers a resend of an update it keeps pending with kOperationDefer,
+	//resends stop then. one it applied already is answered with the result it
+	//got,the server keeps results for the deadline of the request,so an update
+	//is never applied twice
+	bool resend(uint32_t expire_time_ms) override {
+		if (deferred_)
+			return false;
+		send_request(expire_time_ms);
+		return true;
+	}
+protected:
+	void send_request(uint32_t expire_time_ms) {
+		//request is gone once sent,arena goes back to the pool
+		ArenaPtr arena = arena_pool_->acquire();
+		CacheMessage* request = google::protobuf::Arena::CreateMessage<CacheMessage>(arena.get());
+		CacheMessageRaii req_raii(request);
 		prepare_header(CacheMessageProto::kUpdateRequest, request);
 		prepare_request(request, expire_time_ms);
 		do_send_cache_message(socket_, request);
 	}
-protected:
 	void prepare_request(CacheMessage* message/*OUT*/, uint32_t expire_time_ms) override {
 		CacheMessageProto::CacheUpdateRequest* update_request = message->mutable_update_request();
 		update_request->set_cache_id(cache_id_);
@@ -129,28 +275,185 @@ protected:
 		update_request->set_timestamp(get_time_stamp());
 		update_request->set_expire(expire_time_ms);
 	}
+	//server doesn't echo the value,it is the one we sent
+	CacheDataType take_cache_data(CacheOpResponse* op_response) override {
+		return std::move(cache_data_);
+	}
 private:
 	CacheDataType cache_data_;
 };
 
+//
+// results of a many request come in one or more datagrams,each acked,
+// the operation is done when every key got its result
+class CacheClientManyOperation :public CacheClientOperation {
+public:
+	CacheClientManyOperation(std::shared_ptr<ArenaPool> arena_pool,
+		uint64_t op_id, ResultHandleType handle, std::shared_ptr<ProtoSocket> socket) :
+		CacheClientOperation(arena_pool, op_id, handle, socket), pending_() {}
+	bool process_response(CacheMessage* response) override {
+		PRINTF_MESSAGE_INFO("rcv", response);
+		CacheMessageRaii res_raii(response);
+		//results of a resent request or a datagram resent because our ack got
+		//lost are only acked again
+		for (CacheOpResponse& op_response : *response->mutable_op_responses()) {
+			auto it = pending_.find(op_response.cache_id());
+			if (it == pending_.end())
+				continue;
+			pending_.erase(it);
+			handle_((csn::OpResult)op_response.result(), local_expire(op_response), op_response.cache_id(),
+				op_response.version(), take_cache_data(&op_response));
+		}
+		do_send_ack(response);
+		return pending_.empty();
+	}
+	void expire() override {
+		std::unordered_multiset<uint32_t> pending = std::move(pending_);
+		for (uint32_t cache_id : pending)
+			handle_(csn::kOperationTimeout, 0, cache_id, 0, CacheDataType());
+	}
+protected:
+	//keys not answered yet,a key asked twice is answered twice
+	std::unordered_multiset<uint32_t> pending_;
+};
+
+class CacheClientReadManyOperation :public CacheClientManyOperation {
+public:
+	CacheClientReadManyOperation(std::shared_ptr<ArenaPool> arena_pool,
+		uint64_t op_id, ResultHandleType handle, std::shared_ptr<ProtoSocket> socket) :
+		CacheClientManyOperation(arena_pool, op_id, handle, socket) {}
+	//ids in [first,last) go in one datagram,caller keeps them under kMaxReadManyKeys
+	template <typename Iterator>
+	void do_send_request(Iterator first, Iterator last, uint32_t expire_time_ms)
+	{
+		pending_.insert(first, last);
+		send_request(first, last, expire_time_ms);
+	}
+	//only keys not answered yet are asked again
+	bool resend(uint32_t expire_time_ms) override {
+		std::vector<uint32_t> cache_ids(pending_.begin(), pending_.end());
+		send_request(cache_ids.begin(), cache_ids.end(), expire_time_ms);
+		return true;
+	}
+	bool rtt_sample() const override { return true; }
+private:
+	template <typename Iterator>
+	void send_request(Iterator first, Iterator last, uint32_t expire_time_ms)
+	{
+		ArenaPtr arena = arena_pool_->acquire();
+		CacheMessage* request = google::protobuf::Arena::CreateMessage<CacheMessage>(arena.get());
+		CacheMessageRaii req_raii(request);
+		prepare_header(CacheMessageProto::kReadManyRequest, request);
+		CacheReadManyRequest* read_many = request->mutable_read_many_request();
+		read_many->set_timestamp(get_time_stamp());
+		read_many->set_expire(expire_time_ms);
+		for (; first != last; ++first)
+			read_many->add_cache_ids(*first);
+		do_send_cache_message(socket_, request);
+	}
+};
+
+class CacheClientUpdateManyOperation :public CacheClientManyOperation {
+public:
+	CacheClientUpdateManyOperation(std::shared_ptr<ArenaPool> arena_pool,
+		uint64_t op_id, ResultHandleType handle, std::shared_ptr<ProtoSocket> socket) :
+		CacheClientManyOperation(arena_pool, op_id, handle, socket), values_() {}
+	//send items from first on,as many as fit one datagram(at least one),
+	//values sent are moved out of the items and kept for the results.
+	//never resent,items the server already deferred would be applied twice
+	//return: iterator to the first item not sent
+	template <typename Iterator>
+	Iterator do_send_request(Iterator first, Iterator last, uint32_t expire_time_ms)
+	{
+		ArenaPtr arena = arena_pool_->acquire();
+		CacheMessage* request = google::protobuf::Arena::CreateMessage<CacheMessage>(arena.get());
+		CacheMessageRaii req_raii(request);
+		prepare_header(CacheMessageProto::kUpdateManyRequest, request);
+		CacheUpdateManyRequest* update_many = request->mutable_update_many_request();
+		update_many->set_timestamp(get_time_stamp());
+		update_many->set_expire(expire_time_ms);
+		size_t size = 0;
+		for (; first != last; ++first) {
+			CacheUpdateItem* item = google::protobuf::Arena::CreateMessage<CacheUpdateItem>(arena.get());
+			item->set_cache_id(first->first);
+			item->set_cache_data(first->second);
+			size_t item_size = repeated_field_size(*item);
+			if (update_many->items_size() && size + item_size > kMaxUdpPacketSize - kMaxManyHeaderSize)
+				break;
+			update_many->mutable_items()->UnsafeArenaAddAllocated(item);
+			size += item_size;
+			pending_.insert(first->first);
+			values_[first->first] = std::move(first->second);
+		}
+		do_send_cache_message(socket_, request);
+		return first;
+	}
+protected:
+	//server doesn't echo values,each result gets the one we sent
+	CacheDataType take_cache_data(CacheOpResponse* op_response) override {
+		auto it = values_.find(op_response->cache_id());
+		if (unlikely(it == values_.end()))
+			return CacheDataType();
+		CacheDataType value = std::move(it->second);
+		values_.erase(it);
+		return value;
+	}
+private:
+	//keys are unique in an operation,update_many_async merges duplicates
+	std::unordered_map<uint32_t, CacheDataType> values_;
+};
+
+struct CacheClientStats {
+	uint64_t retransmits;
+	//operations given up with kOperationTimeout
+	uint64_t timeouts;
+	uint32_t srtt_ms;
+	uint32_t rto_ms;
+	size_t	 outstanding;
+};
+
+//
+// every operation is resent when no response comes within the rto of the server,
+// doubling its own rto each time,and answered kOperationTimeout at its deadline.
+// timers go to the TimerQueue of the thread constructing the client,the loop
+// receiving for it has to tick that queue
 class ProtobufMessageClientImpl :public MessageClientImpl {
+	enum ClientManyLimits {
+		//a packed cache id takes up to 5 bytes
+		kMaxReadManyKeys = 256,
+	};
 public:
+	enum ClientOperationDefault {
+		//deadline of a read,an update may wait out a whole lease on top of it
+		kDefaultOperationTimeout = 2000,
+	};
 	ProtobufMessageClientImpl(uint8_t datacenter_id, uint8_t worker_id) :
-		MessageClientImpl(), arena_(std::make_shared<google::protobuf::Arena>()),
-		requests_{}, snowflake_(datacenter_id, worker_id){}
-	void on_receive(const std::string& data) override
+		MessageClientImpl(), arena_pool_(std::make_shared<ArenaPool>()),
+		requests_{}, lease_cache_{}, snowflake_(datacenter_id, worker_id),
+		timers_(TimerQueue::get_timer_queue()), operation_timeout_(kDefaultOperationTimeout), rtt_(), stats_{} {}
+	~ProtobufMessageClientImpl() {
+		for (auto& request : requests_)
+			timers_->del_timer(request.second->timer_id());
+	}
+	void on_receive(std::string_view data) override
 	{
-		CacheMessage* message = google::protobuf::Arena::CreateMessage<CacheMessage>(arena_.get());
-		if (!message->ParseFromString(data))
+		ArenaPtr arena = arena_pool_->acquire();
+		CacheMessage* message = google::protobuf::Arena::CreateMessage<CacheMessage>(arena.get());
+		if (!message->ParseFromArray(data.data(), (int)data.size()))
 		{
-			LOG_OUT("error failure ParseFromString\n");
+			LOG_OUT("error failure ParseFromArray\n");
 			return;
 		}
 		if (unlikely(!header_available(message))) {
 			return;
 		}
 		const CacheMessageHeader& header = message->header();
-		auto iterator = requests_.find(header.op_id());
+		if (header.type() == CacheMessageProto::kInvalidateCache) {
+			on_invalidate(message);
+			return;
+		}
+		uint64_t op_id = header.op_id();
+		auto iterator = requests_.find(op_id);
 		if (iterator == requests_.end())
 		{
 			LOG_OUT("can't find match requests of op_id 0x%x!!!!!!\n", header.op_id());
@@ -158,29 +461,189 @@ public:
 			return;
 		}
 		//CacheClientOperation
-		iterator->second->process_response(message);
-		requests_.erase(iterator);
+		std::shared_ptr<CacheClientOperation> op = iterator->second;
+		int32_t rtt = op->take_rtt();
+		if (rtt >= 0)
+			rtt_.sample((uint32_t)rtt);
+		if (op->process_response(message)) {
+			timers_->del_timer(op->timer_id());
+			requests_.erase(op_id);
+		}
 	}
 	void read_cache_async(uint32_t cache_id, CallbackHandleType handle) override {
-		uint64_t op_id = snowflake_.generate_uniform_id();
-		std::shared_ptr<CacheClientReadOpration> op = std::make_shared<CacheClientReadOpration>(arena_,
-			op_id, std::move(handle), socket_);
-		requests_.emplace(op_id, op);
-		//TODO rynzen, temporary set 200ms expire time
-		op->do_send_request(cache_id, 200);
+		std::time_t expire{};
+		CacheDataType cache_data{};
+		bool renew = false;
+		//lease still valid,server guarantees no change,answer without round trip
+		if (lease_cache_.lookup(cache_id, &expire, &cache_data, &renew)) {
+			//lease near its end and key still read,renew it before it runs out
+			if (renew)
+				send_read(cache_id, nullptr);
+			handle(csn::kOperationOk, expire, cache_id, std::move(cache_data));
+			return;
+		}
+		send_read(cache_id, std::move(handle));
 	}
 	void update_cache_async(uint32_t cache_id, CacheDataType cache_data, CallbackHandleType handle) override {
+		//value is going to change,stop trusting local copy
+		lease_cache_.invalidate(cache_id);
 		uint64_t op_id = snowflake_.generate_uniform_id();
-		std::shared_ptr<CacheClientUpdateOpration> op = std::make_shared<CacheClientUpdateOpration>(arena_,
-			op_id, std::move(handle), socket_);
-		requests_.emplace(op_id, op);
-		//TODO rynzen, temporary set 200ms expire time
-		op->do_send_request(cache_id, std::move(cache_data), 200);
+		std::shared_ptr<CacheClientUpdateOpration> op = std::make_shared<CacheClientUpdateOpration>(arena_pool_,
+			op_id, lease_handle(std::move(handle)), socket_);
+		op->do_send_request(cache_id, std::move(cache_data), update_timeout());
+		start(op_id, op, update_timeout());
+	}
+	void read_many_async(const std::vector<uint32_t>& cache_ids, CallbackHandleType handle) override {
+		std::vector<uint32_t> missed{};
+		for (uint32_t cache_id : cache_ids) {
+			std::time_t expire{};
+			CacheDataType cache_data{};
+			if (lease_cache_.lookup(cache_id, &expire, &cache_data))
+				handle(csn::kOperationOk, expire, cache_id, std::move(cache_data));
+			else
+				missed.push_back(cache_id);
+		}
+		ResultHandleType leased = lease_handle(std::move(handle));
+		for (size_t first = 0; first < missed.size(); first += kMaxReadManyKeys) {
+			size_t last = std::min<size_t>(first + kMaxReadManyKeys, missed.size());
+			uint64_t op_id = snowflake_.generate_uniform_id();
+			std::shared_ptr<CacheClientReadManyOperation> op = std::make_shared<CacheClientReadManyOperation>(arena_pool_,
+				op_id, leased, socket_);
+			op->do_send_request(missed.begin() + first, missed.begin() + last, operation_timeout_);
+			start(op_id, op, operation_timeout_);
+		}
+	}
+	void update_many_async(CacheItems items, CallbackHandleType handle) override {
+		handle = merge_duplicates(items, std::move(handle));
+		for (auto& item : items)
+			lease_cache_.invalidate(item.first);
+		ResultHandleType leased = lease_handle(std::move(handle));
+		for (auto first = items.begin(); first != items.end();) {
+			uint64_t op_id = snowflake_.generate_uniform_id();
+			std::shared_ptr<CacheClientUpdateManyOperation> op = std::make_shared<CacheClientUpdateManyOperation>(arena_pool_,
+				op_id, leased, socket_);
+			first = op->do_send_request(first, items.end(), update_timeout());
+			start(op_id, op, update_timeout());
+		}
+	}
+	//deadline of operations started from now on
+	void set_operation_timeout(uint32_t timeout_ms) {
+		operation_timeout_ = std::max<uint32_t>(timeout_ms, 1);
+	}
+	CacheClientStats stats() const {
+		CacheClientStats stats = stats_;
+		stats.srtt_ms = rtt_.srtt();
+		stats.rto_ms = rtt_.rto();
+		stats.outstanding = requests_.size();
+		return stats;
 	}
 private:
-	std::shared_ptr<google::protobuf::Arena>  arena_;
+	using ResultHandleType=CacheClientOperation::ResultHandleType;
+	//a value held from an earlier lease is sent by version,server answers not
+	//modified when it's still current. handle:nullptr for a renewal nobody waits on
+	void send_read(uint32_t cache_id, CallbackHandleType handle) {
+		CacheDataType held{};
+		uint64_t version = lease_cache_.held(cache_id, &held);
+		uint64_t op_id = snowflake_.generate_uniform_id();
+		std::shared_ptr<CacheClientReadOpration> op = std::make_shared<CacheClientReadOpration>(arena_pool_,
+			op_id, lease_handle(std::move(handle)), socket_);
+		op->do_send_request(cache_id, operation_timeout_, version, std::move(held));
+		start(op_id, op, operation_timeout_);
+	}
+	uint32_t update_timeout() const {
+		return operation_timeout_ + kDefaultExpireMillisecond;
+	}
+	//op is sent,wait for its results
+	void start(uint64_t op_id, const std::shared_ptr<CacheClientOperation>& op, uint32_t timeout_ms) {
+		op->schedule(get_time_stamp(timeout_ms), rtt_.rto());
+		requests_.emplace(op_id, op);
+		arm(op_id, *op, std::min(op->rto(), timeout_ms));
+	}
+	void arm(uint64_t op_id, CacheClientOperation& op, uint32_t delay_ms) {
+		op.set_timer_id(timers_->add_timer([this, op_id]() { on_timer(op_id); }, std::max<uint32_t>(delay_ms, 1), 1));
+	}
+	//no response within rto,resend,or give up at the deadline
+	void on_timer(uint64_t op_id) {
+		auto iterator = requests_.find(op_id);
+		if (unlikely(iterator == requests_.end()))
+			return;
+		std::shared_ptr<CacheClientOperation> op = iterator->second;
+		op->set_timer_id(0);
+		int32_t left = expire_milliseconds_of_timestamp(op->deadline());
+		if (left <= 0) {
+			requests_.erase(iterator);
+			++stats_.timeouts;
+			op->expire();
+			return;
+		}
+		if (!op->resend((uint32_t)left)) {
+			arm(op_id, *op, (uint32_t)left);
+			return;
+		}
+		++stats_.retransmits;
+		op->backoff();
+		arm(op_id, *op, std::min<uint32_t>(op->rto(), (uint32_t)left));
+	}
+	//server is updating a key we hold a lease on,drop it and tell server we did
+	void on_invalidate(CacheMessage* message) {
+		PRINTF_MESSAGE_INFO("rcv", message);
+		CacheMessageRaii msg_raii(message);
+		lease_cache_.invalidate(message->invalidate().cache_id(), message->invalidate().version());
+		CacheMessage* ack = google::protobuf::Arena::CreateMessage<CacheMessage>(message->GetArena());
+		CacheMessageRaii ack_raii(ack);
+		ack->unsafe_arena_set_allocated_header(message->unsafe_arena_release_header());
+		ack->mutable_header()->set_type(CacheMessageProto::kOperationAck);
+		do_send_cache_message(socket_, ack);
+		PRINTF_MESSAGE_INFO("send", ack);
+	}
+	//a key given more than once is written once with its last value,results are
+	//matched by key,so every copy is answered with the result of that write
+	CallbackHandleType merge_duplicates(CacheItems& items, CallbackHandleType handle) {
+		std::unordered_map<uint32_t, size_t> last{};
+		last.reserve(items.size());
+		for (size_t i = 0; i < items.size(); ++i)
+			last[items[i].first] = i;
+		if (likely(last.size() == items.size()))
+			return handle;
+		auto copies = std::make_shared<std::unordered_map<uint32_t, uint32_t>>();
+		CacheItems merged{};
+		merged.reserve(last.size());
+		for (size_t i = 0; i < items.size(); ++i) {
+			if (last[items[i].first] == i)
+				merged.push_back(std::move(items[i]));
+			else
+				++(*copies)[items[i].first];
+		}
+		items = std::move(merged);
+		return [copies, handle = std::move(handle)](csn::OpResult result, std::time_t expire,
+			uint32_t cache_id, CacheDataType cache_data) {
+			auto it = copies->find(cache_id);
+			if (it != copies->end()) {
+				for (uint32_t i = 0; i < it->second; ++i)
+					handle(result, expire, cache_id, cache_data);
+				copies->erase(it);
+			}
+			handle(result, expire, cache_id, std::move(cache_data));
+		};
+	}
+	//remember leased value of a successful response before handing it to user
+	ResultHandleType lease_handle(CallbackHandleType handle) {
+		return [this, handle = std::move(handle)](csn::OpResult result, std::time_t expire,
+			uint32_t cache_id, uint64_t version, CacheDataType cache_data) {
+			if (result == csn::kOperationOk)
+				lease_cache_.store(cache_id, expire, cache_data, version);
+			if (handle)
+				handle(result, expire, cache_id, std::move(cache_data));
+		};
+	}
+	std::shared_ptr<ArenaPool>	arena_pool_;
 	std::map<uint64_t, std::shared_ptr<CacheClientOperation>> requests_;
+	LeaseCache<CacheDataType>	lease_cache_;
 	//to generate uniform id
 	SnowFlake	snowflake_;
+	TimerQueue*	timers_;
+	uint32_t	operation_timeout_;
+	RttEstimator rtt_;
+	CacheClientStats stats_;
 };
-CACHE_NAMESPACE_END
\ No newline at end of file
+CACHE_NAMESPACE_END
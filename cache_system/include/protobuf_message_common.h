@@ -21,6 +21,7 @@
  */
 #pragma once
 #include <type_traits>
+#include <google/protobuf/io/coded_stream.h>
 #include "cache_data_center.h"
 #include "common.h"
 #include "cache_message.pb.h"
@@ -31,13 +32,19 @@ using CacheMessageProto::CacheReadRequest;
 using CacheMessageProto::CacheUpdateRequest;
 using CacheMessageProto::CacheOpResponse;
 using CacheMessageProto::CacheMessage;
+using CacheMessageProto::CacheReadManyRequest;
+using CacheMessageProto::CacheUpdateManyRequest;
+using CacheMessageProto::CacheUpdateItem;
+using CacheMessageProto::CacheInvalidate;
+using CacheMessageProto::CacheReplicate;
+using CacheMessageProto::CacheReplicateItem;
 
 #define HEADER_VERSION      1
 #define HEADER_MAGIC        0x34EC27D9
-#define PRINTF_HEADER(t) 	LOG_OUT("MAGIC:0x%x version:%u type:0x%x op_id:0x%x", \
+#define PRINTF_HEADER(t) 	LOG_DEBUG("MAGIC:0x%x version:%u type:0x%x op_id:0x%x", \
 									t.magic(), t.version(), t.type(),t.op_id());
 
-#define PRINTF_MESSAGE_INFO(PREFIX,message) do { LOG_OUT(PREFIX " message type 0x%x op_id 0x%x", \
+#define PRINTF_MESSAGE_INFO(PREFIX,message) do { LOG_DEBUG(PREFIX " message type 0x%x op_id 0x%x", \
 								message->mutable_header()->type(),message->mutable_header()->op_id());}while(0)
 
 CACHE_NAMESPACE_BEGIN
@@ -45,6 +52,18 @@ CACHE_NAMESPACE_BEGIN
 //depend on this define of proto buffer cache_data ,current is std::string
 using CacheDataType=std::decay_t<decltype(std::declval<CacheOpResponse>().cache_data())>;
 
+enum CacheMessageLimits {
+	//a many request or response is split to fit one datagram
+	kMaxUdpPacketSize = 1492,
+	//room for header and the fixed fields of a many message
+	kMaxManyHeaderSize = 64,
+};
+//bytes one more element of a repeated message field adds to its parent
+inline size_t repeated_field_size(const google::protobuf::MessageLite& item) {
+	size_t size = item.ByteSizeLong();
+	return 1 + google::protobuf::io::CodedOutputStream::VarintSize32((uint32_t)size) + size;
+}
+
 template <typename Container>
 class ContainerIteratorRaii {
 	using iterator=typename Container::iterator;
@@ -56,22 +75,22 @@ private:
 	iterator   it_;
 };
 
+//detach sub messages shared with another message,message must live on an arena.
+//release_*() of an arena message hands out a heap copy nobody frees,
+//unsafe_arena_release_*() only drops the pointer,the arena still owns it
 class CacheMessageRaii
 {
 public:
 	CacheMessageRaii(CacheMessage* message) :message_(message) {}
 	~CacheMessageRaii() {
 		if (message_->has_header())
-			message_->release_header();
+			message_->unsafe_arena_release_header();
 		if (message_->has_read_request())
-			message_->release_read_request();
+			message_->unsafe_arena_release_read_request();
 		if (message_->has_update_request())
-			message_->release_update_request();
+			message_->unsafe_arena_release_update_request();
 		if (message_->has_op_response())
-			message_->release_op_response();
-		//request->unsafe_arena_release_update_request();
-		//response->unsafe_arena_release_header();
-		//response->unsafe_arena_release_op_response();
+			message_->unsafe_arena_release_op_response();
 	}
 private:
 	CacheMessage* message_;
@@ -90,7 +109,7 @@ inline bool header_available(CacheMessage* message) {
 		return false;
 	}
 	if (CacheMessageProto::CacheMessageType type = header.type();
-		(type< CacheMessageProto::kReadRequest || type > CacheMessageProto::kInvalidateCache)) {
+		(type< CacheMessageProto::kReadRequest || type > CacheMessageProto::kReplicateUpdates)) {
 		LOG_OUT("error type out of range 0x%x\n", type);
 		return false;
 	}
@@ -101,8 +120,11 @@ inline bool header_available(CacheMessage* message) {
 	return true;
 }
 
-inline uint16_t do_send_cache_message(const std::shared_ptr<ProtoSocket>& socket, const CacheMessage* message) {
-	static std::string str{};
+//peer:receiver,kNoPeer for the sender of the datagram being processed
+inline uint16_t do_send_cache_message(const std::shared_ptr<ProtoSocket>& socket, const CacheMessage* message,
+	PeerId peer = kNoPeer) {
+	//one serialize buffer per event loop thread
+	static thread_local std::string str{};
 	if (nullptr == socket || nullptr == message){
 		throw csn::Exception(csn::Exception::kErrorSysRoutine, "null socket or message");
 	}
@@ -110,6 +132,8 @@ inline uint16_t do_send_cache_message(const std::shared_ptr<ProtoSocket>& socket
 	if (str.size() == 0) {
 		throw csn::Exception(csn::Exception::kErrorSysRoutine, "SerializeToString() generate a zero length message");
 	}
-	return socket->do_send(str);
+	if (peer == kNoPeer)
+		return socket->do_send(str);
+	return socket->do_send_to(str, peer);
 }
 CACHE_NAMESPACE_END
\ No newline at end of file
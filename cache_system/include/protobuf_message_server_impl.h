@@ -25,27 +25,44 @@
 #include <string>
 #include <functional>
 #include <type_traits>
+#include <tuple>
+#include <deque>
 #include <google/protobuf/arena.h>
 #include "cache_data_center.h"
+#include "flat_hash_map.h"
 #include "common.h"
 #include "cache_message.pb.h"
 #include "socket_group.h"
 #include "protobuf_message_common.h"
 #include "message_server.h"
+#include "arena_pool.h"
+#include "snowflake.h"
+#include "cache_metrics.h"
 CACHE_NAMESPACE_BEGIN
 
-class WaitCacheAck :public CacheMessageRaii
+//keeps the response and the arena it lives in until the ack comes
+class WaitCacheAck
 {
 	using CustomCallHandler = std::function<void(void)>;
 public:
-	WaitCacheAck(const std::shared_ptr<ProtoSocket>& socket, CacheMessage* message, CustomCallHandler handle = nullptr) :
-		CacheMessageRaii(message), socket_(socket), message_(message), handle_(std::move(handle)), timer_id_() {}
+	//peer:receiver of message
+	//acked:called when the ack arrives
+	WaitCacheAck(const std::shared_ptr<ProtoSocket>& socket, CacheMessage* message, const ArenaPtr& arena,
+		PeerId peer = kNoPeer, CustomCallHandler acked = nullptr, CustomCallHandler handle = nullptr) :
+		arena_(arena), message_raii_(message), message_(message), socket_(socket), peer_(peer),
+		acked_(std::move(acked)), handle_(std::move(handle)), timer_id_(), sent_at_(CacheMetrics::now()) {}
 	~WaitCacheAck() = default;
 	//resend cache response message
 	void timer_handle() {
-		do_send_cache_message(socket_, message_);
-		if (likely(handle_!=nullptr))
-			handle_();
+		CacheMetrics::count(kMetricAckRetransmits);
+		resend();
+		//handle may drop the last reference to this
+		CustomCallHandler handle = handle_;
+		if (likely(handle != nullptr))
+			handle();
+	}
+	void resend() {
+		do_send_cache_message(socket_, message_, peer_);
 	}
 	void set_custom_handle(CustomCallHandler handle) {
 		handle_ = std::move(handle);
@@ -56,11 +73,24 @@ public:
 	std::size_t timer_id() {
 		return timer_id_;
 	}
+	const CustomCallHandler& acked_handle() {
+		return acked_;
+	}
+	uint64_t sent_at() const {
+		return sent_at_;
+	}
 private:
+	//arena_ before message_raii_,released after the message is detached
+	ArenaPtr arena_;
+	CacheMessageRaii message_raii_;
 	CacheMessage* message_;
 	std::shared_ptr<ProtoSocket> socket_;
+	PeerId peer_;
+	CustomCallHandler acked_;
 	CustomCallHandler handle_;
 	std::size_t timer_id_;
+	//CacheMetrics::now() of the first send
+	uint64_t sent_at_;
 };
 
 class CacheWaitAcktManager {
@@ -68,108 +98,192 @@ class CacheWaitAcktManager {
 		//500 ms expiretimer
 		kDefaultTimeout = 500,
 	};
+	//peer,op_id and sequence,op_ids of different clients may collide and
+	//datagrams of a many response are acked one by one
+	using AckKey=std::tuple<PeerId, uint64_t, uint32_t>;
+	using AckedHandler = std::function<void(void)>;
 public:
-	void register_wait_ack(const std::shared_ptr<ProtoSocket>& socket, CacheMessage* message)
+	void register_wait_ack(const std::shared_ptr<ProtoSocket>& socket, CacheMessage* message, const ArenaPtr& arena,
+		PeerId peer = kNoPeer, AckedHandler acked = nullptr)
 	{
 		if (unlikely(message == nullptr || !message->has_header()))
 			throw csn::Exception(csn::Exception::kErrorSysRoutine, "message or message header should not be null");
 
-		std::shared_ptr<WaitCacheAck> ack = std::make_shared<WaitCacheAck>(socket, message);
+		AckKey key(peer, message->header().op_id(), message->header().sequence());
+		//a retransmitted request answered again,the newer response replaces the old one
+		auto it = map_.find(key);
+		if (unlikely(it != map_.end())) {
+			csn::TimerQueue::get_timer_queue()->del_timer(it->second->timer_id());
+			map_.erase(it);
+		}
+		std::shared_ptr<WaitCacheAck> ack = std::make_shared<WaitCacheAck>(socket, message, arena, peer, std::move(acked));
 		std::size_t timer_id = csn::TimerQueue::get_timer_queue()->add_timer(\
 			std::bind(&WaitCacheAck::timer_handle, ack.get()), kDefaultTimeout, 1);
-		uint64_t op_id = message->header().op_id();
-		ack->set_custom_handle(std::bind(&CacheWaitAcktManager::expire_handle, this, op_id));
+		ack->set_custom_handle(std::bind(&CacheWaitAcktManager::expire_handle, this, key));
 		ack->set_timer_id(timer_id);
-		map_.emplace(op_id, ack);
+		map_.emplace(key, ack);
 	}
-	void unregister_wait_ack(uint64_t op_id) {
-		auto it = map_.find(op_id);
+	void unregister_wait_ack(PeerId peer, uint64_t op_id, uint32_t sequence) {
+		auto it = map_.find(AckKey(peer, op_id, sequence));
 		if (unlikely(it == map_.end())) {
 			//TODO rynzen, miss some race condition check
 			LOG_OUT("assume it was timeout and retransferred 0x%x", op_id);
+			CacheMetrics::count(kMetricAckUnmatched);
 			return;
 		}
+		CacheMetrics::record_since(kMetricAckRoundTrip, it->second->sent_at());
 
-		ContainerIteratorRaii(&map_,it);
-		std::size_t timer_id = it->second->timer_id();
-		csn::TimerQueue::get_timer_queue()->del_timer(timer_id);
+		AckedHandler acked = it->second->acked_handle();
+		{
+			ContainerIteratorRaii erase_raii(&map_, it);
+			std::size_t timer_id = it->second->timer_id();
+			csn::TimerQueue::get_timer_queue()->del_timer(timer_id);
+		}
+		//may register new acks,run it once the map is settled
+		if (acked)
+			acked();
+	}
+	//a request resent as its response got lost,answer with the response kept
+	//return: false when no response is waiting for an ack
+	bool resend_unacked(PeerId peer, uint64_t op_id, uint32_t sequence) {
+		auto it = map_.find(AckKey(peer, op_id, sequence));
+		if (it == map_.end())
+			return false;
+		CacheMetrics::count(kMetricAckResends);
+		it->second->resend();
+		return true;
 	}
+	//acks are registered on the TimerQueue of calling thread,so is the manager
 	static CacheWaitAcktManager* get_wait_ack_manager() {
-		static CacheWaitAcktManager mng{};
+		static thread_local CacheWaitAcktManager mng{};
 		return &mng;
 	}
 private:
-	void expire_handle(uint64_t op_id) {
-		auto it = map_.find(op_id);
+	void expire_handle(const AckKey& key) {
+		auto it = map_.find(key);
 		if (unlikely(it == map_.end())) {
 			throw csn::Exception(csn::Exception::kErrorSysRoutine, "WaitCacheAck should not be null");
 		}
 		map_.erase(it);
 	}
 	CacheWaitAcktManager() = default;
-	std::map < uint64_t, std::shared_ptr<WaitCacheAck>> map_;
+	std::map <AckKey, std::shared_ptr<WaitCacheAck>> map_;
 };
 class CacheOperationInterface {
+	enum ServerSnowFlake {
+		//op_id of server initiated messages
+		kServerDatacenterId = 0xFF,
+		kServerWorkerId = 0xFF,
+	};
 public:
 	CacheOperationInterface(const std::shared_ptr<csn::CacheDataCenter<CacheDataType>>& center) :
-		center_(center->shared_from_this()) {};
-	virtual void on_process(const std::shared_ptr<ProtoSocket>& socket, CacheMessage* request) {
+		center_(center->shared_from_this()), sequence_base_() {};
+	//peer:sender of request,responses and retransmits go back to it
+	//arena:owns request,keep it along with any message kept beyond this call
+	virtual void on_process(const std::shared_ptr<ProtoSocket>& socket, PeerId peer, CacheMessage* request, const ArenaPtr& arena) {
 		LOG_OUT("rcv other cache operation %u", request->mutable_header()->type());
 		CacheMessageRaii req_raii(request);
 	}
 	virtual ~CacheOperationInterface() = default;
+	//event loops sharing a port number their datagrams apart
+	void set_sequence_base(uint32_t sequence_base) { sequence_base_ = sequence_base; }
+	uint32_t sequence_base() const { return sequence_base_; }
 protected:
 	//set response body
 	void prepare_op_response(CacheMessage* response, std::time_t timestamp,
 		uint32_t cache_id, CacheDataType cache_data,
-		csn::OpResult ret)
+		csn::OpResult ret, uint64_t version = 0, bool not_modified = false)
 	{
-		CacheOpResponse* op_response = response->mutable_op_response();
-		op_response->set_expire(timestamp);
+		fill_op_response(response->mutable_op_response(), timestamp, cache_id, std::move(cache_data), ret,
+			version, not_modified);
+	}
+	//timestamp:lease end,kept whole,expire only carries the milliseconds left
+	//version:of the value read,not_modified:client holds it,cache_data is empty
+	void fill_op_response(CacheOpResponse* op_response, std::time_t timestamp,
+		uint32_t cache_id, CacheDataType cache_data,
+		csn::OpResult ret, uint64_t version = 0, bool not_modified = false)
+	{
+		op_response->set_timestamp(timestamp);
+		op_response->set_expire((uint32_t)std::max<int32_t>(expire_milliseconds_of_timestamp(timestamp), 0));
 		op_response->set_cache_id(cache_id);
 		op_response->set_cache_data(std::move(cache_data));
 		op_response->set_result(ret);
+		op_response->set_version(version);
+		op_response->set_not_modified(not_modified);
+	}
+	void register_wait_ack(const std::shared_ptr<ProtoSocket>& socket, CacheMessage* message, const ArenaPtr& arena,
+		PeerId peer = kNoPeer, std::function<void(void)> acked = nullptr)
+	{
+		CacheWaitAcktManager::get_wait_ack_manager()->register_wait_ack(socket, message, arena, peer, std::move(acked));
 	}
-	void register_wait_ack(const std::shared_ptr<ProtoSocket>& socket, CacheMessage* message)
+	void unregister_wait_ack(PeerId peer, uint64_t op_id, uint32_t sequence)
 	{
-		CacheWaitAcktManager::get_wait_ack_manager()->register_wait_ack(socket, message);
+		CacheWaitAcktManager::get_wait_ack_manager()->unregister_wait_ack(peer, op_id, sequence);
 	}
-	void unregister_wait_ack(uint64_t op_id)
+	bool resend_unacked(PeerId peer, uint64_t op_id, uint32_t sequence)
 	{
-		CacheWaitAcktManager::get_wait_ack_manager()->unregister_wait_ack(op_id);
+		return CacheWaitAcktManager::get_wait_ack_manager()->resend_unacked(peer, op_id, sequence);
+	}
+	static uint64_t next_invalidate_id() {
+		static thread_local SnowFlake snowflake(kServerDatacenterId, kServerWorkerId);
+		return snowflake.generate_uniform_id();
+	}
+	//ask holders of a deferred update's key to drop their copy,each ack counts
+	//toward committing the update early,messages live in arena of the update.
+	//version:the one replaced,a response still on its way granting a lease on
+	//it mustn't be trusted by a holder that acked
+	void push_invalidate(const std::shared_ptr<ProtoSocket>& socket, uint64_t invalidate_id, uint32_t cache_id,
+		uint64_t version, const std::vector<PeerId>& holders, const ArenaPtr& arena)
+	{
+		for (size_t i = 0; i < holders.size(); ++i) {
+			CacheMessage* message = google::protobuf::Arena::CreateMessage<CacheMessage>(arena.get());
+			CacheMessageHeader* header = message->mutable_header();
+			header->set_magic(HEADER_MAGIC);
+			header->set_version(HEADER_VERSION);
+			header->set_type(CacheMessageProto::kInvalidateCache);
+			header->set_op_id(invalidate_id);
+			header->set_sequence(sequence_base_ + (uint32_t)i);
+			message->mutable_invalidate()->set_cache_id(cache_id);
+			message->mutable_invalidate()->set_version(version);
+			register_wait_ack(socket, message, arena, holders[i], [center = center_, cache_id, invalidate_id]() {
+				center->invalidate_acked(cache_id, invalidate_id); });
+			PRINTF_MESSAGE_INFO("send", message);
+			do_send_cache_message(socket, message, holders[i]);
+		}
 	}
 	std::shared_ptr<csn::CacheDataCenter<CacheDataType>> center_;
+	uint32_t sequence_base_;
 };
 
 class CacheAckOperation :public CacheOperationInterface {
 public:
 	CacheAckOperation(const std::shared_ptr<csn::CacheDataCenter<CacheDataType>>& center) :
 		CacheOperationInterface(center) {};
-	void on_process(const std::shared_ptr<ProtoSocket>& socket, CacheMessage* request) override {
+	void on_process(const std::shared_ptr<ProtoSocket>& socket, PeerId peer, CacheMessage* request, const ArenaPtr& arena) override {
 		if (unlikely(!request || !request->has_header())) {
 			LOG_OUT("check ack failure !!!!");
 		}
 		PRINTF_MESSAGE_INFO("rcv", request);
 		CacheMessageRaii req_raii(request);
-		unregister_wait_ack(request->mutable_header()->op_id());
+		unregister_wait_ack(peer, request->header().op_id(), request->header().sequence());
 	}
 	~CacheAckOperation() = default;
 };
 class CacheReadRequestOperation :public CacheOperationInterface {
 public:
 	CacheReadRequestOperation(const std::shared_ptr<csn::CacheDataCenter<CacheDataType>>& center) :
-		CacheOperationInterface(center), timestamp_(), cache_id_(), cache_data_(), ret_() {}
-	void on_process(const std::shared_ptr<ProtoSocket>& socket, CacheMessage* request) override {
+		CacheOperationInterface(center), timestamp_(), cache_id_(), cache_data_(), version_(), not_modified_(), ret_() {}
+	void on_process(const std::shared_ptr<ProtoSocket>& socket, PeerId peer, CacheMessage* request, const ArenaPtr& arena) override {
 		if (unlikely(!request || !request->has_read_request())) {
 			LOG_OUT("check read_request failure !!!!");
 			return;
 		}
 		PRINTF_MESSAGE_INFO("rcv", request);
 		CacheMessageRaii req_raii(request);
-		query_cache_center(request);
+		CacheMetrics::count_result(kMetricReadResults, query_cache_center(request, peer));
 		CacheMessage* response = prepare_response_message(request);
-		register_wait_ack(socket, response);
-		do_send_cache_message(socket, response);
+		register_wait_ack(socket, response, arena, peer);
+		do_send_cache_message(socket, response, peer);
 		PRINTF_MESSAGE_INFO("send", response);
 	}
 	~CacheReadRequestOperation() = default;
@@ -186,18 +300,26 @@ private:
 		CacheMessageHeader* header = response->mutable_header();
 		header->set_type(CacheMessageProto::kReadResponse);
 		//set response body
-		prepare_op_response(response, timestamp_, cache_id_, cache_data_, ret_);
+		prepare_op_response(response, timestamp_, cache_id_, std::move(cache_data_), ret_, version_, not_modified_);
 		return response;
 	}
-	csn::OpResult query_cache_center(CacheMessage* message) {
+	csn::OpResult query_cache_center(CacheMessage* message, PeerId peer) {
 		cache_id_ = message->read_request().cache_id();
-		ret_ = center_->read_op(cache_id_, message->header().op_id(), &timestamp_, &cache_data_);
+		//client asks to renew the lease on a version it holds,only a newer value is sent
+		uint64_t held = message->read_request().version();
+		version_ = held;
+		ret_ = center_->read_op(cache_id_, message->header().op_id(), &timestamp_, &cache_data_, peer, &version_);
+		not_modified_ = ret_ == csn::kOperationOk && held && version_ == held;
+		if (not_modified_)
+			CacheMetrics::count(kMetricReadsNotModified);
 		return ret_;
 	}
 private:
 	std::time_t   timestamp_;
 	uint32_t      cache_id_;
 	CacheDataType   cache_data_;
+	uint64_t      version_;
+	bool          not_modified_;
 	csn::OpResult ret_;
 };
 
@@ -205,26 +327,83 @@ class CacheUpdateRequestOperation :public CacheOperationInterface {
 	struct UpdateResult {
 		std::time_t     timestamp;
 		uint32_t        cache_id;
-		CacheDataType   cache_data;
 		csn::OpResult   ret;
 	};
+	//request waiting for the lease to end,holds its arena
+	struct DeferMessage {
+		CacheMessage*	message;
+		ArenaPtr		arena;
+		//commit at the latest
+		std::time_t		expire;
+		//CacheMetrics::now() when it was deferred
+		uint64_t		deferred_at;
+		//client gives up on the update then
+		std::time_t		deadline;
+	};
+	//op_ids of different clients may collide
+	using DeferKey=std::pair<PeerId, uint32_t>;
+	//result of an applied update,peer and op_id tell it from another pair
+	//mixing to the same key
+	struct CompletedUpdate {
+		PeerId			peer;
+		uint64_t		op_id;
+		std::time_t		deadline;
+		UpdateResult	result;
+	};
+	//completed_ in completion order,a deadline shorter than one before it
+	//waits for that one to be swept
+	struct CompletedDue {
+		std::time_t		deadline;
+		uint64_t		key;
+	};
 public:
 	CacheUpdateRequestOperation(const std::shared_ptr<csn::CacheDataCenter<CacheDataType>>& center) :
-		CacheOperationInterface(center),defer_messages_() {}
+		CacheOperationInterface(center), defer_messages_(), completed_(), completed_due_(), holders_() {}
 	~CacheUpdateRequestOperation() = default;
-	void on_process(const std::shared_ptr<ProtoSocket>& socket, CacheMessage* request) {
+	void on_process(const std::shared_ptr<ProtoSocket>& socket, PeerId peer, CacheMessage* request, const ArenaPtr& arena) override {
 		if (unlikely(!request || !request->has_update_request())) {
 			LOG_OUT("check update_request failure !!!!");
 			return;
 		}
 		PRINTF_MESSAGE_INFO("rcv", request);
 		UpdateResult result{};
-		if (update_cache_center(request,socket,&result) != csn::kOperationDefer) {
+		//client resent an update whose response got lost,applying it again
+		//would wait out the lease it was just granted
+		if (unlikely(resend_unacked(peer, request->header().op_id(), request->header().sequence()))) {
 			CacheMessageRaii req_raii(request);
+			return;
+		}
+		//client resent an update we keep pending,tell it to wait for the commit
+		//instead of updating again,no ack expected
+		auto deferred = defer_messages_.find(DeferKey(peer, (uint32_t)request->header().op_id()));
+		if (unlikely(deferred != defer_messages_.end())) {
+			CacheMessageRaii req_raii(request);
+			result.cache_id = request->update_request().cache_id();
+			result.ret = csn::kOperationDefer;
+			result.timestamp = deferred->second.expire;
 			CacheMessage* response = prepare_response_message(request, result);
-			register_wait_ack(socket, response);
+			CacheMessageRaii res_raii(response);
+			do_send_cache_message(socket, response, peer);
+			return;
+		}
+		//client resent an update applied already whose acked response got lost on
+		//the way,or a copy came late. applying it again would overwrite any update
+		//committed since,answer with the result it got,no ack expected
+		const UpdateResult* completed = find_completed(peer, request->header().op_id());
+		if (unlikely(completed != nullptr)) {
+			CacheMessageRaii req_raii(request);
+			CacheMessage* response = prepare_response_message(request, *completed);
+			CacheMessageRaii res_raii(response);
+			do_send_cache_message(socket, response, peer);
+			return;
+		}
+		if (update_cache_center(request, arena, socket, peer, &result) != csn::kOperationDefer) {
+			CacheMessageRaii req_raii(request);
+			complete(peer, request->header().op_id(), result, get_time_stamp(request->update_request().expire()));
+			CacheMessage* response = prepare_response_message(request, result);
+			register_wait_ack(socket, response, arena, peer);
 			PRINTF_MESSAGE_INFO("send", response);
-			do_send_cache_message(socket, response);
+			do_send_cache_message(socket, response, peer);
 		}
 	}
 private:
@@ -240,78 +419,277 @@ private:
 		CacheMessageHeader* header = response->mutable_header();
 		header->set_type(CacheMessageProto::kUpdateResponse);
 
-		prepare_op_response(response, result.timestamp, result.cache_id, result.cache_data, result.ret);
+		prepare_op_response(response, result.timestamp, result.cache_id, CacheDataType(), result.ret);
 		return response;
 	}
-	void update_handle(std::shared_ptr<ProtoSocket> socket, csn::OpResult ret, uint32_t op_id, std::time_t expire) {
-		using iterator=std::map<uint32_t, CacheMessage*>::iterator;
+	void update_handle(std::shared_ptr<ProtoSocket> socket, PeerId peer, csn::OpResult ret, uint32_t op_id, std::time_t expire) {
+		using iterator=std::map<DeferKey, DeferMessage>::iterator;
 		if (unlikely(ret != csn::OpResult::kOperationOk)) {
 			throw csn::Exception(csn::Exception::kErrorSysRoutine, "update callback throw a routine error");
 		}
-		iterator it = defer_messages_.find(op_id);
+		iterator it = defer_messages_.find(DeferKey(peer, op_id));
 		if (unlikely(it == defer_messages_.end())) {
 			throw csn::Exception(csn::Exception::kErrorSysRoutine, "defer_messages_ should not be null");
 		}
+		CacheMetrics::count_result(kMetricUpdateResults, ret);
+		CacheMetrics::record_since(kMetricDeferWait, it->second.deferred_at);
 		//should be before CacheMessageRaii
-		ContainerIteratorRaii(&defer_messages_, it);
-		CacheMessage* message = it->second;
+		ContainerIteratorRaii erase_raii(&defer_messages_, it);
+		CacheMessage* message = it->second.message;
+		const ArenaPtr& arena = it->second.arena;
 		CacheMessageRaii msg_raii(message);
 		UpdateResult result{};
 		
 		result.cache_id = message->update_request().cache_id();
 		result.ret = ret;
 		result.timestamp = expire;
-		result.cache_data = message->update_request().cache_data();
+		complete(peer, message->header().op_id(), result, it->second.deadline);
 
+		//lease ended on a timer,the socket's current remote is somebody else by now
 		CacheMessage* response = prepare_response_message(message, result);
-		register_wait_ack(socket, response);
+		register_wait_ack(socket, response, arena, peer);
 		PRINTF_MESSAGE_INFO("send", response);
-		do_send_cache_message(socket, response);
+		do_send_cache_message(socket, response, peer);
+	}
+	static uint64_t completed_key(PeerId peer, uint64_t op_id) {
+		return op_id ^ ((uint64_t)peer * 0x9E3779B97F4A7C15ull);
+	}
+	//return: nullptr when op_id of peer wasn't applied or its client gave up
+	const UpdateResult* find_completed(PeerId peer, uint64_t op_id) {
+		CompletedUpdate* completed = completed_.find(completed_key(peer, op_id));
+		if (likely(!completed) || completed->peer != peer || completed->op_id != op_id
+			|| completed->deadline <= get_time_stamp())
+			return nullptr;
+		return &completed->result;
+	}
+	//resends of an answered update get result until the client gives up on it
+	//deadline:of the client,from the expire it sent
+	void complete(PeerId peer, uint64_t op_id, const UpdateResult& result, std::time_t deadline) {
+		std::time_t now = get_time_stamp();
+		while (!completed_due_.empty() && completed_due_.front().deadline <= now) {
+			const CompletedDue& due = completed_due_.front();
+			CompletedUpdate* completed = completed_.find(due.key);
+			//the key may have been taken by a later update since
+			if (completed && completed->deadline == due.deadline)
+				completed_.erase(due.key);
+			completed_due_.pop_front();
+		}
+		if (deadline <= now)
+			return;
+		uint64_t key = completed_key(peer, op_id);
+		*completed_.try_emplace(key).first = CompletedUpdate{ peer, op_id, deadline, result };
+		completed_due_.push_back(CompletedDue{ deadline, key });
 	}
 	//result:no stuff when return csn::kOperationDefer
-	csn::OpResult update_cache_center(CacheMessage* message, std::shared_ptr<ProtoSocket> socket, UpdateResult* result) {
+	csn::OpResult update_cache_center(CacheMessage* message, const ArenaPtr& arena,
+		std::shared_ptr<ProtoSocket> socket, PeerId peer, UpdateResult* result) {
 		using namespace std::placeholders;
 		CacheUpdateRequest* request = message->mutable_update_request();
 		uint32_t op_id = message->header().op_id();
+		uint64_t invalidate_id = next_invalidate_id();
+		uint64_t version = 0;
 		OpResult ret{};
-		ret = center_->update_op(request->cache_id(), request->cache_data(),
-			op_id, std::bind(&CacheUpdateRequestOperation::update_handle, this, socket, _1, _2, _3),
-			&result->timestamp);
+		holders_.clear();
+		//value moves from the arena into the store,response doesn't echo it
+		ret = center_->update_op(request->cache_id(), std::move(*request->mutable_cache_data()),
+			op_id, std::bind(&CacheUpdateRequestOperation::update_handle, this, socket, peer, _1, _2, _3),
+			&result->timestamp, peer, invalidate_id, &holders_, &version);
+		CacheMetrics::count_result(kMetricUpdateResults, ret);
 		if (ret == csn::kOperationDefer) {
-			defer_messages_.emplace(op_id, message);
+			defer_messages_.emplace(DeferKey(peer, op_id), DeferMessage{ message, arena, result->timestamp, CacheMetrics::now(),
+				get_time_stamp(request->expire()) });
+			push_invalidate(socket, invalidate_id, request->cache_id(), version, holders_, arena);
 		}
 		else {
 			result->cache_id = request->cache_id();
 			result->ret= ret;
-			result->cache_data = request->cache_data();
 		}
 		return ret;
 	}
 private:
-	std::map<uint32_t, CacheMessage*> defer_messages_;
+	std::map<DeferKey, DeferMessage> defer_messages_;
+	//results of updates applied,kept until the client's deadline,by completed_key
+	FlatHashMap<CompletedUpdate> completed_;
+	std::deque<CompletedDue> completed_due_;
+	//lease holders to invalidate,reused across requests
+	std::vector<PeerId> holders_;
+};
+
+//
+// a many request is answered with as few datagrams as fit under kMaxUdpPacketSize,
+// each numbered by header sequence and waiting for its own ack.
+class CacheManyOperation :public CacheOperationInterface {
+public:
+	CacheManyOperation(const std::shared_ptr<csn::CacheDataCenter<CacheDataType>>& center) :
+		CacheOperationInterface(center) {}
+protected:
+	//what answering one many request needs,deferred results keep it alive
+	struct ManyContext {
+		std::shared_ptr<ProtoSocket> socket;
+		PeerId						 peer;
+		CacheMessageHeader			 header;
+		CacheMessageProto::CacheMessageType type;
+		ArenaPtr					 arena;
+		uint32_t					 sequence;
+	};
+	//packs results into the current datagram,sends it when next one doesn't fit
+	class ManyResponse {
+	public:
+		ManyResponse(CacheManyOperation& op, const std::shared_ptr<ManyContext>& context) :
+			op_(op), context_(context), response_(nullptr), size_() {}
+		~ManyResponse() = default;
+		void add(std::time_t timestamp, uint32_t cache_id, CacheDataType cache_data, csn::OpResult ret, uint64_t version = 0) {
+			CacheOpResponse* op_response = google::protobuf::Arena::CreateMessage<CacheOpResponse>(context_->arena.get());
+			op_.fill_op_response(op_response, timestamp, cache_id, std::move(cache_data), ret, version);
+			size_t item_size = repeated_field_size(*op_response);
+			if (response_ && size_ + item_size > kMaxUdpPacketSize - kMaxManyHeaderSize)
+				flush();
+			if (!response_) {
+				response_ = op_.new_response(context_.get());
+				size_ = 0;
+			}
+			response_->mutable_op_responses()->UnsafeArenaAddAllocated(op_response);
+			size_ += item_size;
+		}
+		void flush() {
+			if (!response_)
+				return;
+			op_.register_wait_ack(context_->socket, response_, context_->arena, context_->peer);
+			PRINTF_MESSAGE_INFO("send", response_);
+			do_send_cache_message(context_->socket, response_, context_->peer);
+			response_ = nullptr;
+		}
+	private:
+		CacheManyOperation&			 op_;
+		std::shared_ptr<ManyContext> context_;
+		CacheMessage*				 response_;
+		size_t						 size_;
+	};
+	std::shared_ptr<ManyContext> make_context(const std::shared_ptr<ProtoSocket>& socket, PeerId peer,
+		const CacheMessage* request, CacheMessageProto::CacheMessageType type, const ArenaPtr& arena) {
+		return std::make_shared<ManyContext>(ManyContext{ socket, peer, request->header(), type, arena, 0 });
+	}
+private:
+	CacheMessage* new_response(ManyContext* context) {
+		CacheMessage* response = google::protobuf::Arena::CreateMessage<CacheMessage>(context->arena.get());
+		CacheMessageHeader* header = response->mutable_header();
+		header->CopyFrom(context->header);
+		header->set_type(context->type);
+		header->set_sequence(sequence_base_ + context->sequence++);
+		return response;
+	}
+};
+
+class CacheReadManyOperation :public CacheManyOperation {
+public:
+	CacheReadManyOperation(const std::shared_ptr<csn::CacheDataCenter<CacheDataType>>& center) :
+		CacheManyOperation(center) {}
+	void on_process(const std::shared_ptr<ProtoSocket>& socket, PeerId peer, CacheMessage* request, const ArenaPtr& arena) override {
+		if (unlikely(!request || !request->has_read_many_request())) {
+			LOG_OUT("check read_many_request failure !!!!");
+			return;
+		}
+		PRINTF_MESSAGE_INFO("rcv", request);
+		CacheMessageRaii req_raii(request);
+		uint32_t op_id = (uint32_t)request->header().op_id();
+		ManyResponse response(*this, make_context(socket, peer, request, CacheMessageProto::kReadManyResponse, arena));
+		//one pass over the keys,results packed as they come
+		for (uint32_t cache_id : request->read_many_request().cache_ids()) {
+			std::time_t timestamp{};
+			CacheDataType cache_data{};
+			uint64_t version = 0;
+			csn::OpResult ret = center_->read_op(cache_id, op_id, &timestamp, &cache_data, peer, &version);
+			CacheMetrics::count_result(kMetricReadResults, ret);
+			response.add(timestamp, cache_id, std::move(cache_data), ret, version);
+		}
+		response.flush();
+	}
+	~CacheReadManyOperation() = default;
+};
+
+class CacheUpdateManyOperation :public CacheManyOperation {
+public:
+	CacheUpdateManyOperation(const std::shared_ptr<csn::CacheDataCenter<CacheDataType>>& center) :
+		CacheManyOperation(center), holders_() {}
+	void on_process(const std::shared_ptr<ProtoSocket>& socket, PeerId peer, CacheMessage* request, const ArenaPtr& arena) override {
+		using namespace std::placeholders;
+		if (unlikely(!request || !request->has_update_many_request())) {
+			LOG_OUT("check update_many_request failure !!!!");
+			return;
+		}
+		PRINTF_MESSAGE_INFO("rcv", request);
+		CacheMessageRaii req_raii(request);
+		uint32_t op_id = (uint32_t)request->header().op_id();
+		std::shared_ptr<ManyContext> context = make_context(socket, peer, request, CacheMessageProto::kUpdateManyResponse, arena);
+		ManyResponse response(*this, context);
+		for (CacheUpdateItem& item : *request->mutable_update_many_request()->mutable_items()) {
+			std::time_t timestamp{};
+			uint64_t invalidate_id = next_invalidate_id();
+			uint64_t version = 0;
+			holders_.clear();
+			//value moves into the store,results carry the cache id only
+			csn::OpResult ret = center_->update_op(item.cache_id(), std::move(*item.mutable_cache_data()), op_id,
+				std::bind(&CacheUpdateManyOperation::update_handle, this, context, item.cache_id(), CacheMetrics::now(), _1, _2, _3),
+				&timestamp, peer, invalidate_id, &holders_, &version);
+			CacheMetrics::count_result(kMetricUpdateResults, ret);
+			if (ret != csn::kOperationDefer)
+				response.add(timestamp, item.cache_id(), CacheDataType(), ret);
+			else
+				push_invalidate(socket, invalidate_id, item.cache_id(), version, holders_, arena);
+		}
+		response.flush();
+	}
+	~CacheUpdateManyOperation() = default;
+private:
+	//lease holders to invalidate,reused across items
+	std::vector<PeerId> holders_;
+	//lease of a key ended,its result goes in a datagram of its own
+	//deferred_at:CacheMetrics::now() when the item was deferred
+	void update_handle(const std::shared_ptr<ManyContext>& context, uint32_t cache_id, uint64_t deferred_at,
+		csn::OpResult ret, uint32_t op_id, std::time_t expire) {
+		CacheMetrics::count_result(kMetricUpdateResults, ret);
+		CacheMetrics::record_since(kMetricDeferWait, deferred_at);
+		ManyResponse response(*this, context);
+		response.add(expire, cache_id, CacheDataType(), ret);
+		response.flush();
+	}
 };
 
 
 class ProtobufMessageServerImpl :public MessageServerImpl {
 	enum CacheMessageCount {
-		kCacheMessageCount = (CacheMessageProto::kInvalidateCache - CacheMessageProto::kReadRequest + 1),
+		kCacheMessageCount = (CacheMessageProto::kReplicateUpdates - CacheMessageProto::kReadRequest + 1),
 	};
 public:
-	ProtobufMessageServerImpl() :MessageServerImpl{},arena_ {}, 
-		center_(std::make_shared<CacheDataCenter<CacheDataType>>()),
+	//return false when request is taken over by somebody else(e.g. handed off to
+	//the event loop owning its key) and must not be processed here
+	using DispatchFilter = std::function<bool(std::string_view data, CacheMessage* request)>;
+	ProtobufMessageServerImpl() :ProtobufMessageServerImpl(std::make_shared<CacheDataCenter<CacheDataType>>()) {}
+	//center:may be shared with other server instances
+	explicit ProtobufMessageServerImpl(std::shared_ptr<CacheDataCenter<CacheDataType>> center) :
+		MessageServerImpl{}, arena_pool_(std::make_shared<ArenaPool>()),
+		center_(center), filter_(),
 		message_op_{
 		std::make_shared<CacheReadRequestOperation>(center_),
 		std::make_shared<CacheOperationInterface>(center_),
 		std::make_shared<CacheUpdateRequestOperation>(center_),
 		std::make_shared<CacheOperationInterface>(center_),
 		std::make_shared<CacheAckOperation>(center_),
+		std::make_shared<CacheOperationInterface>(center_),
+		std::make_shared<CacheReadManyOperation>(center_),
+		std::make_shared<CacheOperationInterface>(center_),
+		std::make_shared<CacheUpdateManyOperation>(center_),
+		std::make_shared<CacheOperationInterface>(center_),
 		std::make_shared<CacheOperationInterface>(center_)
 	}{}
 	~ProtobufMessageServerImpl() = default;
-	void on_receive(const std::string& data) override
+	void on_receive(std::string_view data) override
 	{
-		CacheMessage* request = google::protobuf::Arena::CreateMessage<CacheMessage>(&arena_);
-		if (unlikely(!request->ParseFromString(data) || !header_available(request)))
+		//request and everything answering it share one recycled arena
+		ArenaPtr arena = arena_pool_->acquire();
+		CacheMessage* request = google::protobuf::Arena::CreateMessage<CacheMessage>(arena.get());
+		//parsed from the receive buffer,bytes fields are copied once into the arena
+		if (unlikely(!request->ParseFromArray(data.data(), (int)data.size()) || !header_available(request)))
 		{
 			LOG_OUT("error parsing message\n");
 			return;
@@ -320,12 +698,42 @@ public:
 		uint32_t index = (uint32_t)(request->header().type() - CacheMessageProto::kReadRequest);
 		if (unlikely(index >= kCacheMessageCount))
 			throw csn::Exception(csn::Exception::kErrorSysRoutine, "message type out of range !!!!!!!");
-		message_op_[index]->on_process(socket_, request);
+		if (filter_ && !filter_(data, request))
+			return;
+		uint64_t start = CacheMetrics::now();
+		message_op_[index]->on_process(socket_, socket_->remote_peer(), request, arena);
+		if (kLatencyOf[index] != kMetricHistogramCount)
+			CacheMetrics::record_since(kLatencyOf[index], start);
 	}
 	std::shared_ptr<csn::CacheDataCenter<CacheDataType>> data_center() { return center_; }
+	void set_dispatch_filter(DispatchFilter filter) { filter_ = std::move(filter); }
+	//messages of type are processed by op from now on
+	void set_operation(CacheMessageProto::CacheMessageType type, std::shared_ptr<CacheOperationInterface> op) {
+		uint32_t index = (uint32_t)(type - CacheMessageProto::kReadRequest);
+		if (unlikely(index >= kCacheMessageCount || !op))
+			throw csn::Exception(csn::Exception::kErrorIllArgument, "set_operation of an unknown message type");
+		op->set_sequence_base(message_op_[index]->sequence_base());
+		message_op_[index] = std::move(op);
+	}
+	//server instances sharing a port tag datagrams of many responses and
+	//invalidations apart
+	void set_sequence_base(uint32_t sequence_base) {
+		for (auto& op : message_op_)
+			op->set_sequence_base(sequence_base);
+	}
 private:
-	google::protobuf::Arena arena_;
+	//latency histogram of each message type,kMetricHistogramCount for none
+	static constexpr MetricHistogram kLatencyOf[kCacheMessageCount] = {
+		kMetricReadLatency, kMetricHistogramCount,
+		kMetricUpdateLatency, kMetricHistogramCount,
+		kMetricAckLatency, kMetricHistogramCount,
+		kMetricReadManyLatency, kMetricHistogramCount,
+		kMetricUpdateManyLatency, kMetricHistogramCount,
+		kMetricHistogramCount,
+	};
+	std::shared_ptr<ArenaPool> arena_pool_;
 	std::shared_ptr<csn::CacheDataCenter<CacheDataType>> center_;
+	DispatchFilter			filter_;
 	std::array<std::shared_ptr<CacheOperationInterface>, kCacheMessageCount> message_op_;
 };
 CACHE_NAMESPACE_END
\ No newline at end of file
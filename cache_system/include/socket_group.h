@@ -23,15 +23,25 @@
 #include <memory>
 #include <functional>
 #include <type_traits>
+#include <vector>
+#include <string_view>
+#include <algorithm>
 #include <stdint.h>
+#include "timer_queue.h"
 
 CACHE_NAMESPACE_BEGIN
 //! Socket abstraction layer
 class ProtoSocket:public std::enable_shared_from_this<ProtoSocket> {
 public:
 	virtual ~ProtoSocket() = default;
-	virtual void on_receive(const std::string& data) = 0;
+	//data:one whole datagram,only valid during the call
+	virtual void on_receive(std::string_view data) = 0;
 	virtual uint16_t do_send(const std::string& data) = 0;
+	//peer that sent the datagram being processed
+	virtual PeerId remote_peer() { return kNoPeer; }
+	//send to a peer seen before,kNoPeer or a socket not telling peers apart
+	//sends to current remote
+	virtual uint16_t do_send_to(const std::string& data, PeerId peer) { return do_send(data); }
 	virtual void initialize(const std::string& host_local, uint16_t local_port,
 		const std::string& remote_host, uint16_t remote_port)=0;
 };
@@ -46,7 +56,25 @@ public:
 	virtual ~SocketGroupImpl() = default;
 	virtual void register_socket(std::shared_ptr<SocketType> socket) = 0;
 	virtual void unregister_socket(std::shared_ptr<SocketType> socket) = 0;
+	//waitUpToSeconds < 0: wait until a socket is readable or a timer source is due
 	virtual void listen(double waitUpToSeconds = 0.0) = 0;
+	//source bounds the wait of listen() and is ticked by it,must outlive the group
+	void add_timer_source(TimerSource* source) {
+		timer_sources_.push_back(source);
+	}
+protected:
+	//return: milliseconds to wait,-1 for infinite
+	int wait_timeout_ms(double waitUpToSeconds) {
+		uint32_t timeout = waitUpToSeconds < 0 ? TimerSource::kTimerIdle : (uint32_t)(waitUpToSeconds * 1000);
+		for (TimerSource* source : timer_sources_)
+			timeout = std::min(timeout, source->next_timeout_ms());
+		return timeout == TimerSource::kTimerIdle ? -1 : (int)std::min<uint32_t>(timeout, 0x7FFFFFFF);
+	}
+	void tick_timer_sources() {
+		for (TimerSource* source : timer_sources_)
+			source->tick();
+	}
+	std::vector<TimerSource*> timer_sources_;
 };
 
 template <class SocketGroupImplType>
@@ -75,6 +103,14 @@ public:
 			throw csn::Exception(csn::Exception::kErrorIllUsage, "impl should be set first !!!");
 		impl_->listen(waitUpToSeconds);
 	}
+	//timers of source expire from listen(),which wakes up in time for them
+	void add_timer_source(TimerSource* source) {
+		if (source == nullptr)
+			throw csn::Exception(csn::Exception::kErrorSysRoutine, "insert a nullptr");
+		if (!impl_)
+			throw csn::Exception(csn::Exception::kErrorIllUsage, "impl should be set first !!!");
+		impl_->add_timer_source(source);
+	}
 private:
 	std::shared_ptr<SocketGroupImplType> impl_;
 };
@@ -0,0 +1,113 @@
+/*
+ * socket_group_epoll_impl.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: rynzen <chuanrui123@126.com>
+ *
+ *  This file is part of a cache system of lease mechanism implemenation.
+ *
+ *  socket_group_epoll_impl.h is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  socket_group_epoll_impl.h is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with consistent_hashing.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+#include <unordered_map>
+#include <vector>
+#include <functional>
+#include "common.h"
+#include "socket_group.h"
+#include "socket_group_mmsg_impl.h"
+
+#include <sys/epoll.h>
+
+CACHE_NAMESPACE_BEGIN
+//
+// event loop on epoll,the wait of listen() ends at the next deadline of the
+// registered timer sources,so lease expire and ack retransmit fire on time
+// and an idle loop sleeps instead of spinning.
+// Example:
+//		SocketGroup<SocketGroupEpollImpl> group{};
+//		group.add_timer_source(TimerQueue::get_timer_queue());
+//		group.add_timer_source(center.get());
+//		group.register_socket(server);
+//		while (true)
+//			group.listen(-1);
+class SocketGroupEpollImpl :public SocketGroupImpl<MmsgUdpSocket> {
+	enum {
+		kMaxEvents = 64,
+	};
+public:
+	using ReadableHandler = std::function<void(void)>;
+	SocketGroupEpollImpl() :epoll_fd_(::epoll_create1(EPOLL_CLOEXEC)), sockets_{}, handlers_{}, events_(kMaxEvents)
+	{
+		if (epoll_fd_ < 0)
+			throw csn::Exception(csn::Exception::kErrorSysRoutine, "epoll_create1 failure");
+	}
+	~SocketGroupEpollImpl() {
+		::close(epoll_fd_);
+	}
+	void register_socket(std::shared_ptr<MmsgUdpSocket> socket) override {
+		if (socket == nullptr) {
+			throw csn::Exception(csn::Exception::kErrorSysRoutine, "SocketGroupEpollImpl insert a nullptr");
+		}
+		epoll_event event{};
+		event.events = EPOLLIN;
+		event.data.fd = socket->fd();
+		if (::epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, socket->fd(), &event) < 0)
+			throw csn::Exception(csn::Exception::kErrorSysRoutine, "epoll_ctl add failure");
+		sockets_[socket->fd()] = socket;
+	}
+	void unregister_socket(std::shared_ptr<MmsgUdpSocket> socket) override {
+		if (sockets_.erase(socket->fd()))
+			::epoll_ctl(epoll_fd_, EPOLL_CTL_DEL, socket->fd(), nullptr);
+	}
+	//watch a non socket fd(e.g. an eventfd waking up the loop),handle runs
+	//from listen() while fd is readable
+	void register_handler(int fd, ReadableHandler handle) {
+		epoll_event event{};
+		event.events = EPOLLIN;
+		event.data.fd = fd;
+		if (::epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, fd, &event) < 0)
+			throw csn::Exception(csn::Exception::kErrorSysRoutine, "epoll_ctl add failure");
+		handlers_[fd] = std::move(handle);
+	}
+	//flush what was queued outside the loop,sleep until a socket is readable
+	//or a timer is due,drain one batch per readable socket then expire timers
+	void listen(double waitUpToSeconds = 0.0) override {
+		flush_sockets();
+		int count = ::epoll_wait(epoll_fd_, events_.data(), kMaxEvents, wait_timeout_ms(waitUpToSeconds));
+		if (count < 0 && errno != EINTR)
+			throw csn::Exception(csn::Exception::kErrorSysRoutine, "epoll_wait failure");
+		for (int i = 0; i < count; ++i) {
+			auto it = sockets_.find(events_[i].data.fd);
+			if (likely(it != sockets_.end())) {
+				it->second->receive_batch();
+				continue;
+			}
+			auto handler = handlers_.find(events_[i].data.fd);
+			if (handler != handlers_.end())
+				handler->second();
+		}
+		tick_timer_sources();
+		flush_sockets();
+	}
+private:
+	void flush_sockets() {
+		for (auto& socket : sockets_)
+			socket.second->flush();
+	}
+	int															 epoll_fd_;
+	std::unordered_map<int, std::shared_ptr<MmsgUdpSocket>>		 sockets_;
+	std::unordered_map<int, ReadableHandler>					 handlers_;
+	std::vector<epoll_event>									 events_;
+};
+CACHE_NAMESPACE_END
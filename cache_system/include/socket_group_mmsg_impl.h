@@ -0,0 +1,262 @@
+/*
+ * socket_group_mmsg_impl.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: rynzen <chuanrui123@126.com>
+ *
+ *  This file is part of a cache system of lease mechanism implemenation.
+ *
+ *  socket_group_mmsg_impl.h is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  socket_group_mmsg_impl.h is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with consistent_hashing.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+#include <set>
+#include <vector>
+#include <string>
+#include <cstring>
+#include <cerrno>
+#include "common.h"
+#include "socket_group.h"
+#include "peer_table.h"
+
+#if !defined(OS_LINUX)
+#error "socket_group_mmsg_impl.h needs linux recvmmsg/sendmmsg"
+#endif
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netdb.h>
+#include <poll.h>
+#include <unistd.h>
+
+CACHE_NAMESPACE_BEGIN
+
+//! UDP socket on a plain linux fd,datagrams are received and sent in batches
+// do_send() goes back to the sender of the datagram being processed,same as a
+// netLink udp peer,do_send_to() reaches any peer seen before by its PeerId
+class MmsgUdpSocket : public ProtoSocket {
+public:
+	enum {
+		kMaxUdpPacketSize = 1492,
+		kMaxBufferSize = 2000,
+		//datagrams drained or flushed per syscall
+		kBatchSize = 32,
+	};
+	MmsgUdpSocket() :fd_(-1), reuse_port_(false), remote_{}, remote_length_(0),
+		peer_(kNoPeer), peers_(PeerTable::get_peer_table()),
+		recv_slots_(kBatchSize), recv_msgs_(kBatchSize),
+		send_slots_(kBatchSize), send_msgs_(kBatchSize), send_count_(0)
+	{
+		for (uint32_t i = 0; i < kBatchSize; ++i) {
+			prepare_slot(recv_slots_[i], recv_msgs_[i]);
+			prepare_slot(send_slots_[i], send_msgs_[i]);
+		}
+	}
+	MmsgUdpSocket(const MmsgUdpSocket&) = delete;
+	MmsgUdpSocket& operator=(const MmsgUdpSocket&) = delete;
+	virtual ~MmsgUdpSocket() {
+		if (fd_ >= 0)
+			::close(fd_);
+	}
+	//queue datagram,it goes out with the next flush()
+	uint16_t do_send(const std::string& data) override {
+		if (unlikely(data.size() > kMaxBufferSize))
+			throw csn::Exception(csn::Exception::kErrorWrite, "datagram exceeds send slot");
+		if (unlikely(!remote_length_)) {
+			LOG_OUT("drop datagram,no remote peer yet");
+			return 0;
+		}
+		MmsgSlot& slot = next_send_slot(data);
+		std::memcpy(&slot.addr, &remote_, remote_length_);
+		send_msgs_[send_count_++].msg_hdr.msg_namelen = remote_length_;
+		return (uint16_t)data.size();
+	}
+	//queue datagram to a peer interned before,it may not be the current remote
+	uint16_t do_send_to(const std::string& data, PeerId peer) override {
+		if (peer == kNoPeer)
+			return do_send(data);
+		if (unlikely(data.size() > kMaxBufferSize))
+			throw csn::Exception(csn::Exception::kErrorWrite, "datagram exceeds send slot");
+		MmsgSlot& slot = next_send_slot(data);
+		socklen_t length = 0;
+		if (unlikely(!peers_->lookup(peer, &slot.addr, &length))) {
+			LOG_OUT("drop datagram,unknown peer %u", peer);
+			return 0;
+		}
+		send_msgs_[send_count_++].msg_hdr.msg_namelen = length;
+		return (uint16_t)data.size();
+	}
+	PeerId remote_peer() override { return peer_; }
+	void initialize(const std::string& host_local, uint16_t local_port,
+		const std::string& remote_host, uint16_t remote_port) override
+	{
+		sockaddr_storage local{};
+		socklen_t local_length = resolve(host_local, local_port, &local);
+		fd_ = ::socket(local.ss_family, SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+		if (fd_ < 0)
+			throw csn::Exception(csn::Exception::kErrorSysRoutine, "create udp socket failure");
+		int on = 1;
+		if (reuse_port_ && ::setsockopt(fd_, SOL_SOCKET, SO_REUSEPORT, &on, sizeof(on)) < 0)
+			throw csn::Exception(csn::Exception::kErrorSysRoutine, "set SO_REUSEPORT failure");
+		if (::bind(fd_, reinterpret_cast<sockaddr*>(&local), local_length) < 0)
+			throw csn::Exception(csn::Exception::kErrorSysRoutine, std::string("bind udp socket failure ") + std::strerror(errno));
+		if (remote_host != "*" && remote_port)
+			remote_length_ = resolve(remote_host, remote_port, &remote_);
+	}
+	int fd() const { return fd_; }
+	//several sockets bind the same port,kernel spreads peers over them by flow hash.
+	//call before initialize()
+	void set_reuse_port(bool reuse_port) { reuse_port_ = reuse_port; }
+	//sender of the datagram being processed
+	const sockaddr_storage& remote() const { return remote_; }
+	socklen_t remote_length() const { return remote_length_; }
+	//dispatch a datagram received by another socket,responses go to its sender
+	void receive_from(std::string_view data, PeerId peer) {
+		if (unlikely(!peers_->lookup(peer, &remote_, &remote_length_))) {
+			LOG_OUT("drop handed off datagram,unknown peer %u", peer);
+			return;
+		}
+		peer_ = peer;
+		on_receive(data);
+	}
+	//drain up to kBatchSize datagrams with one recvmmsg and dispatch them
+	//return: count of datagrams received
+	uint32_t receive_batch() {
+		for (uint32_t i = 0; i < kBatchSize; ++i) {
+			recv_slots_[i].iov.iov_len = kMaxBufferSize;
+			recv_msgs_[i].msg_hdr.msg_namelen = sizeof(sockaddr_storage);
+		}
+		int count = ::recvmmsg(fd_, recv_msgs_.data(), kBatchSize, MSG_DONTWAIT, nullptr);
+		if (count < 0) {
+			if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)
+				return 0;
+			throw csn::Exception(csn::Exception::kErrorRead, "recvmmsg failure");
+		}
+		for (int i = 0; i < count; ++i) {
+			MmsgSlot& slot = recv_slots_[i];
+			remote_length_ = recv_msgs_[i].msg_hdr.msg_namelen;
+			std::memcpy(&remote_, &slot.addr, remote_length_);
+			peer_ = peers_->intern(reinterpret_cast<sockaddr*>(&slot.addr), remote_length_);
+			//parsed straight from the slot,no copy
+			on_receive(std::string_view(slot.buffer, recv_msgs_[i].msg_len));
+		}
+		return (uint32_t)count;
+	}
+	//send all queued datagrams,sendmmsg may take part of them per call
+	void flush() {
+		uint32_t sent = 0;
+		while (sent < send_count_) {
+			int count = ::sendmmsg(fd_, send_msgs_.data() + sent, send_count_ - sent, 0);
+			if (count < 0) {
+				if (errno == EINTR)
+					continue;
+				LOG_OUT("sendmmsg failure %s,drop %u datagrams", std::strerror(errno), send_count_ - sent);
+				break;
+			}
+			sent += (uint32_t)count;
+		}
+		send_count_ = 0;
+	}
+private:
+	struct MmsgSlot {
+		sockaddr_storage addr;
+		iovec			 iov;
+		char			 buffer[kMaxBufferSize];
+	};
+	//slot of the next queued datagram,data copied in
+	MmsgSlot& next_send_slot(const std::string& data) {
+		if (send_count_ == kBatchSize)
+			flush();
+		MmsgSlot& slot = send_slots_[send_count_];
+		std::memcpy(slot.buffer, data.data(), data.size());
+		slot.iov.iov_len = data.size();
+		return slot;
+	}
+	static void prepare_slot(MmsgSlot& slot, mmsghdr& msg) {
+		slot.iov.iov_base = slot.buffer;
+		slot.iov.iov_len = kMaxBufferSize;
+		std::memset(&msg, 0, sizeof(msg));
+		msg.msg_hdr.msg_name = &slot.addr;
+		msg.msg_hdr.msg_namelen = sizeof(sockaddr_storage);
+		msg.msg_hdr.msg_iov = &slot.iov;
+		msg.msg_hdr.msg_iovlen = 1;
+	}
+	//host: numeric address or name,"*" for any
+	static socklen_t resolve(const std::string& host, uint16_t port, sockaddr_storage* addr) {
+		addrinfo hints{};
+		hints.ai_family = AF_UNSPEC;
+		hints.ai_socktype = SOCK_DGRAM;
+		hints.ai_flags = AI_PASSIVE;
+		addrinfo* result = nullptr;
+		std::string service = std::to_string(port);
+		if (::getaddrinfo(host == "*" ? nullptr : host.c_str(), service.c_str(), &hints, &result) != 0 || !result)
+			throw csn::Exception(csn::Exception::kErrorIllArgument, "can't resolve host " + host);
+		socklen_t length = result->ai_addrlen;
+		std::memcpy(addr, result->ai_addr, length);
+		::freeaddrinfo(result);
+		return length;
+	}
+	int						 fd_;
+	bool					 reuse_port_;
+	sockaddr_storage		 remote_;
+	socklen_t				 remote_length_;
+	//id of remote_
+	PeerId					 peer_;
+	PeerTable*				 peers_;
+	std::vector<MmsgSlot>	 recv_slots_;
+	std::vector<mmsghdr>	 recv_msgs_;
+	std::vector<MmsgSlot>	 send_slots_;
+	std::vector<mmsghdr>	 send_msgs_;
+	uint32_t				 send_count_;
+};
+
+class SocketGroupMmsgImpl :public SocketGroupImpl<MmsgUdpSocket> {
+public:
+	SocketGroupMmsgImpl() :sockets_{}, fds_{} {}
+	~SocketGroupMmsgImpl() = default;
+	void register_socket(std::shared_ptr<MmsgUdpSocket> socket) override {
+		if (socket == nullptr) {
+			throw csn::Exception(csn::Exception::kErrorSysRoutine, "SocketGroupMmsgImpl insert a nullptr");
+		}
+		sockets_.insert(socket);
+	}
+	void unregister_socket(std::shared_ptr<MmsgUdpSocket> socket) override {
+		sockets_.erase(socket);
+	}
+	//flush what timers queued,wait for readable sockets or timers,drain one
+	//batch of each socket,expire timers and flush the responses
+	void listen(double waitUpToSeconds = 0.0) override {
+		std::vector<std::shared_ptr<MmsgUdpSocket>> sockets(sockets_.begin(), sockets_.end());
+		fds_.resize(sockets.size());
+		for (size_t i = 0; i < sockets.size(); ++i) {
+			sockets[i]->flush();
+			fds_[i].fd = sockets[i]->fd();
+			fds_[i].events = POLLIN;
+			fds_[i].revents = 0;
+		}
+		int ready = ::poll(fds_.data(), fds_.size(), wait_timeout_ms(waitUpToSeconds));
+		if (ready < 0 && errno != EINTR)
+			throw csn::Exception(csn::Exception::kErrorSysRoutine, "poll failure");
+		for (size_t i = 0; ready > 0 && i < sockets.size(); ++i) {
+			if (fds_[i].revents & POLLIN)
+				sockets[i]->receive_batch();
+		}
+		tick_timer_sources();
+		for (auto& socket : sockets)
+			socket->flush();
+	}
+private:
+	std::set<std::shared_ptr<MmsgUdpSocket>> sockets_;
+	std::vector<pollfd>						 fds_;
+};
+CACHE_NAMESPACE_END
@@ -23,6 +23,7 @@
 #include <type_traits>
 #include <functional>
 #include "socket_group.h"
+#include "peer_table.h"
 #include "netLink.h"
 
 CACHE_NAMESPACE_BEGIN
@@ -33,10 +34,76 @@ class UdpSocket : public netLink::Socket, public ProtoSocket{
 	friend class SocketManager;
 public:
 	virtual ~UdpSocket() = default;
-	//virtual void on_receive(const std::string& data) = 0;
 	uint16_t do_send(const std::string& str) override {
 		return send(str.c_str(), str.size());
 	}
+	//netLink keeps the sender as text,it is parsed only when it differs from
+	//the sender of the datagram before,a client sending many in a row costs a
+	//string compare and the intern lookup the epoll sockets pay too
+	PeerId remote_peer() override {
+		if (hostRemote == "*" || !portRemote)
+			return kNoPeer;
+		if (hostRemote != parsed_host_ || portRemote != parsed_port_) {
+			parsed_host_ = hostRemote;
+			parsed_port_ = portRemote;
+			parsed_addr_ = sockaddr_storage{};
+			parsed_length_ = 0;
+			sockaddr_in* in = reinterpret_cast<sockaddr_in*>(&parsed_addr_);
+			sockaddr_in6* in6 = reinterpret_cast<sockaddr_in6*>(&parsed_addr_);
+			if (inet_pton(AF_INET, hostRemote.c_str(), &in->sin_addr) == 1) {
+				in->sin_family = AF_INET;
+				in->sin_port = htons((uint16_t)portRemote);
+				parsed_length_ = sizeof(sockaddr_in);
+			}
+			else if (inet_pton(AF_INET6, hostRemote.c_str(), &in6->sin6_addr) == 1) {
+				in6->sin6_family = AF_INET6;
+				in6->sin6_port = htons((uint16_t)portRemote);
+				parsed_length_ = sizeof(sockaddr_in6);
+			}
+		}
+		if (!parsed_length_)
+			return kNoPeer;
+		//interned every time,so the id stays seen and a reclaimed one isn't reused
+		return PeerTable::get_peer_table()->intern(reinterpret_cast<sockaddr*>(&parsed_addr_), parsed_length_);
+	}
+	//point the netLink remote at peer for this send,then put it back.
+	//the text of the last address sent to is kept and swapped in,so answers
+	//to the same client don't format or allocate. netLink resolves the text
+	//again inside send(),that part can't be avoided without bypassing it,
+	//the epoll sockets are the ones for load
+	uint16_t do_send_to(const std::string& str, PeerId peer) override {
+		if (peer == kNoPeer)
+			return do_send(str);
+		sockaddr_storage addr{};
+		socklen_t length = 0;
+		if (unlikely(!PeerTable::get_peer_table()->lookup(peer, &addr, &length))) {
+			LOG_OUT("drop datagram,unknown peer %u", peer);
+			return 0;
+		}
+		//an id may have been given to another address since,compare the address
+		if (length != send_length_ || std::memcmp(&addr, &send_addr_, length) != 0) {
+			char host[INET6_ADDRSTRLEN] = {};
+			if (addr.ss_family == AF_INET) {
+				const sockaddr_in* in = reinterpret_cast<const sockaddr_in*>(&addr);
+				inet_ntop(AF_INET, &in->sin_addr, host, sizeof(host));
+				send_port_ = ntohs(in->sin_port);
+			}
+			else {
+				const sockaddr_in6* in6 = reinterpret_cast<const sockaddr_in6*>(&addr);
+				inet_ntop(AF_INET6, &in6->sin6_addr, host, sizeof(host));
+				send_port_ = ntohs(in6->sin6_port);
+			}
+			send_host_.assign(host);
+			send_addr_ = addr;
+			send_length_ = length;
+		}
+		std::swap(hostRemote, send_host_);
+		std::swap(portRemote, send_port_);
+		uint16_t sent = send(str.c_str(), str.size());
+		std::swap(hostRemote, send_host_);
+		std::swap(portRemote, send_port_);
+		return sent;
+	}
 	void initialize(const std::string& host_local, uint16_t local_port,
 		const std::string& remote_host, uint16_t remote_port) override
 	{
@@ -45,6 +112,17 @@ public:
 		portRemote = remote_port;
 		setInputBufferSize(0);
 	}
+private:
+	//sender text last parsed and its address,parsed_length_ 0 if it didn't parse
+	std::string			 parsed_host_{};
+	unsigned int		 parsed_port_ = 0;
+	sockaddr_storage	 parsed_addr_{};
+	socklen_t			 parsed_length_ = 0;
+	//address last sent to and its text for the netLink remote
+	sockaddr_storage	 send_addr_{};
+	socklen_t			 send_length_ = 0;
+	std::string			 send_host_{};
+	unsigned int		 send_port_ = 0;
 };
 
 class SocketGroupNetlinkImpl :public SocketGroupImpl<UdpSocket> {
@@ -74,7 +152,9 @@ public:
 	}
 	//Let the SocketManager poll from all sockets, events will be triggered here
 	void listen(double waitUpToSeconds = 0.0) override {
-		manager_.listen(waitUpToSeconds);
+		int timeout = wait_timeout_ms(waitUpToSeconds);
+		manager_.listen(timeout < 0 ? -1.0 : timeout / 1000.0);
+		tick_timer_sources();
 	}
 protected:
 	void on_receive(netLink::SocketManager* manager, std::shared_ptr<netLink::Socket> socket)
@@ -86,8 +166,8 @@ protected:
 		if (unlikely(udpsocket == nullptr)) {
 			throw csn::Exception(csn::Exception::kErrorSysRoutine, "unsuport original socket!!!!");
 		}
-		buffer_.get()[length] = '\0';
-		udpsocket->on_receive(buffer_.get());
+		//explicit length,protobuf bytes may hold NUL
+		udpsocket->on_receive(std::string_view(buffer_.get(), length));
 	}
 	std::unique_ptr<char[], std::function<void(char*)>>  buffer_;
 	netLink::SocketManager								 manager_;
@@ -22,13 +22,17 @@
 #pragma once
 
 #include <vector>
-#include <algorithm>
+#include <array>
 #include <mutex>
 #include <memory>
 #include <functional>
 #include "common.h"
 // 
 // threadsafe tiny timer,maybe remove lock and manipulate it with threadlocal in future
+// hierarchical timing wheel of 1 millisecond resolution,add/del/expire are O(1)
+// get_timer_queue() is the queue of calling thread,every event loop thread ticks its own.
+// owners of their own timers(e.g. a data center shard) may keep a private TimerQueue
+// and tick it themselves
 // Example:
 //		//tick in a thread
 //      int epfd = epoll_create(1);
@@ -40,65 +44,98 @@
 //      TimerQueue::get_timer_queue()->add_timer([]() {LOG_OUT("timer1 run"); }, 3000, 10);
 
 CACHE_NAMESPACE_BEGIN
-class TimerQueue
+//! anything owning timers an event loop has to expire
+class TimerSource
 {
 public:
-	using TimerCallHandler = std::function<void(void)>;
-	class TimerCompare;
-	class EventTimer
-	{
-	public:
-		//callback: std::function<void(void)>
-		//timeout_ms:timer expire millisecond 
-		//repeat: timer repeat counts
-		explicit EventTimer(TimerCallHandler&& callback, uint32_t timeout_ms, uint32_t repeat = 1) :
-			callback_(std::move(callback)),
-			timeout_ms_(timeout_ms),
-			expire_time_(get_time_stamp(timeout_ms)),
-			repeat_(repeat) {}
-
-	private:
-		//just for repeat_ > 1
-		void reset()
-		{
-			expire_time_ = get_time_stamp(timeout_ms_);
-		}
-		bool expired() { return expire_time_ <= get_time_stamp(); }
-		bool operator<(const EventTimer& timer) { return expire_time_ < timer.expire_time_; }
-		//timer_id,identified by this
-		size_t timer_id() { return reinterpret_cast<size_t>(this); }
-	private:
-		friend class TimerQueue;
-		friend class TimerCompare;
-		uint32_t repeat_;
-		uint32_t timeout_ms_;
-		std::time_t expire_time_;
-		TimerCallHandler callback_;
-	};
-	struct TimerCompare {
-		bool operator()(const std::unique_ptr<EventTimer>& t1, const std::unique_ptr<EventTimer>& t2) {
-			return (t2->expire_time_) < (t1->expire_time_);
-		}
+	enum :uint32_t {
+		//no timer pending
+		kTimerIdle = 0xFFFFFFFF,
 	};
-	//return : timer id
+	virtual ~TimerSource() = default;
+	//return: milliseconds until next timer may expire,kTimerIdle if none
+	virtual uint32_t next_timeout_ms() = 0;
+	virtual void tick() = 0;
+};
+
+class TimerQueue :public TimerSource
+{
+public:
+	using TimerCallHandler = std::function<void(void)>;
+	TimerQueue();
+	TimerQueue(const TimerQueue&) = delete;
+	TimerQueue& operator=(const TimerQueue&) = delete;
+	//return : timer id,index of slab and its generation,never 0
 	//callback: std::function<void(void)>
 	//timeout_ms:timer expire millisecond 
 	//repeat: timer repeat counts
 	const size_t add_timer(TimerCallHandler&& callback,
 		uint32_t timeout_ms, uint32_t repeat = 1);
-	//
+	//timer_id of a fired or deleted timer is ignored
 	void del_timer(const size_t timer_id);
-	void tick();
+	void tick() override;
+	//looks no further than the next cascade of root wheel
+	uint32_t next_timeout_ms() override;
+	//outstanding timers
+	size_t size();
 
 	static TimerQueue* get_timer_queue() {
 		return &queue_;
 	}
 private:
-	std::vector<std::unique_ptr<EventTimer>> timer_queue_;
-	TimerCompare  compare_;
-	std::mutex    mutex_;
+	static_assert(sizeof(size_t) >= sizeof(uint64_t), "timer id packs slab index and generation in 64 bits");
+	enum TimerWheelLayout {
+		//level 0: 256 slots of 1 ms
+		kRootBits = 8,
+		kRootSize = 1 << kRootBits,
+		kRootMask = kRootSize - 1,
+		//level 1~4: 64 slots each,covers 2^32 ms
+		kLevelBits = 6,
+		kLevelSize = 1 << kLevelBits,
+		kLevelMask = kLevelSize - 1,
+		kLevelCount = 4,
+		kSlotCount = kRootSize + kLevelCount * kLevelSize,
+		//timers detached from the root slot being expired
+		kFiringSlot = kSlotCount,
+	};
+	enum TimerLink :uint32_t {
+		kLinkNull = 0xFFFFFFFF,
+		//slot_ of a timer running its callback
+		kLinkFiring = 0xFFFFFFFE,
+	};
+	class EventTimer
+	{
+	private:
+		friend class TimerQueue;
+		TimerCallHandler callback_;
+		std::time_t expire_time_;
+		uint32_t timeout_ms_;
+		uint32_t repeat_;
+		//bumped every time the slab entry is recycled,so stale ids never match
+		uint32_t generation_;
+		//wheel slot the timer linked in,or kLinkFiring/kLinkNull
+		uint32_t slot_;
+		//intrusive list of a wheel slot,next_ also chains free entries
+		uint32_t prev_;
+		uint32_t next_;
+	};
+	uint32_t alloc_timer();
+	void free_timer(uint32_t index);
+	void link_timer(uint32_t index);
+	void unlink_timer(uint32_t index);
+	//move timers of a upper level slot down,return slot index
+	uint32_t cascade(uint32_t level);
+	void fire_timer(uint32_t index, std::unique_lock<std::mutex>& lock);
+private:
+	//slab of timers,no allocation once it warmed up
+	std::vector<EventTimer> timers_;
+	uint32_t			free_head_;
+	std::array<uint32_t, kSlotCount + 1> slots_;
+	//next millisecond to expire,everything before it has fired
+	std::time_t			current_;
+	size_t				count_;
+	std::mutex			mutex_;
 
-	TimerQueue() = default;
-	static TimerQueue queue_;
+	static thread_local TimerQueue queue_;
 };
 CACHE_NAMESPACE_END
\ No newline at end of file
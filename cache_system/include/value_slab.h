@@ -0,0 +1,223 @@
+/*
+ * value_slab.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: rynzen <chuanrui123@126.com>
+ *
+ *  This file is part of a cache system of lease mechanism implemenation.
+ *
+ *  value_slab.h is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  value_slab.h is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with consistent_hashing.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+#include <memory>
+#include <vector>
+#include <array>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <cstring>
+#include <stdint.h>
+#include "common.h"
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+CACHE_NAMESPACE_BEGIN
+//
+// size classed storage for value bytes,not threadsafe,one per data center shard.
+// classes are 8 bytes apart up to 64,then 8 classes per power of 2,a block
+// wastes 1/16 of its size on average. blocks are carved from 64K chunks and
+// recycled through a free list per class,chunks are kept until the slab goes,
+// so millions of values of mixed sizes don't fragment the heap.
+// values over kMaxClassSize get a heap block of their own.
+class ValueSlab {
+public:
+	enum ValueSlabLayout {
+		kMinClassSize = 8,
+		//classes up to 64 bytes are kMinClassSize apart
+		kLinearClasses = 8,
+		kClassesPerDouble = 8,
+		kChunkSize = 64 * 1024,
+		kMaxClassSize = 16 * 1024,
+		kClassCount = kLinearClasses + (14 - 6) * kClassesPerDouble,
+		//size_class of a block outside the slab
+		kLargeClass = 0xFF,
+	};
+	ValueSlab() :chunks_(), classes_(), large_bytes_(0) {}
+	ValueSlab(const ValueSlab&) = delete;
+	ValueSlab& operator=(const ValueSlab&) = delete;
+	~ValueSlab() = default;
+	//size_class:OUT,handed back to release()
+	char* allocate(size_t size, uint8_t* size_class) {
+		if (unlikely(size > kMaxClassSize)) {
+			*size_class = kLargeClass;
+			large_bytes_ += size;
+			return new char[size];
+		}
+		uint8_t index = class_of(size);
+		*size_class = index;
+		SizeClass& cls = classes_[index];
+		if (cls.free) {
+			char* block = cls.free;
+			std::memcpy(&cls.free, block, sizeof(char*));
+			return block;
+		}
+		size_t block_size = class_size(index);
+		if (cls.cursor + block_size > cls.end) {
+			chunks_.emplace_back(new char[kChunkSize]);
+			cls.cursor = chunks_.back().get();
+			cls.end = cls.cursor + kChunkSize;
+		}
+		char* block = cls.cursor;
+		cls.cursor += block_size;
+		return block;
+	}
+	//size:same as allocated,only blocks outside the slab need it
+	void release(char* block, uint8_t size_class, size_t size) {
+		if (unlikely(size_class == kLargeClass)) {
+			large_bytes_ -= size;
+			delete[] block;
+			return;
+		}
+		SizeClass& cls = classes_[size_class];
+		std::memcpy(block, &cls.free, sizeof(char*));
+		cls.free = block;
+	}
+	//block size given out for a size
+	static size_t block_size(size_t size) {
+		return size > kMaxClassSize ? size : class_size(class_of(size));
+	}
+	//memory held,free blocks and untouched chunk tails included
+	size_t bytes() const {
+		return chunks_.size() * kChunkSize + large_bytes_;
+	}
+private:
+	struct SizeClass {
+		//next free block is kept in the first bytes of a free block
+		char* free = nullptr;
+		//rest of the chunk this class carves from
+		char* cursor = nullptr;
+		char* end = nullptr;
+	};
+	static uint32_t highest_bit(size_t value) {
+#if defined(_MSC_VER)
+		unsigned long index;
+		_BitScanReverse64(&index, value);
+		return (uint32_t)index;
+#else
+		return (uint32_t)(63 - __builtin_clzll(value));
+#endif
+	}
+	//size:1..kMaxClassSize
+	static uint8_t class_of(size_t size) {
+		if (size <= kLinearClasses * kMinClassSize)
+			return (uint8_t)(size ? (size - 1) / kMinClassSize : 0);
+		uint32_t bit = highest_bit(size - 1);
+		size_t step = size_t(1) << (bit - 3);
+		size_t offset = (size - 1 - (size_t(1) << bit)) / step;
+		return (uint8_t)(kLinearClasses + (bit - 6) * kClassesPerDouble + offset);
+	}
+	static size_t class_size(uint8_t index) {
+		if (index < kLinearClasses)
+			return (size_t(index) + 1) * kMinClassSize;
+		uint32_t bit = 6 + (index - kLinearClasses) / kClassesPerDouble;
+		size_t offset = (index - kLinearClasses) % kClassesPerDouble;
+		return (size_t(1) << bit) + ((offset + 1) << (bit - 3));
+	}
+	std::vector<std::unique_ptr<char[]>> chunks_;
+	std::array<SizeClass, kClassCount>	 classes_;
+	size_t								 large_bytes_;
+};
+
+//
+// value bytes of a stored string,up to kInlineCapacity of them inside the object,
+// longer ones in a ValueSlab block. move only,the block goes back to its slab
+// on destruction,so the slab must outlive every SlabString taken from it.
+class SlabString {
+public:
+	enum SlabStringLayout {
+		kInlineCapacity = 3 * sizeof(void*),
+		//size_class of inline bytes
+		kInlineClass = 0xFE,
+	};
+	SlabString() noexcept :size_(0), size_class_(kInlineClass) {}
+	SlabString(ValueSlab* slab, std::string_view value) :size_((uint32_t)value.size()), size_class_(kInlineClass) {
+		char* data = bytes_;
+		if (value.size() > kInlineCapacity) {
+			data = slab->allocate(value.size(), &size_class_);
+			heap_.data = data;
+			heap_.slab = slab;
+		}
+		if (!value.empty())
+			std::memcpy(data, value.data(), value.size());
+	}
+	SlabString(const SlabString&) = delete;
+	SlabString& operator=(const SlabString&) = delete;
+	SlabString(SlabString&& other) noexcept :size_(0), size_class_(kInlineClass) {
+		take(other);
+	}
+	SlabString& operator=(SlabString&& other) noexcept {
+		if (this != &other) {
+			reset();
+			take(other);
+		}
+		return *this;
+	}
+	~SlabString() { reset(); }
+	const char* data() const { return inlined() ? bytes_ : heap_.data; }
+	size_t size() const { return size_; }
+	bool empty() const { return size_ == 0; }
+	std::string_view view() const { return std::string_view(data(), size_); }
+	//bytes held in a slab block,0 when inline
+	size_t heap_size() const { return inlined() ? 0 : ValueSlab::block_size(size_); }
+	void reset() {
+		if (!inlined())
+			heap_.slab->release(heap_.data, size_class_, size_);
+		size_ = 0;
+		size_class_ = kInlineClass;
+	}
+private:
+	bool inlined() const { return size_class_ == kInlineClass; }
+	void take(SlabString& other) {
+		std::memcpy(static_cast<void*>(this), &other, sizeof(*this));
+		other.size_ = 0;
+		other.size_class_ = kInlineClass;
+	}
+	union {
+		char bytes_[kInlineCapacity];
+		struct {
+			char*	   data;
+			ValueSlab* slab;
+		} heap_;
+	};
+	uint32_t size_;
+	uint8_t	 size_class_;
+};
+
+//how the data center keeps a value of type T,load() copies it back out
+template <typename T>
+struct CacheValueTraits {
+	using StoreType = T;
+	template <typename U>
+	static StoreType store(ValueSlab* slab, U&& value) { return StoreType(std::forward<U>(value)); }
+	static void load(const StoreType& stored, T* value) { *value = stored; }
+};
+//the bytes of a string go to the slab of its shard
+template <>
+struct CacheValueTraits<std::string> {
+	using StoreType = SlabString;
+	static StoreType store(ValueSlab* slab, std::string_view value) { return SlabString(slab, value); }
+	static void load(const StoreType& stored, std::string* value) { value->assign(stored.data(), stored.size()); }
+};
+CACHE_NAMESPACE_END
@@ -0,0 +1,3593 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: cache_message.proto
+
+#include "cache_message.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace CacheMessageProto {
+PROTOBUF_CONSTEXPR CacheMessageHeader::CacheMessageHeader(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.magic_)*/0u
+  , /*decltype(_impl_.version_)*/0u
+  , /*decltype(_impl_.op_id_)*/uint64_t{0u}
+  , /*decltype(_impl_.type_)*/0
+  , /*decltype(_impl_.sequence_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct CacheMessageHeaderDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CacheMessageHeaderDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CacheMessageHeaderDefaultTypeInternal() {}
+  union {
+    CacheMessageHeader _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CacheMessageHeaderDefaultTypeInternal _CacheMessageHeader_default_instance_;
+PROTOBUF_CONSTEXPR CacheReadRequest::CacheReadRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.timestamp_)*/uint64_t{0u}
+  , /*decltype(_impl_.expire_)*/0u
+  , /*decltype(_impl_.cache_id_)*/0u
+  , /*decltype(_impl_.version_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct CacheReadRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CacheReadRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CacheReadRequestDefaultTypeInternal() {}
+  union {
+    CacheReadRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CacheReadRequestDefaultTypeInternal _CacheReadRequest_default_instance_;
+PROTOBUF_CONSTEXPR CacheUpdateRequest::CacheUpdateRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.cache_data_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.timestamp_)*/uint64_t{0u}
+  , /*decltype(_impl_.expire_)*/0u
+  , /*decltype(_impl_.cache_id_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct CacheUpdateRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CacheUpdateRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CacheUpdateRequestDefaultTypeInternal() {}
+  union {
+    CacheUpdateRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CacheUpdateRequestDefaultTypeInternal _CacheUpdateRequest_default_instance_;
+PROTOBUF_CONSTEXPR CacheReadManyRequest::CacheReadManyRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.cache_ids_)*/{}
+  , /*decltype(_impl_._cache_ids_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.timestamp_)*/uint64_t{0u}
+  , /*decltype(_impl_.expire_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct CacheReadManyRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CacheReadManyRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CacheReadManyRequestDefaultTypeInternal() {}
+  union {
+    CacheReadManyRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CacheReadManyRequestDefaultTypeInternal _CacheReadManyRequest_default_instance_;
+PROTOBUF_CONSTEXPR CacheUpdateItem::CacheUpdateItem(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.cache_data_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.cache_id_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct CacheUpdateItemDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CacheUpdateItemDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CacheUpdateItemDefaultTypeInternal() {}
+  union {
+    CacheUpdateItem _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CacheUpdateItemDefaultTypeInternal _CacheUpdateItem_default_instance_;
+PROTOBUF_CONSTEXPR CacheUpdateManyRequest::CacheUpdateManyRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.items_)*/{}
+  , /*decltype(_impl_.timestamp_)*/uint64_t{0u}
+  , /*decltype(_impl_.expire_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct CacheUpdateManyRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CacheUpdateManyRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CacheUpdateManyRequestDefaultTypeInternal() {}
+  union {
+    CacheUpdateManyRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CacheUpdateManyRequestDefaultTypeInternal _CacheUpdateManyRequest_default_instance_;
+PROTOBUF_CONSTEXPR CacheOpResponse::CacheOpResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.cache_data_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.timestamp_)*/uint64_t{0u}
+  , /*decltype(_impl_.result_)*/0u
+  , /*decltype(_impl_.expire_)*/0u
+  , /*decltype(_impl_.cache_id_)*/0u
+  , /*decltype(_impl_.not_modified_)*/false
+  , /*decltype(_impl_.version_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct CacheOpResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CacheOpResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CacheOpResponseDefaultTypeInternal() {}
+  union {
+    CacheOpResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CacheOpResponseDefaultTypeInternal _CacheOpResponse_default_instance_;
+PROTOBUF_CONSTEXPR CacheInvalidate::CacheInvalidate(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.version_)*/uint64_t{0u}
+  , /*decltype(_impl_.cache_id_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct CacheInvalidateDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CacheInvalidateDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CacheInvalidateDefaultTypeInternal() {}
+  union {
+    CacheInvalidate _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CacheInvalidateDefaultTypeInternal _CacheInvalidate_default_instance_;
+PROTOBUF_CONSTEXPR CacheReplicateItem::CacheReplicateItem(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.cache_data_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.cache_id_)*/uint64_t{0u}
+  , /*decltype(_impl_.version_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct CacheReplicateItemDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CacheReplicateItemDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CacheReplicateItemDefaultTypeInternal() {}
+  union {
+    CacheReplicateItem _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CacheReplicateItemDefaultTypeInternal _CacheReplicateItem_default_instance_;
+PROTOBUF_CONSTEXPR CacheReplicate::CacheReplicate(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.items_)*/{}
+  , /*decltype(_impl_.session_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct CacheReplicateDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CacheReplicateDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CacheReplicateDefaultTypeInternal() {}
+  union {
+    CacheReplicate _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CacheReplicateDefaultTypeInternal _CacheReplicate_default_instance_;
+PROTOBUF_CONSTEXPR CacheMessage::CacheMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.op_responses_)*/{}
+  , /*decltype(_impl_.header_)*/nullptr
+  , /*decltype(_impl_.read_request_)*/nullptr
+  , /*decltype(_impl_.update_request_)*/nullptr
+  , /*decltype(_impl_.op_response_)*/nullptr
+  , /*decltype(_impl_.read_many_request_)*/nullptr
+  , /*decltype(_impl_.update_many_request_)*/nullptr
+  , /*decltype(_impl_.invalidate_)*/nullptr
+  , /*decltype(_impl_.replicate_)*/nullptr
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct CacheMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CacheMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CacheMessageDefaultTypeInternal() {}
+  union {
+    CacheMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CacheMessageDefaultTypeInternal _CacheMessage_default_instance_;
+}  // namespace CacheMessageProto
+static ::_pb::Metadata file_level_metadata_cache_5fmessage_2eproto[11];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_cache_5fmessage_2eproto[1];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_cache_5fmessage_2eproto = nullptr;
+
+const uint32_t TableStruct_cache_5fmessage_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::CacheMessageProto::CacheMessageHeader, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CacheMessageProto::CacheMessageHeader, _impl_.magic_),
+  PROTOBUF_FIELD_OFFSET(::CacheMessageProto::CacheMessageHeader, _impl_.version_),
+  PROTOBUF_FIELD_OFFSET(::CacheMessageProto::CacheMessageHeader, _impl_.type_),
+  PROTOBUF_FIELD_OFFSET(::CacheMessageProto::CacheMessageHeader, _impl_.op_id_),
+  PROTOBUF_FIELD_OFFSET(::CacheMessageProto::CacheMessageHeader, _impl_.sequence_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::CacheMessageProto::CacheReadRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CacheMessageProto::CacheReadRequest, _impl_.timestamp_),
+  PROTOBUF_FIELD_OFFSET(::CacheMessageProto::CacheReadRequest, _impl_.expire_),
+  PROTOBUF_FIELD_OFFSET(::CacheMessageProto::CacheReadRequest, _impl_.cache_id_),
+  PROTOBUF_FIELD_OFFSET(::CacheMessageProto::CacheReadRequest, _impl_.version_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::CacheMessageProto::CacheUpdateRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CacheMessageProto::CacheUpdateRequest, _impl_.timestamp_),
+  PROTOBUF_FIELD_OFFSET(::CacheMessageProto::CacheUpdateRequest, _impl_.expire_),
+  PROTOBUF_FIELD_OFFSET(::CacheMessageProto::CacheUpdateRequest, _impl_.cache_id_),
+  PROTOBUF_FIELD_OFFSET(::CacheMessageProto::CacheUpdateRequest, _impl_.cache_data_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::CacheMessageProto::CacheReadManyRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CacheMessageProto::CacheReadManyRequest, _impl_.timestamp_),
+  PROTOBUF_FIELD_OFFSET(::CacheMessageProto::CacheReadManyRequest, _impl_.expire_),
+  PROTOBUF_FIELD_OFFSET(::CacheMessageProto::CacheReadManyRequest, _impl_.cache_ids_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::CacheMessageProto::CacheUpdateItem, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CacheMessageProto::CacheUpdateItem, _impl_.cache_id_),
+  PROTOBUF_FIELD_OFFSET(::CacheMessageProto::CacheUpdateItem, _impl_.cache_data_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::CacheMessageProto::CacheUpdateManyRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CacheMessageProto::CacheUpdateManyRequest, _impl_.timestamp_),
+  PROTOBUF_FIELD_OFFSET(::CacheMessageProto::CacheUpdateManyRequest, _impl_.expire_),
+  PROTOBUF_FIELD_OFFSET(::CacheMessageProto::CacheUpdateManyRequest, _impl_.items_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::CacheMessageProto::CacheOpResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CacheMessageProto::CacheOpResponse, _impl_.result_),
+  PROTOBUF_FIELD_OFFSET(::CacheMessageProto::CacheOpResponse, _impl_.timestamp_),
+  PROTOBUF_FIELD_OFFSET(::CacheMessageProto::CacheOpResponse, _impl_.expire_),
+  PROTOBUF_FIELD_OFFSET(::CacheMessageProto::CacheOpResponse, _impl_.cache_id_),
+  PROTOBUF_FIELD_OFFSET(::CacheMessageProto::CacheOpResponse, _impl_.cache_data_),
+  PROTOBUF_FIELD_OFFSET(::CacheMessageProto::CacheOpResponse, _impl_.version_),
+  PROTOBUF_FIELD_OFFSET(::CacheMessageProto::CacheOpResponse, _impl_.not_modified_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::CacheMessageProto::CacheInvalidate, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CacheMessageProto::CacheInvalidate, _impl_.cache_id_),
+  PROTOBUF_FIELD_OFFSET(::CacheMessageProto::CacheInvalidate, _impl_.version_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::CacheMessageProto::CacheReplicateItem, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CacheMessageProto::CacheReplicateItem, _impl_.cache_id_),
+  PROTOBUF_FIELD_OFFSET(::CacheMessageProto::CacheReplicateItem, _impl_.version_),
+  PROTOBUF_FIELD_OFFSET(::CacheMessageProto::CacheReplicateItem, _impl_.cache_data_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::CacheMessageProto::CacheReplicate, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CacheMessageProto::CacheReplicate, _impl_.items_),
+  PROTOBUF_FIELD_OFFSET(::CacheMessageProto::CacheReplicate, _impl_.session_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::CacheMessageProto::CacheMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CacheMessageProto::CacheMessage, _impl_.header_),
+  PROTOBUF_FIELD_OFFSET(::CacheMessageProto::CacheMessage, _impl_.read_request_),
+  PROTOBUF_FIELD_OFFSET(::CacheMessageProto::CacheMessage, _impl_.update_request_),
+  PROTOBUF_FIELD_OFFSET(::CacheMessageProto::CacheMessage, _impl_.op_response_),
+  PROTOBUF_FIELD_OFFSET(::CacheMessageProto::CacheMessage, _impl_.read_many_request_),
+  PROTOBUF_FIELD_OFFSET(::CacheMessageProto::CacheMessage, _impl_.update_many_request_),
+  PROTOBUF_FIELD_OFFSET(::CacheMessageProto::CacheMessage, _impl_.op_responses_),
+  PROTOBUF_FIELD_OFFSET(::CacheMessageProto::CacheMessage, _impl_.invalidate_),
+  PROTOBUF_FIELD_OFFSET(::CacheMessageProto::CacheMessage, _impl_.replicate_),
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::CacheMessageProto::CacheMessageHeader)},
+  { 11, -1, -1, sizeof(::CacheMessageProto::CacheReadRequest)},
+  { 21, -1, -1, sizeof(::CacheMessageProto::CacheUpdateRequest)},
+  { 31, -1, -1, sizeof(::CacheMessageProto::CacheReadManyRequest)},
+  { 40, -1, -1, sizeof(::CacheMessageProto::CacheUpdateItem)},
+  { 48, -1, -1, sizeof(::CacheMessageProto::CacheUpdateManyRequest)},
+  { 57, -1, -1, sizeof(::CacheMessageProto::CacheOpResponse)},
+  { 70, -1, -1, sizeof(::CacheMessageProto::CacheInvalidate)},
+  { 78, -1, -1, sizeof(::CacheMessageProto::CacheReplicateItem)},
+  { 87, -1, -1, sizeof(::CacheMessageProto::CacheReplicate)},
+  { 95, -1, -1, sizeof(::CacheMessageProto::CacheMessage)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::CacheMessageProto::_CacheMessageHeader_default_instance_._instance,
+  &::CacheMessageProto::_CacheReadRequest_default_instance_._instance,
+  &::CacheMessageProto::_CacheUpdateRequest_default_instance_._instance,
+  &::CacheMessageProto::_CacheReadManyRequest_default_instance_._instance,
+  &::CacheMessageProto::_CacheUpdateItem_default_instance_._instance,
+  &::CacheMessageProto::_CacheUpdateManyRequest_default_instance_._instance,
+  &::CacheMessageProto::_CacheOpResponse_default_instance_._instance,
+  &::CacheMessageProto::_CacheInvalidate_default_instance_._instance,
+  &::CacheMessageProto::_CacheReplicateItem_default_instance_._instance,
+  &::CacheMessageProto::_CacheReplicate_default_instance_._instance,
+  &::CacheMessageProto::_CacheMessage_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_cache_5fmessage_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\023cache_message.proto\022\021CacheMessageProto"
+  "\"\210\001\n\022CacheMessageHeader\022\r\n\005magic\030\001 \001(\r\022\017"
+  "\n\007version\030\002 \001(\r\0221\n\004type\030\003 \001(\0162#.CacheMes"
+  "sageProto.CacheMessageType\022\r\n\005op_id\030\004 \001("
+  "\004\022\020\n\010sequence\030\005 \001(\r\"X\n\020CacheReadRequest\022"
+  "\021\n\ttimestamp\030\001 \001(\004\022\016\n\006expire\030\002 \001(\r\022\020\n\010ca"
+  "che_id\030\003 \001(\r\022\017\n\007version\030\004 \001(\004\"]\n\022CacheUp"
+  "dateRequest\022\021\n\ttimestamp\030\001 \001(\004\022\016\n\006expire"
+  "\030\002 \001(\r\022\020\n\010cache_id\030\003 \001(\r\022\022\n\ncache_data\030\004"
+  " \001(\014\"L\n\024CacheReadManyRequest\022\021\n\ttimestam"
+  "p\030\001 \001(\004\022\016\n\006expire\030\002 \001(\r\022\021\n\tcache_ids\030\003 \003"
+  "(\r\"7\n\017CacheUpdateItem\022\020\n\010cache_id\030\001 \001(\r\022"
+  "\022\n\ncache_data\030\002 \001(\014\"n\n\026CacheUpdateManyRe"
+  "quest\022\021\n\ttimestamp\030\001 \001(\004\022\016\n\006expire\030\002 \001(\r"
+  "\0221\n\005items\030\003 \003(\0132\".CacheMessageProto.Cach"
+  "eUpdateItem\"\221\001\n\017CacheOpResponse\022\016\n\006resul"
+  "t\030\001 \001(\r\022\021\n\ttimestamp\030\002 \001(\004\022\016\n\006expire\030\003 \001"
+  "(\r\022\020\n\010cache_id\030\004 \001(\r\022\022\n\ncache_data\030\005 \001(\014"
+  "\022\017\n\007version\030\006 \001(\004\022\024\n\014not_modified\030\007 \001(\010\""
+  "4\n\017CacheInvalidate\022\020\n\010cache_id\030\001 \001(\r\022\017\n\007"
+  "version\030\002 \001(\004\"K\n\022CacheReplicateItem\022\020\n\010c"
+  "ache_id\030\001 \001(\004\022\017\n\007version\030\002 \001(\004\022\022\n\ncache_"
+  "data\030\003 \001(\014\"W\n\016CacheReplicate\0224\n\005items\030\001 "
+  "\003(\0132%.CacheMessageProto.CacheReplicateIt"
+  "em\022\017\n\007session\030\002 \001(\004\"\254\004\n\014CacheMessage\0225\n\006"
+  "header\030\001 \001(\0132%.CacheMessageProto.CacheMe"
+  "ssageHeader\0229\n\014read_request\030\002 \001(\0132#.Cach"
+  "eMessageProto.CacheReadRequest\022=\n\016update"
+  "_request\030\003 \001(\0132%.CacheMessageProto.Cache"
+  "UpdateRequest\0227\n\013op_response\030\004 \001(\0132\".Cac"
+  "heMessageProto.CacheOpResponse\022B\n\021read_m"
+  "any_request\030\005 \001(\0132\'.CacheMessageProto.Ca"
+  "cheReadManyRequest\022F\n\023update_many_reques"
+  "t\030\006 \001(\0132).CacheMessageProto.CacheUpdateM"
+  "anyRequest\0228\n\014op_responses\030\007 \003(\0132\".Cache"
+  "MessageProto.CacheOpResponse\0226\n\ninvalida"
+  "te\030\010 \001(\0132\".CacheMessageProto.CacheInvali"
+  "date\0224\n\treplicate\030\t \001(\0132!.CacheMessagePr"
+  "oto.CacheReplicate*\231\002\n\020CacheMessageType\022"
+  "\016\n\nkDummyType\020\000\022\021\n\014kReadRequest\020\201 \022\022\n\rkR"
+  "eadResponse\020\202 \022\023\n\016kUpdateRequest\020\203 \022\024\n\017k"
+  "UpdateResponse\020\204 \022\022\n\rkOperationAck\020\205 \022\025\n"
+  "\020kInvalidateCache\020\206 \022\025\n\020kReadManyRequest"
+  "\020\207 \022\026\n\021kReadManyResponse\020\210 \022\027\n\022kUpdateMa"
+  "nyRequest\020\211 \022\030\n\023kUpdateManyResponse\020\212 \022\026"
+  "\n\021kReplicateUpdates\020\213 2b\n\014CacheService\022R"
+  "\n\014CacheRequest\022\037.CacheMessageProto.Cache"
+  "Message\032\037.CacheMessageProto.CacheMessage"
+  "\"\000BB\n\"io.grpc.examples.CacheMessageProto"
+  "B\021CacheMessageProtoP\001\370\001\001\242\002\003RTGb\006proto3"
+  ;
+static ::_pbi::once_flag descriptor_table_cache_5fmessage_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_cache_5fmessage_2eproto = {
+    false, false, 1998, descriptor_table_protodef_cache_5fmessage_2eproto,
+    "cache_message.proto",
+    &descriptor_table_cache_5fmessage_2eproto_once, nullptr, 0, 11,
+    schemas, file_default_instances, TableStruct_cache_5fmessage_2eproto::offsets,
+    file_level_metadata_cache_5fmessage_2eproto, file_level_enum_descriptors_cache_5fmessage_2eproto,
+    file_level_service_descriptors_cache_5fmessage_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_cache_5fmessage_2eproto_getter() {
+  return &descriptor_table_cache_5fmessage_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_cache_5fmessage_2eproto(&descriptor_table_cache_5fmessage_2eproto);
+namespace CacheMessageProto {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* CacheMessageType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_cache_5fmessage_2eproto);
+  return file_level_enum_descriptors_cache_5fmessage_2eproto[0];
+}
+bool CacheMessageType_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 4097:
+    case 4098:
+    case 4099:
+    case 4100:
+    case 4101:
+    case 4102:
+    case 4103:
+    case 4104:
+    case 4105:
+    case 4106:
+    case 4107:
+      return true;
+    default:
+      return false;
+  }
+}
+
+
+// ===================================================================
+
+class CacheMessageHeader::_Internal {
+ public:
+};
+
+CacheMessageHeader::CacheMessageHeader(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CacheMessageProto.CacheMessageHeader)
+}
+CacheMessageHeader::CacheMessageHeader(const CacheMessageHeader& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CacheMessageHeader* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.magic_){}
+    , decltype(_impl_.version_){}
+    , decltype(_impl_.op_id_){}
+    , decltype(_impl_.type_){}
+    , decltype(_impl_.sequence_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.magic_, &from._impl_.magic_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.sequence_) -
+    reinterpret_cast<char*>(&_impl_.magic_)) + sizeof(_impl_.sequence_));
+  // @@protoc_insertion_point(copy_constructor:CacheMessageProto.CacheMessageHeader)
+}
+
+inline void CacheMessageHeader::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.magic_){0u}
+    , decltype(_impl_.version_){0u}
+    , decltype(_impl_.op_id_){uint64_t{0u}}
+    , decltype(_impl_.type_){0}
+    , decltype(_impl_.sequence_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+CacheMessageHeader::~CacheMessageHeader() {
+  // @@protoc_insertion_point(destructor:CacheMessageProto.CacheMessageHeader)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CacheMessageHeader::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void CacheMessageHeader::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CacheMessageHeader::Clear() {
+// @@protoc_insertion_point(message_clear_start:CacheMessageProto.CacheMessageHeader)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.magic_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.sequence_) -
+      reinterpret_cast<char*>(&_impl_.magic_)) + sizeof(_impl_.sequence_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CacheMessageHeader::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint32 magic = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.magic_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 version = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.version_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .CacheMessageProto.CacheMessageType type = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_type(static_cast<::CacheMessageProto::CacheMessageType>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 op_id = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.op_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 sequence = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.sequence_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CacheMessageHeader::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CacheMessageProto.CacheMessageHeader)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 magic = 1;
+  if (this->_internal_magic() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_magic(), target);
+  }
+
+  // uint32 version = 2;
+  if (this->_internal_version() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_version(), target);
+  }
+
+  // .CacheMessageProto.CacheMessageType type = 3;
+  if (this->_internal_type() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      3, this->_internal_type(), target);
+  }
+
+  // uint64 op_id = 4;
+  if (this->_internal_op_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_op_id(), target);
+  }
+
+  // uint32 sequence = 5;
+  if (this->_internal_sequence() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_sequence(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CacheMessageProto.CacheMessageHeader)
+  return target;
+}
+
+size_t CacheMessageHeader::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CacheMessageProto.CacheMessageHeader)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // uint32 magic = 1;
+  if (this->_internal_magic() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_magic());
+  }
+
+  // uint32 version = 2;
+  if (this->_internal_version() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_version());
+  }
+
+  // uint64 op_id = 4;
+  if (this->_internal_op_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_op_id());
+  }
+
+  // .CacheMessageProto.CacheMessageType type = 3;
+  if (this->_internal_type() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_type());
+  }
+
+  // uint32 sequence = 5;
+  if (this->_internal_sequence() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_sequence());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CacheMessageHeader::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CacheMessageHeader::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CacheMessageHeader::GetClassData() const { return &_class_data_; }
+
+
+void CacheMessageHeader::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CacheMessageHeader*>(&to_msg);
+  auto& from = static_cast<const CacheMessageHeader&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CacheMessageProto.CacheMessageHeader)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_magic() != 0) {
+    _this->_internal_set_magic(from._internal_magic());
+  }
+  if (from._internal_version() != 0) {
+    _this->_internal_set_version(from._internal_version());
+  }
+  if (from._internal_op_id() != 0) {
+    _this->_internal_set_op_id(from._internal_op_id());
+  }
+  if (from._internal_type() != 0) {
+    _this->_internal_set_type(from._internal_type());
+  }
+  if (from._internal_sequence() != 0) {
+    _this->_internal_set_sequence(from._internal_sequence());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CacheMessageHeader::CopyFrom(const CacheMessageHeader& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CacheMessageProto.CacheMessageHeader)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CacheMessageHeader::IsInitialized() const {
+  return true;
+}
+
+void CacheMessageHeader::InternalSwap(CacheMessageHeader* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CacheMessageHeader, _impl_.sequence_)
+      + sizeof(CacheMessageHeader::_impl_.sequence_)
+      - PROTOBUF_FIELD_OFFSET(CacheMessageHeader, _impl_.magic_)>(
+          reinterpret_cast<char*>(&_impl_.magic_),
+          reinterpret_cast<char*>(&other->_impl_.magic_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CacheMessageHeader::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_cache_5fmessage_2eproto_getter, &descriptor_table_cache_5fmessage_2eproto_once,
+      file_level_metadata_cache_5fmessage_2eproto[0]);
+}
+
+// ===================================================================
+
+class CacheReadRequest::_Internal {
+ public:
+};
+
+CacheReadRequest::CacheReadRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CacheMessageProto.CacheReadRequest)
+}
+CacheReadRequest::CacheReadRequest(const CacheReadRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CacheReadRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.timestamp_){}
+    , decltype(_impl_.expire_){}
+    , decltype(_impl_.cache_id_){}
+    , decltype(_impl_.version_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.timestamp_, &from._impl_.timestamp_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.version_) -
+    reinterpret_cast<char*>(&_impl_.timestamp_)) + sizeof(_impl_.version_));
+  // @@protoc_insertion_point(copy_constructor:CacheMessageProto.CacheReadRequest)
+}
+
+inline void CacheReadRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.timestamp_){uint64_t{0u}}
+    , decltype(_impl_.expire_){0u}
+    , decltype(_impl_.cache_id_){0u}
+    , decltype(_impl_.version_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+CacheReadRequest::~CacheReadRequest() {
+  // @@protoc_insertion_point(destructor:CacheMessageProto.CacheReadRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CacheReadRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void CacheReadRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CacheReadRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:CacheMessageProto.CacheReadRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.timestamp_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.version_) -
+      reinterpret_cast<char*>(&_impl_.timestamp_)) + sizeof(_impl_.version_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CacheReadRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 timestamp = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.timestamp_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 expire = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.expire_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 cache_id = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.cache_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 version = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.version_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CacheReadRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CacheMessageProto.CacheReadRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 timestamp = 1;
+  if (this->_internal_timestamp() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_timestamp(), target);
+  }
+
+  // uint32 expire = 2;
+  if (this->_internal_expire() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_expire(), target);
+  }
+
+  // uint32 cache_id = 3;
+  if (this->_internal_cache_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_cache_id(), target);
+  }
+
+  // uint64 version = 4;
+  if (this->_internal_version() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_version(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CacheMessageProto.CacheReadRequest)
+  return target;
+}
+
+size_t CacheReadRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CacheMessageProto.CacheReadRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // uint64 timestamp = 1;
+  if (this->_internal_timestamp() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_timestamp());
+  }
+
+  // uint32 expire = 2;
+  if (this->_internal_expire() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_expire());
+  }
+
+  // uint32 cache_id = 3;
+  if (this->_internal_cache_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_cache_id());
+  }
+
+  // uint64 version = 4;
+  if (this->_internal_version() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_version());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CacheReadRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CacheReadRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CacheReadRequest::GetClassData() const { return &_class_data_; }
+
+
+void CacheReadRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CacheReadRequest*>(&to_msg);
+  auto& from = static_cast<const CacheReadRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CacheMessageProto.CacheReadRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_timestamp() != 0) {
+    _this->_internal_set_timestamp(from._internal_timestamp());
+  }
+  if (from._internal_expire() != 0) {
+    _this->_internal_set_expire(from._internal_expire());
+  }
+  if (from._internal_cache_id() != 0) {
+    _this->_internal_set_cache_id(from._internal_cache_id());
+  }
+  if (from._internal_version() != 0) {
+    _this->_internal_set_version(from._internal_version());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CacheReadRequest::CopyFrom(const CacheReadRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CacheMessageProto.CacheReadRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CacheReadRequest::IsInitialized() const {
+  return true;
+}
+
+void CacheReadRequest::InternalSwap(CacheReadRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CacheReadRequest, _impl_.version_)
+      + sizeof(CacheReadRequest::_impl_.version_)
+      - PROTOBUF_FIELD_OFFSET(CacheReadRequest, _impl_.timestamp_)>(
+          reinterpret_cast<char*>(&_impl_.timestamp_),
+          reinterpret_cast<char*>(&other->_impl_.timestamp_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CacheReadRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_cache_5fmessage_2eproto_getter, &descriptor_table_cache_5fmessage_2eproto_once,
+      file_level_metadata_cache_5fmessage_2eproto[1]);
+}
+
+// ===================================================================
+
+class CacheUpdateRequest::_Internal {
+ public:
+};
+
+CacheUpdateRequest::CacheUpdateRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CacheMessageProto.CacheUpdateRequest)
+}
+CacheUpdateRequest::CacheUpdateRequest(const CacheUpdateRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CacheUpdateRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.cache_data_){}
+    , decltype(_impl_.timestamp_){}
+    , decltype(_impl_.expire_){}
+    , decltype(_impl_.cache_id_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.cache_data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.cache_data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_cache_data().empty()) {
+    _this->_impl_.cache_data_.Set(from._internal_cache_data(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.timestamp_, &from._impl_.timestamp_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.cache_id_) -
+    reinterpret_cast<char*>(&_impl_.timestamp_)) + sizeof(_impl_.cache_id_));
+  // @@protoc_insertion_point(copy_constructor:CacheMessageProto.CacheUpdateRequest)
+}
+
+inline void CacheUpdateRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.cache_data_){}
+    , decltype(_impl_.timestamp_){uint64_t{0u}}
+    , decltype(_impl_.expire_){0u}
+    , decltype(_impl_.cache_id_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.cache_data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.cache_data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+CacheUpdateRequest::~CacheUpdateRequest() {
+  // @@protoc_insertion_point(destructor:CacheMessageProto.CacheUpdateRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CacheUpdateRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.cache_data_.Destroy();
+}
+
+void CacheUpdateRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CacheUpdateRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:CacheMessageProto.CacheUpdateRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.cache_data_.ClearToEmpty();
+  ::memset(&_impl_.timestamp_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.cache_id_) -
+      reinterpret_cast<char*>(&_impl_.timestamp_)) + sizeof(_impl_.cache_id_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CacheUpdateRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 timestamp = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.timestamp_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 expire = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.expire_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 cache_id = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.cache_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes cache_data = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_cache_data();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CacheUpdateRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CacheMessageProto.CacheUpdateRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 timestamp = 1;
+  if (this->_internal_timestamp() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_timestamp(), target);
+  }
+
+  // uint32 expire = 2;
+  if (this->_internal_expire() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_expire(), target);
+  }
+
+  // uint32 cache_id = 3;
+  if (this->_internal_cache_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_cache_id(), target);
+  }
+
+  // bytes cache_data = 4;
+  if (!this->_internal_cache_data().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        4, this->_internal_cache_data(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CacheMessageProto.CacheUpdateRequest)
+  return target;
+}
+
+size_t CacheUpdateRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CacheMessageProto.CacheUpdateRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes cache_data = 4;
+  if (!this->_internal_cache_data().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_cache_data());
+  }
+
+  // uint64 timestamp = 1;
+  if (this->_internal_timestamp() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_timestamp());
+  }
+
+  // uint32 expire = 2;
+  if (this->_internal_expire() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_expire());
+  }
+
+  // uint32 cache_id = 3;
+  if (this->_internal_cache_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_cache_id());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CacheUpdateRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CacheUpdateRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CacheUpdateRequest::GetClassData() const { return &_class_data_; }
+
+
+void CacheUpdateRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CacheUpdateRequest*>(&to_msg);
+  auto& from = static_cast<const CacheUpdateRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CacheMessageProto.CacheUpdateRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_cache_data().empty()) {
+    _this->_internal_set_cache_data(from._internal_cache_data());
+  }
+  if (from._internal_timestamp() != 0) {
+    _this->_internal_set_timestamp(from._internal_timestamp());
+  }
+  if (from._internal_expire() != 0) {
+    _this->_internal_set_expire(from._internal_expire());
+  }
+  if (from._internal_cache_id() != 0) {
+    _this->_internal_set_cache_id(from._internal_cache_id());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CacheUpdateRequest::CopyFrom(const CacheUpdateRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CacheMessageProto.CacheUpdateRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CacheUpdateRequest::IsInitialized() const {
+  return true;
+}
+
+void CacheUpdateRequest::InternalSwap(CacheUpdateRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.cache_data_, lhs_arena,
+      &other->_impl_.cache_data_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CacheUpdateRequest, _impl_.cache_id_)
+      + sizeof(CacheUpdateRequest::_impl_.cache_id_)
+      - PROTOBUF_FIELD_OFFSET(CacheUpdateRequest, _impl_.timestamp_)>(
+          reinterpret_cast<char*>(&_impl_.timestamp_),
+          reinterpret_cast<char*>(&other->_impl_.timestamp_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CacheUpdateRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_cache_5fmessage_2eproto_getter, &descriptor_table_cache_5fmessage_2eproto_once,
+      file_level_metadata_cache_5fmessage_2eproto[2]);
+}
+
+// ===================================================================
+
+class CacheReadManyRequest::_Internal {
+ public:
+};
+
+CacheReadManyRequest::CacheReadManyRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CacheMessageProto.CacheReadManyRequest)
+}
+CacheReadManyRequest::CacheReadManyRequest(const CacheReadManyRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CacheReadManyRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.cache_ids_){from._impl_.cache_ids_}
+    , /*decltype(_impl_._cache_ids_cached_byte_size_)*/{0}
+    , decltype(_impl_.timestamp_){}
+    , decltype(_impl_.expire_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.timestamp_, &from._impl_.timestamp_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.expire_) -
+    reinterpret_cast<char*>(&_impl_.timestamp_)) + sizeof(_impl_.expire_));
+  // @@protoc_insertion_point(copy_constructor:CacheMessageProto.CacheReadManyRequest)
+}
+
+inline void CacheReadManyRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.cache_ids_){arena}
+    , /*decltype(_impl_._cache_ids_cached_byte_size_)*/{0}
+    , decltype(_impl_.timestamp_){uint64_t{0u}}
+    , decltype(_impl_.expire_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+CacheReadManyRequest::~CacheReadManyRequest() {
+  // @@protoc_insertion_point(destructor:CacheMessageProto.CacheReadManyRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CacheReadManyRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.cache_ids_.~RepeatedField();
+}
+
+void CacheReadManyRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CacheReadManyRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:CacheMessageProto.CacheReadManyRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.cache_ids_.Clear();
+  ::memset(&_impl_.timestamp_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.expire_) -
+      reinterpret_cast<char*>(&_impl_.timestamp_)) + sizeof(_impl_.expire_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CacheReadManyRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 timestamp = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.timestamp_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 expire = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.expire_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint32 cache_ids = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_cache_ids(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 24) {
+          _internal_add_cache_ids(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CacheReadManyRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CacheMessageProto.CacheReadManyRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 timestamp = 1;
+  if (this->_internal_timestamp() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_timestamp(), target);
+  }
+
+  // uint32 expire = 2;
+  if (this->_internal_expire() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_expire(), target);
+  }
+
+  // repeated uint32 cache_ids = 3;
+  {
+    int byte_size = _impl_._cache_ids_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          3, _internal_cache_ids(), byte_size, target);
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CacheMessageProto.CacheReadManyRequest)
+  return target;
+}
+
+size_t CacheReadManyRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CacheMessageProto.CacheReadManyRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated uint32 cache_ids = 3;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.cache_ids_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._cache_ids_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // uint64 timestamp = 1;
+  if (this->_internal_timestamp() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_timestamp());
+  }
+
+  // uint32 expire = 2;
+  if (this->_internal_expire() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_expire());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CacheReadManyRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CacheReadManyRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CacheReadManyRequest::GetClassData() const { return &_class_data_; }
+
+
+void CacheReadManyRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CacheReadManyRequest*>(&to_msg);
+  auto& from = static_cast<const CacheReadManyRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CacheMessageProto.CacheReadManyRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.cache_ids_.MergeFrom(from._impl_.cache_ids_);
+  if (from._internal_timestamp() != 0) {
+    _this->_internal_set_timestamp(from._internal_timestamp());
+  }
+  if (from._internal_expire() != 0) {
+    _this->_internal_set_expire(from._internal_expire());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CacheReadManyRequest::CopyFrom(const CacheReadManyRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CacheMessageProto.CacheReadManyRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CacheReadManyRequest::IsInitialized() const {
+  return true;
+}
+
+void CacheReadManyRequest::InternalSwap(CacheReadManyRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.cache_ids_.InternalSwap(&other->_impl_.cache_ids_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CacheReadManyRequest, _impl_.expire_)
+      + sizeof(CacheReadManyRequest::_impl_.expire_)
+      - PROTOBUF_FIELD_OFFSET(CacheReadManyRequest, _impl_.timestamp_)>(
+          reinterpret_cast<char*>(&_impl_.timestamp_),
+          reinterpret_cast<char*>(&other->_impl_.timestamp_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CacheReadManyRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_cache_5fmessage_2eproto_getter, &descriptor_table_cache_5fmessage_2eproto_once,
+      file_level_metadata_cache_5fmessage_2eproto[3]);
+}
+
+// ===================================================================
+
+class CacheUpdateItem::_Internal {
+ public:
+};
+
+CacheUpdateItem::CacheUpdateItem(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CacheMessageProto.CacheUpdateItem)
+}
+CacheUpdateItem::CacheUpdateItem(const CacheUpdateItem& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CacheUpdateItem* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.cache_data_){}
+    , decltype(_impl_.cache_id_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.cache_data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.cache_data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_cache_data().empty()) {
+    _this->_impl_.cache_data_.Set(from._internal_cache_data(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.cache_id_ = from._impl_.cache_id_;
+  // @@protoc_insertion_point(copy_constructor:CacheMessageProto.CacheUpdateItem)
+}
+
+inline void CacheUpdateItem::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.cache_data_){}
+    , decltype(_impl_.cache_id_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.cache_data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.cache_data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+CacheUpdateItem::~CacheUpdateItem() {
+  // @@protoc_insertion_point(destructor:CacheMessageProto.CacheUpdateItem)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CacheUpdateItem::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.cache_data_.Destroy();
+}
+
+void CacheUpdateItem::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CacheUpdateItem::Clear() {
+// @@protoc_insertion_point(message_clear_start:CacheMessageProto.CacheUpdateItem)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.cache_data_.ClearToEmpty();
+  _impl_.cache_id_ = 0u;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CacheUpdateItem::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint32 cache_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.cache_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes cache_data = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_cache_data();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CacheUpdateItem::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CacheMessageProto.CacheUpdateItem)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 cache_id = 1;
+  if (this->_internal_cache_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_cache_id(), target);
+  }
+
+  // bytes cache_data = 2;
+  if (!this->_internal_cache_data().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_cache_data(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CacheMessageProto.CacheUpdateItem)
+  return target;
+}
+
+size_t CacheUpdateItem::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CacheMessageProto.CacheUpdateItem)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes cache_data = 2;
+  if (!this->_internal_cache_data().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_cache_data());
+  }
+
+  // uint32 cache_id = 1;
+  if (this->_internal_cache_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_cache_id());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CacheUpdateItem::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CacheUpdateItem::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CacheUpdateItem::GetClassData() const { return &_class_data_; }
+
+
+void CacheUpdateItem::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CacheUpdateItem*>(&to_msg);
+  auto& from = static_cast<const CacheUpdateItem&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CacheMessageProto.CacheUpdateItem)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_cache_data().empty()) {
+    _this->_internal_set_cache_data(from._internal_cache_data());
+  }
+  if (from._internal_cache_id() != 0) {
+    _this->_internal_set_cache_id(from._internal_cache_id());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CacheUpdateItem::CopyFrom(const CacheUpdateItem& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CacheMessageProto.CacheUpdateItem)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CacheUpdateItem::IsInitialized() const {
+  return true;
+}
+
+void CacheUpdateItem::InternalSwap(CacheUpdateItem* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.cache_data_, lhs_arena,
+      &other->_impl_.cache_data_, rhs_arena
+  );
+  swap(_impl_.cache_id_, other->_impl_.cache_id_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CacheUpdateItem::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_cache_5fmessage_2eproto_getter, &descriptor_table_cache_5fmessage_2eproto_once,
+      file_level_metadata_cache_5fmessage_2eproto[4]);
+}
+
+// ===================================================================
+
+class CacheUpdateManyRequest::_Internal {
+ public:
+};
+
+CacheUpdateManyRequest::CacheUpdateManyRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CacheMessageProto.CacheUpdateManyRequest)
+}
+CacheUpdateManyRequest::CacheUpdateManyRequest(const CacheUpdateManyRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CacheUpdateManyRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.items_){from._impl_.items_}
+    , decltype(_impl_.timestamp_){}
+    , decltype(_impl_.expire_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.timestamp_, &from._impl_.timestamp_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.expire_) -
+    reinterpret_cast<char*>(&_impl_.timestamp_)) + sizeof(_impl_.expire_));
+  // @@protoc_insertion_point(copy_constructor:CacheMessageProto.CacheUpdateManyRequest)
+}
+
+inline void CacheUpdateManyRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.items_){arena}
+    , decltype(_impl_.timestamp_){uint64_t{0u}}
+    , decltype(_impl_.expire_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+CacheUpdateManyRequest::~CacheUpdateManyRequest() {
+  // @@protoc_insertion_point(destructor:CacheMessageProto.CacheUpdateManyRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CacheUpdateManyRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.items_.~RepeatedPtrField();
+}
+
+void CacheUpdateManyRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CacheUpdateManyRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:CacheMessageProto.CacheUpdateManyRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.items_.Clear();
+  ::memset(&_impl_.timestamp_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.expire_) -
+      reinterpret_cast<char*>(&_impl_.timestamp_)) + sizeof(_impl_.expire_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CacheUpdateManyRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 timestamp = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.timestamp_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 expire = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.expire_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .CacheMessageProto.CacheUpdateItem items = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_items(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CacheUpdateManyRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CacheMessageProto.CacheUpdateManyRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 timestamp = 1;
+  if (this->_internal_timestamp() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_timestamp(), target);
+  }
+
+  // uint32 expire = 2;
+  if (this->_internal_expire() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_expire(), target);
+  }
+
+  // repeated .CacheMessageProto.CacheUpdateItem items = 3;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_items_size()); i < n; i++) {
+    const auto& repfield = this->_internal_items(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CacheMessageProto.CacheUpdateManyRequest)
+  return target;
+}
+
+size_t CacheUpdateManyRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CacheMessageProto.CacheUpdateManyRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .CacheMessageProto.CacheUpdateItem items = 3;
+  total_size += 1UL * this->_internal_items_size();
+  for (const auto& msg : this->_impl_.items_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // uint64 timestamp = 1;
+  if (this->_internal_timestamp() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_timestamp());
+  }
+
+  // uint32 expire = 2;
+  if (this->_internal_expire() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_expire());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CacheUpdateManyRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CacheUpdateManyRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CacheUpdateManyRequest::GetClassData() const { return &_class_data_; }
+
+
+void CacheUpdateManyRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CacheUpdateManyRequest*>(&to_msg);
+  auto& from = static_cast<const CacheUpdateManyRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CacheMessageProto.CacheUpdateManyRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.items_.MergeFrom(from._impl_.items_);
+  if (from._internal_timestamp() != 0) {
+    _this->_internal_set_timestamp(from._internal_timestamp());
+  }
+  if (from._internal_expire() != 0) {
+    _this->_internal_set_expire(from._internal_expire());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CacheUpdateManyRequest::CopyFrom(const CacheUpdateManyRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CacheMessageProto.CacheUpdateManyRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CacheUpdateManyRequest::IsInitialized() const {
+  return true;
+}
+
+void CacheUpdateManyRequest::InternalSwap(CacheUpdateManyRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.items_.InternalSwap(&other->_impl_.items_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CacheUpdateManyRequest, _impl_.expire_)
+      + sizeof(CacheUpdateManyRequest::_impl_.expire_)
+      - PROTOBUF_FIELD_OFFSET(CacheUpdateManyRequest, _impl_.timestamp_)>(
+          reinterpret_cast<char*>(&_impl_.timestamp_),
+          reinterpret_cast<char*>(&other->_impl_.timestamp_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CacheUpdateManyRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_cache_5fmessage_2eproto_getter, &descriptor_table_cache_5fmessage_2eproto_once,
+      file_level_metadata_cache_5fmessage_2eproto[5]);
+}
+
+// ===================================================================
+
+class CacheOpResponse::_Internal {
+ public:
+};
+
+CacheOpResponse::CacheOpResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CacheMessageProto.CacheOpResponse)
+}
+CacheOpResponse::CacheOpResponse(const CacheOpResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CacheOpResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.cache_data_){}
+    , decltype(_impl_.timestamp_){}
+    , decltype(_impl_.result_){}
+    , decltype(_impl_.expire_){}
+    , decltype(_impl_.cache_id_){}
+    , decltype(_impl_.not_modified_){}
+    , decltype(_impl_.version_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.cache_data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.cache_data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_cache_data().empty()) {
+    _this->_impl_.cache_data_.Set(from._internal_cache_data(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.timestamp_, &from._impl_.timestamp_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.version_) -
+    reinterpret_cast<char*>(&_impl_.timestamp_)) + sizeof(_impl_.version_));
+  // @@protoc_insertion_point(copy_constructor:CacheMessageProto.CacheOpResponse)
+}
+
+inline void CacheOpResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.cache_data_){}
+    , decltype(_impl_.timestamp_){uint64_t{0u}}
+    , decltype(_impl_.result_){0u}
+    , decltype(_impl_.expire_){0u}
+    , decltype(_impl_.cache_id_){0u}
+    , decltype(_impl_.not_modified_){false}
+    , decltype(_impl_.version_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.cache_data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.cache_data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+CacheOpResponse::~CacheOpResponse() {
+  // @@protoc_insertion_point(destructor:CacheMessageProto.CacheOpResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CacheOpResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.cache_data_.Destroy();
+}
+
+void CacheOpResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CacheOpResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:CacheMessageProto.CacheOpResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.cache_data_.ClearToEmpty();
+  ::memset(&_impl_.timestamp_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.version_) -
+      reinterpret_cast<char*>(&_impl_.timestamp_)) + sizeof(_impl_.version_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CacheOpResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint32 result = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.result_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 timestamp = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.timestamp_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 expire = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.expire_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 cache_id = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.cache_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes cache_data = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_cache_data();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 version = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.version_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool not_modified = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.not_modified_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CacheOpResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CacheMessageProto.CacheOpResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 result = 1;
+  if (this->_internal_result() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_result(), target);
+  }
+
+  // uint64 timestamp = 2;
+  if (this->_internal_timestamp() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_timestamp(), target);
+  }
+
+  // uint32 expire = 3;
+  if (this->_internal_expire() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_expire(), target);
+  }
+
+  // uint32 cache_id = 4;
+  if (this->_internal_cache_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_cache_id(), target);
+  }
+
+  // bytes cache_data = 5;
+  if (!this->_internal_cache_data().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        5, this->_internal_cache_data(), target);
+  }
+
+  // uint64 version = 6;
+  if (this->_internal_version() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(6, this->_internal_version(), target);
+  }
+
+  // bool not_modified = 7;
+  if (this->_internal_not_modified() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(7, this->_internal_not_modified(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CacheMessageProto.CacheOpResponse)
+  return target;
+}
+
+size_t CacheOpResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CacheMessageProto.CacheOpResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes cache_data = 5;
+  if (!this->_internal_cache_data().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_cache_data());
+  }
+
+  // uint64 timestamp = 2;
+  if (this->_internal_timestamp() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_timestamp());
+  }
+
+  // uint32 result = 1;
+  if (this->_internal_result() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_result());
+  }
+
+  // uint32 expire = 3;
+  if (this->_internal_expire() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_expire());
+  }
+
+  // uint32 cache_id = 4;
+  if (this->_internal_cache_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_cache_id());
+  }
+
+  // bool not_modified = 7;
+  if (this->_internal_not_modified() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // uint64 version = 6;
+  if (this->_internal_version() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_version());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CacheOpResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CacheOpResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CacheOpResponse::GetClassData() const { return &_class_data_; }
+
+
+void CacheOpResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CacheOpResponse*>(&to_msg);
+  auto& from = static_cast<const CacheOpResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CacheMessageProto.CacheOpResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_cache_data().empty()) {
+    _this->_internal_set_cache_data(from._internal_cache_data());
+  }
+  if (from._internal_timestamp() != 0) {
+    _this->_internal_set_timestamp(from._internal_timestamp());
+  }
+  if (from._internal_result() != 0) {
+    _this->_internal_set_result(from._internal_result());
+  }
+  if (from._internal_expire() != 0) {
+    _this->_internal_set_expire(from._internal_expire());
+  }
+  if (from._internal_cache_id() != 0) {
+    _this->_internal_set_cache_id(from._internal_cache_id());
+  }
+  if (from._internal_not_modified() != 0) {
+    _this->_internal_set_not_modified(from._internal_not_modified());
+  }
+  if (from._internal_version() != 0) {
+    _this->_internal_set_version(from._internal_version());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CacheOpResponse::CopyFrom(const CacheOpResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CacheMessageProto.CacheOpResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CacheOpResponse::IsInitialized() const {
+  return true;
+}
+
+void CacheOpResponse::InternalSwap(CacheOpResponse* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.cache_data_, lhs_arena,
+      &other->_impl_.cache_data_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CacheOpResponse, _impl_.version_)
+      + sizeof(CacheOpResponse::_impl_.version_)
+      - PROTOBUF_FIELD_OFFSET(CacheOpResponse, _impl_.timestamp_)>(
+          reinterpret_cast<char*>(&_impl_.timestamp_),
+          reinterpret_cast<char*>(&other->_impl_.timestamp_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CacheOpResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_cache_5fmessage_2eproto_getter, &descriptor_table_cache_5fmessage_2eproto_once,
+      file_level_metadata_cache_5fmessage_2eproto[6]);
+}
+
+// ===================================================================
+
+class CacheInvalidate::_Internal {
+ public:
+};
+
+CacheInvalidate::CacheInvalidate(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CacheMessageProto.CacheInvalidate)
+}
+CacheInvalidate::CacheInvalidate(const CacheInvalidate& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CacheInvalidate* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.version_){}
+    , decltype(_impl_.cache_id_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.version_, &from._impl_.version_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.cache_id_) -
+    reinterpret_cast<char*>(&_impl_.version_)) + sizeof(_impl_.cache_id_));
+  // @@protoc_insertion_point(copy_constructor:CacheMessageProto.CacheInvalidate)
+}
+
+inline void CacheInvalidate::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.version_){uint64_t{0u}}
+    , decltype(_impl_.cache_id_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+CacheInvalidate::~CacheInvalidate() {
+  // @@protoc_insertion_point(destructor:CacheMessageProto.CacheInvalidate)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CacheInvalidate::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void CacheInvalidate::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CacheInvalidate::Clear() {
+// @@protoc_insertion_point(message_clear_start:CacheMessageProto.CacheInvalidate)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.version_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.cache_id_) -
+      reinterpret_cast<char*>(&_impl_.version_)) + sizeof(_impl_.cache_id_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CacheInvalidate::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint32 cache_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.cache_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 version = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.version_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CacheInvalidate::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CacheMessageProto.CacheInvalidate)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 cache_id = 1;
+  if (this->_internal_cache_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_cache_id(), target);
+  }
+
+  // uint64 version = 2;
+  if (this->_internal_version() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_version(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CacheMessageProto.CacheInvalidate)
+  return target;
+}
+
+size_t CacheInvalidate::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CacheMessageProto.CacheInvalidate)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // uint64 version = 2;
+  if (this->_internal_version() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_version());
+  }
+
+  // uint32 cache_id = 1;
+  if (this->_internal_cache_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_cache_id());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CacheInvalidate::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CacheInvalidate::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CacheInvalidate::GetClassData() const { return &_class_data_; }
+
+
+void CacheInvalidate::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CacheInvalidate*>(&to_msg);
+  auto& from = static_cast<const CacheInvalidate&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CacheMessageProto.CacheInvalidate)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_version() != 0) {
+    _this->_internal_set_version(from._internal_version());
+  }
+  if (from._internal_cache_id() != 0) {
+    _this->_internal_set_cache_id(from._internal_cache_id());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CacheInvalidate::CopyFrom(const CacheInvalidate& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CacheMessageProto.CacheInvalidate)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CacheInvalidate::IsInitialized() const {
+  return true;
+}
+
+void CacheInvalidate::InternalSwap(CacheInvalidate* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CacheInvalidate, _impl_.cache_id_)
+      + sizeof(CacheInvalidate::_impl_.cache_id_)
+      - PROTOBUF_FIELD_OFFSET(CacheInvalidate, _impl_.version_)>(
+          reinterpret_cast<char*>(&_impl_.version_),
+          reinterpret_cast<char*>(&other->_impl_.version_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CacheInvalidate::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_cache_5fmessage_2eproto_getter, &descriptor_table_cache_5fmessage_2eproto_once,
+      file_level_metadata_cache_5fmessage_2eproto[7]);
+}
+
+// ===================================================================
+
+class CacheReplicateItem::_Internal {
+ public:
+};
+
+CacheReplicateItem::CacheReplicateItem(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CacheMessageProto.CacheReplicateItem)
+}
+CacheReplicateItem::CacheReplicateItem(const CacheReplicateItem& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CacheReplicateItem* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.cache_data_){}
+    , decltype(_impl_.cache_id_){}
+    , decltype(_impl_.version_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.cache_data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.cache_data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_cache_data().empty()) {
+    _this->_impl_.cache_data_.Set(from._internal_cache_data(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.cache_id_, &from._impl_.cache_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.version_) -
+    reinterpret_cast<char*>(&_impl_.cache_id_)) + sizeof(_impl_.version_));
+  // @@protoc_insertion_point(copy_constructor:CacheMessageProto.CacheReplicateItem)
+}
+
+inline void CacheReplicateItem::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.cache_data_){}
+    , decltype(_impl_.cache_id_){uint64_t{0u}}
+    , decltype(_impl_.version_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.cache_data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.cache_data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+CacheReplicateItem::~CacheReplicateItem() {
+  // @@protoc_insertion_point(destructor:CacheMessageProto.CacheReplicateItem)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CacheReplicateItem::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.cache_data_.Destroy();
+}
+
+void CacheReplicateItem::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CacheReplicateItem::Clear() {
+// @@protoc_insertion_point(message_clear_start:CacheMessageProto.CacheReplicateItem)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.cache_data_.ClearToEmpty();
+  ::memset(&_impl_.cache_id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.version_) -
+      reinterpret_cast<char*>(&_impl_.cache_id_)) + sizeof(_impl_.version_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CacheReplicateItem::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 cache_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.cache_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 version = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.version_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes cache_data = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_cache_data();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CacheReplicateItem::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CacheMessageProto.CacheReplicateItem)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 cache_id = 1;
+  if (this->_internal_cache_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_cache_id(), target);
+  }
+
+  // uint64 version = 2;
+  if (this->_internal_version() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_version(), target);
+  }
+
+  // bytes cache_data = 3;
+  if (!this->_internal_cache_data().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_cache_data(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CacheMessageProto.CacheReplicateItem)
+  return target;
+}
+
+size_t CacheReplicateItem::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CacheMessageProto.CacheReplicateItem)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes cache_data = 3;
+  if (!this->_internal_cache_data().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_cache_data());
+  }
+
+  // uint64 cache_id = 1;
+  if (this->_internal_cache_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_cache_id());
+  }
+
+  // uint64 version = 2;
+  if (this->_internal_version() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_version());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CacheReplicateItem::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CacheReplicateItem::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CacheReplicateItem::GetClassData() const { return &_class_data_; }
+
+
+void CacheReplicateItem::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CacheReplicateItem*>(&to_msg);
+  auto& from = static_cast<const CacheReplicateItem&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CacheMessageProto.CacheReplicateItem)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_cache_data().empty()) {
+    _this->_internal_set_cache_data(from._internal_cache_data());
+  }
+  if (from._internal_cache_id() != 0) {
+    _this->_internal_set_cache_id(from._internal_cache_id());
+  }
+  if (from._internal_version() != 0) {
+    _this->_internal_set_version(from._internal_version());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CacheReplicateItem::CopyFrom(const CacheReplicateItem& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CacheMessageProto.CacheReplicateItem)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CacheReplicateItem::IsInitialized() const {
+  return true;
+}
+
+void CacheReplicateItem::InternalSwap(CacheReplicateItem* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.cache_data_, lhs_arena,
+      &other->_impl_.cache_data_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CacheReplicateItem, _impl_.version_)
+      + sizeof(CacheReplicateItem::_impl_.version_)
+      - PROTOBUF_FIELD_OFFSET(CacheReplicateItem, _impl_.cache_id_)>(
+          reinterpret_cast<char*>(&_impl_.cache_id_),
+          reinterpret_cast<char*>(&other->_impl_.cache_id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CacheReplicateItem::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_cache_5fmessage_2eproto_getter, &descriptor_table_cache_5fmessage_2eproto_once,
+      file_level_metadata_cache_5fmessage_2eproto[8]);
+}
+
+// ===================================================================
+
+class CacheReplicate::_Internal {
+ public:
+};
+
+CacheReplicate::CacheReplicate(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CacheMessageProto.CacheReplicate)
+}
+CacheReplicate::CacheReplicate(const CacheReplicate& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CacheReplicate* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.items_){from._impl_.items_}
+    , decltype(_impl_.session_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.session_ = from._impl_.session_;
+  // @@protoc_insertion_point(copy_constructor:CacheMessageProto.CacheReplicate)
+}
+
+inline void CacheReplicate::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.items_){arena}
+    , decltype(_impl_.session_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+CacheReplicate::~CacheReplicate() {
+  // @@protoc_insertion_point(destructor:CacheMessageProto.CacheReplicate)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CacheReplicate::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.items_.~RepeatedPtrField();
+}
+
+void CacheReplicate::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CacheReplicate::Clear() {
+// @@protoc_insertion_point(message_clear_start:CacheMessageProto.CacheReplicate)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.items_.Clear();
+  _impl_.session_ = uint64_t{0u};
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CacheReplicate::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .CacheMessageProto.CacheReplicateItem items = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_items(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 session = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.session_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CacheReplicate::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CacheMessageProto.CacheReplicate)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .CacheMessageProto.CacheReplicateItem items = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_items_size()); i < n; i++) {
+    const auto& repfield = this->_internal_items(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // uint64 session = 2;
+  if (this->_internal_session() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_session(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CacheMessageProto.CacheReplicate)
+  return target;
+}
+
+size_t CacheReplicate::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CacheMessageProto.CacheReplicate)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .CacheMessageProto.CacheReplicateItem items = 1;
+  total_size += 1UL * this->_internal_items_size();
+  for (const auto& msg : this->_impl_.items_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // uint64 session = 2;
+  if (this->_internal_session() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_session());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CacheReplicate::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CacheReplicate::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CacheReplicate::GetClassData() const { return &_class_data_; }
+
+
+void CacheReplicate::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CacheReplicate*>(&to_msg);
+  auto& from = static_cast<const CacheReplicate&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CacheMessageProto.CacheReplicate)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.items_.MergeFrom(from._impl_.items_);
+  if (from._internal_session() != 0) {
+    _this->_internal_set_session(from._internal_session());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CacheReplicate::CopyFrom(const CacheReplicate& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CacheMessageProto.CacheReplicate)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CacheReplicate::IsInitialized() const {
+  return true;
+}
+
+void CacheReplicate::InternalSwap(CacheReplicate* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.items_.InternalSwap(&other->_impl_.items_);
+  swap(_impl_.session_, other->_impl_.session_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CacheReplicate::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_cache_5fmessage_2eproto_getter, &descriptor_table_cache_5fmessage_2eproto_once,
+      file_level_metadata_cache_5fmessage_2eproto[9]);
+}
+
+// ===================================================================
+
+class CacheMessage::_Internal {
+ public:
+  static const ::CacheMessageProto::CacheMessageHeader& header(const CacheMessage* msg);
+  static const ::CacheMessageProto::CacheReadRequest& read_request(const CacheMessage* msg);
+  static const ::CacheMessageProto::CacheUpdateRequest& update_request(const CacheMessage* msg);
+  static const ::CacheMessageProto::CacheOpResponse& op_response(const CacheMessage* msg);
+  static const ::CacheMessageProto::CacheReadManyRequest& read_many_request(const CacheMessage* msg);
+  static const ::CacheMessageProto::CacheUpdateManyRequest& update_many_request(const CacheMessage* msg);
+  static const ::CacheMessageProto::CacheInvalidate& invalidate(const CacheMessage* msg);
+  static const ::CacheMessageProto::CacheReplicate& replicate(const CacheMessage* msg);
+};
+
+const ::CacheMessageProto::CacheMessageHeader&
+CacheMessage::_Internal::header(const CacheMessage* msg) {
+  return *msg->_impl_.header_;
+}
+const ::CacheMessageProto::CacheReadRequest&
+CacheMessage::_Internal::read_request(const CacheMessage* msg) {
+  return *msg->_impl_.read_request_;
+}
+const ::CacheMessageProto::CacheUpdateRequest&
+CacheMessage::_Internal::update_request(const CacheMessage* msg) {
+  return *msg->_impl_.update_request_;
+}
+const ::CacheMessageProto::CacheOpResponse&
+CacheMessage::_Internal::op_response(const CacheMessage* msg) {
+  return *msg->_impl_.op_response_;
+}
+const ::CacheMessageProto::CacheReadManyRequest&
+CacheMessage::_Internal::read_many_request(const CacheMessage* msg) {
+  return *msg->_impl_.read_many_request_;
+}
+const ::CacheMessageProto::CacheUpdateManyRequest&
+CacheMessage::_Internal::update_many_request(const CacheMessage* msg) {
+  return *msg->_impl_.update_many_request_;
+}
+const ::CacheMessageProto::CacheInvalidate&
+CacheMessage::_Internal::invalidate(const CacheMessage* msg) {
+  return *msg->_impl_.invalidate_;
+}
+const ::CacheMessageProto::CacheReplicate&
+CacheMessage::_Internal::replicate(const CacheMessage* msg) {
+  return *msg->_impl_.replicate_;
+}
+CacheMessage::CacheMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CacheMessageProto.CacheMessage)
+}
+CacheMessage::CacheMessage(const CacheMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CacheMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.op_responses_){from._impl_.op_responses_}
+    , decltype(_impl_.header_){nullptr}
+    , decltype(_impl_.read_request_){nullptr}
+    , decltype(_impl_.update_request_){nullptr}
+    , decltype(_impl_.op_response_){nullptr}
+    , decltype(_impl_.read_many_request_){nullptr}
+    , decltype(_impl_.update_many_request_){nullptr}
+    , decltype(_impl_.invalidate_){nullptr}
+    , decltype(_impl_.replicate_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_header()) {
+    _this->_impl_.header_ = new ::CacheMessageProto::CacheMessageHeader(*from._impl_.header_);
+  }
+  if (from._internal_has_read_request()) {
+    _this->_impl_.read_request_ = new ::CacheMessageProto::CacheReadRequest(*from._impl_.read_request_);
+  }
+  if (from._internal_has_update_request()) {
+    _this->_impl_.update_request_ = new ::CacheMessageProto::CacheUpdateRequest(*from._impl_.update_request_);
+  }
+  if (from._internal_has_op_response()) {
+    _this->_impl_.op_response_ = new ::CacheMessageProto::CacheOpResponse(*from._impl_.op_response_);
+  }
+  if (from._internal_has_read_many_request()) {
+    _this->_impl_.read_many_request_ = new ::CacheMessageProto::CacheReadManyRequest(*from._impl_.read_many_request_);
+  }
+  if (from._internal_has_update_many_request()) {
+    _this->_impl_.update_many_request_ = new ::CacheMessageProto::CacheUpdateManyRequest(*from._impl_.update_many_request_);
+  }
+  if (from._internal_has_invalidate()) {
+    _this->_impl_.invalidate_ = new ::CacheMessageProto::CacheInvalidate(*from._impl_.invalidate_);
+  }
+  if (from._internal_has_replicate()) {
+    _this->_impl_.replicate_ = new ::CacheMessageProto::CacheReplicate(*from._impl_.replicate_);
+  }
+  // @@protoc_insertion_point(copy_constructor:CacheMessageProto.CacheMessage)
+}
+
+inline void CacheMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.op_responses_){arena}
+    , decltype(_impl_.header_){nullptr}
+    , decltype(_impl_.read_request_){nullptr}
+    , decltype(_impl_.update_request_){nullptr}
+    , decltype(_impl_.op_response_){nullptr}
+    , decltype(_impl_.read_many_request_){nullptr}
+    , decltype(_impl_.update_many_request_){nullptr}
+    , decltype(_impl_.invalidate_){nullptr}
+    , decltype(_impl_.replicate_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+CacheMessage::~CacheMessage() {
+  // @@protoc_insertion_point(destructor:CacheMessageProto.CacheMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CacheMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.op_responses_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.header_;
+  if (this != internal_default_instance()) delete _impl_.read_request_;
+  if (this != internal_default_instance()) delete _impl_.update_request_;
+  if (this != internal_default_instance()) delete _impl_.op_response_;
+  if (this != internal_default_instance()) delete _impl_.read_many_request_;
+  if (this != internal_default_instance()) delete _impl_.update_many_request_;
+  if (this != internal_default_instance()) delete _impl_.invalidate_;
+  if (this != internal_default_instance()) delete _impl_.replicate_;
+}
+
+void CacheMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CacheMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:CacheMessageProto.CacheMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.op_responses_.Clear();
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.read_request_ != nullptr) {
+    delete _impl_.read_request_;
+  }
+  _impl_.read_request_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.update_request_ != nullptr) {
+    delete _impl_.update_request_;
+  }
+  _impl_.update_request_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.op_response_ != nullptr) {
+    delete _impl_.op_response_;
+  }
+  _impl_.op_response_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.read_many_request_ != nullptr) {
+    delete _impl_.read_many_request_;
+  }
+  _impl_.read_many_request_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.update_many_request_ != nullptr) {
+    delete _impl_.update_many_request_;
+  }
+  _impl_.update_many_request_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.invalidate_ != nullptr) {
+    delete _impl_.invalidate_;
+  }
+  _impl_.invalidate_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.replicate_ != nullptr) {
+    delete _impl_.replicate_;
+  }
+  _impl_.replicate_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CacheMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .CacheMessageProto.CacheMessageHeader header = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_header(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .CacheMessageProto.CacheReadRequest read_request = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_read_request(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .CacheMessageProto.CacheUpdateRequest update_request = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_update_request(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .CacheMessageProto.CacheOpResponse op_response = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_op_response(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .CacheMessageProto.CacheReadManyRequest read_many_request = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_read_many_request(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .CacheMessageProto.CacheUpdateManyRequest update_many_request = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ctx->ParseMessage(_internal_mutable_update_many_request(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .CacheMessageProto.CacheOpResponse op_responses = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_op_responses(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<58>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // .CacheMessageProto.CacheInvalidate invalidate = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr = ctx->ParseMessage(_internal_mutable_invalidate(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .CacheMessageProto.CacheReplicate replicate = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          ptr = ctx->ParseMessage(_internal_mutable_replicate(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CacheMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CacheMessageProto.CacheMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .CacheMessageProto.CacheMessageHeader header = 1;
+  if (this->_internal_has_header()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::header(this),
+        _Internal::header(this).GetCachedSize(), target, stream);
+  }
+
+  // .CacheMessageProto.CacheReadRequest read_request = 2;
+  if (this->_internal_has_read_request()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::read_request(this),
+        _Internal::read_request(this).GetCachedSize(), target, stream);
+  }
+
+  // .CacheMessageProto.CacheUpdateRequest update_request = 3;
+  if (this->_internal_has_update_request()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::update_request(this),
+        _Internal::update_request(this).GetCachedSize(), target, stream);
+  }
+
+  // .CacheMessageProto.CacheOpResponse op_response = 4;
+  if (this->_internal_has_op_response()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::op_response(this),
+        _Internal::op_response(this).GetCachedSize(), target, stream);
+  }
+
+  // .CacheMessageProto.CacheReadManyRequest read_many_request = 5;
+  if (this->_internal_has_read_many_request()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, _Internal::read_many_request(this),
+        _Internal::read_many_request(this).GetCachedSize(), target, stream);
+  }
+
+  // .CacheMessageProto.CacheUpdateManyRequest update_many_request = 6;
+  if (this->_internal_has_update_many_request()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(6, _Internal::update_many_request(this),
+        _Internal::update_many_request(this).GetCachedSize(), target, stream);
+  }
+
+  // repeated .CacheMessageProto.CacheOpResponse op_responses = 7;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_op_responses_size()); i < n; i++) {
+    const auto& repfield = this->_internal_op_responses(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(7, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // .CacheMessageProto.CacheInvalidate invalidate = 8;
+  if (this->_internal_has_invalidate()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(8, _Internal::invalidate(this),
+        _Internal::invalidate(this).GetCachedSize(), target, stream);
+  }
+
+  // .CacheMessageProto.CacheReplicate replicate = 9;
+  if (this->_internal_has_replicate()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(9, _Internal::replicate(this),
+        _Internal::replicate(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CacheMessageProto.CacheMessage)
+  return target;
+}
+
+size_t CacheMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CacheMessageProto.CacheMessage)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .CacheMessageProto.CacheOpResponse op_responses = 7;
+  total_size += 1UL * this->_internal_op_responses_size();
+  for (const auto& msg : this->_impl_.op_responses_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // .CacheMessageProto.CacheMessageHeader header = 1;
+  if (this->_internal_has_header()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.header_);
+  }
+
+  // .CacheMessageProto.CacheReadRequest read_request = 2;
+  if (this->_internal_has_read_request()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.read_request_);
+  }
+
+  // .CacheMessageProto.CacheUpdateRequest update_request = 3;
+  if (this->_internal_has_update_request()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.update_request_);
+  }
+
+  // .CacheMessageProto.CacheOpResponse op_response = 4;
+  if (this->_internal_has_op_response()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.op_response_);
+  }
+
+  // .CacheMessageProto.CacheReadManyRequest read_many_request = 5;
+  if (this->_internal_has_read_many_request()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.read_many_request_);
+  }
+
+  // .CacheMessageProto.CacheUpdateManyRequest update_many_request = 6;
+  if (this->_internal_has_update_many_request()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.update_many_request_);
+  }
+
+  // .CacheMessageProto.CacheInvalidate invalidate = 8;
+  if (this->_internal_has_invalidate()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.invalidate_);
+  }
+
+  // .CacheMessageProto.CacheReplicate replicate = 9;
+  if (this->_internal_has_replicate()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.replicate_);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CacheMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CacheMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CacheMessage::GetClassData() const { return &_class_data_; }
+
+
+void CacheMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CacheMessage*>(&to_msg);
+  auto& from = static_cast<const CacheMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CacheMessageProto.CacheMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.op_responses_.MergeFrom(from._impl_.op_responses_);
+  if (from._internal_has_header()) {
+    _this->_internal_mutable_header()->::CacheMessageProto::CacheMessageHeader::MergeFrom(
+        from._internal_header());
+  }
+  if (from._internal_has_read_request()) {
+    _this->_internal_mutable_read_request()->::CacheMessageProto::CacheReadRequest::MergeFrom(
+        from._internal_read_request());
+  }
+  if (from._internal_has_update_request()) {
+    _this->_internal_mutable_update_request()->::CacheMessageProto::CacheUpdateRequest::MergeFrom(
+        from._internal_update_request());
+  }
+  if (from._internal_has_op_response()) {
+    _this->_internal_mutable_op_response()->::CacheMessageProto::CacheOpResponse::MergeFrom(
+        from._internal_op_response());
+  }
+  if (from._internal_has_read_many_request()) {
+    _this->_internal_mutable_read_many_request()->::CacheMessageProto::CacheReadManyRequest::MergeFrom(
+        from._internal_read_many_request());
+  }
+  if (from._internal_has_update_many_request()) {
+    _this->_internal_mutable_update_many_request()->::CacheMessageProto::CacheUpdateManyRequest::MergeFrom(
+        from._internal_update_many_request());
+  }
+  if (from._internal_has_invalidate()) {
+    _this->_internal_mutable_invalidate()->::CacheMessageProto::CacheInvalidate::MergeFrom(
+        from._internal_invalidate());
+  }
+  if (from._internal_has_replicate()) {
+    _this->_internal_mutable_replicate()->::CacheMessageProto::CacheReplicate::MergeFrom(
+        from._internal_replicate());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CacheMessage::CopyFrom(const CacheMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CacheMessageProto.CacheMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CacheMessage::IsInitialized() const {
+  return true;
+}
+
+void CacheMessage::InternalSwap(CacheMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.op_responses_.InternalSwap(&other->_impl_.op_responses_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CacheMessage, _impl_.replicate_)
+      + sizeof(CacheMessage::_impl_.replicate_)
+      - PROTOBUF_FIELD_OFFSET(CacheMessage, _impl_.header_)>(
+          reinterpret_cast<char*>(&_impl_.header_),
+          reinterpret_cast<char*>(&other->_impl_.header_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CacheMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_cache_5fmessage_2eproto_getter, &descriptor_table_cache_5fmessage_2eproto_once,
+      file_level_metadata_cache_5fmessage_2eproto[10]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace CacheMessageProto
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::CacheMessageProto::CacheMessageHeader*
+Arena::CreateMaybeMessage< ::CacheMessageProto::CacheMessageHeader >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CacheMessageProto::CacheMessageHeader >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CacheMessageProto::CacheReadRequest*
+Arena::CreateMaybeMessage< ::CacheMessageProto::CacheReadRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CacheMessageProto::CacheReadRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CacheMessageProto::CacheUpdateRequest*
+Arena::CreateMaybeMessage< ::CacheMessageProto::CacheUpdateRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CacheMessageProto::CacheUpdateRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CacheMessageProto::CacheReadManyRequest*
+Arena::CreateMaybeMessage< ::CacheMessageProto::CacheReadManyRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CacheMessageProto::CacheReadManyRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CacheMessageProto::CacheUpdateItem*
+Arena::CreateMaybeMessage< ::CacheMessageProto::CacheUpdateItem >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CacheMessageProto::CacheUpdateItem >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CacheMessageProto::CacheUpdateManyRequest*
+Arena::CreateMaybeMessage< ::CacheMessageProto::CacheUpdateManyRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CacheMessageProto::CacheUpdateManyRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CacheMessageProto::CacheOpResponse*
+Arena::CreateMaybeMessage< ::CacheMessageProto::CacheOpResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CacheMessageProto::CacheOpResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CacheMessageProto::CacheInvalidate*
+Arena::CreateMaybeMessage< ::CacheMessageProto::CacheInvalidate >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CacheMessageProto::CacheInvalidate >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CacheMessageProto::CacheReplicateItem*
+Arena::CreateMaybeMessage< ::CacheMessageProto::CacheReplicateItem >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CacheMessageProto::CacheReplicateItem >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CacheMessageProto::CacheReplicate*
+Arena::CreateMaybeMessage< ::CacheMessageProto::CacheReplicate >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CacheMessageProto::CacheReplicate >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CacheMessageProto::CacheMessage*
+Arena::CreateMaybeMessage< ::CacheMessageProto::CacheMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CacheMessageProto::CacheMessage >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
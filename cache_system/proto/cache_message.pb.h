@@ -0,0 +1,3996 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: cache_message.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_cache_5fmessage_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_cache_5fmessage_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_cache_5fmessage_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_cache_5fmessage_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_cache_5fmessage_2eproto;
+namespace CacheMessageProto {
+class CacheInvalidate;
+struct CacheInvalidateDefaultTypeInternal;
+extern CacheInvalidateDefaultTypeInternal _CacheInvalidate_default_instance_;
+class CacheMessage;
+struct CacheMessageDefaultTypeInternal;
+extern CacheMessageDefaultTypeInternal _CacheMessage_default_instance_;
+class CacheMessageHeader;
+struct CacheMessageHeaderDefaultTypeInternal;
+extern CacheMessageHeaderDefaultTypeInternal _CacheMessageHeader_default_instance_;
+class CacheOpResponse;
+struct CacheOpResponseDefaultTypeInternal;
+extern CacheOpResponseDefaultTypeInternal _CacheOpResponse_default_instance_;
+class CacheReadManyRequest;
+struct CacheReadManyRequestDefaultTypeInternal;
+extern CacheReadManyRequestDefaultTypeInternal _CacheReadManyRequest_default_instance_;
+class CacheReadRequest;
+struct CacheReadRequestDefaultTypeInternal;
+extern CacheReadRequestDefaultTypeInternal _CacheReadRequest_default_instance_;
+class CacheReplicate;
+struct CacheReplicateDefaultTypeInternal;
+extern CacheReplicateDefaultTypeInternal _CacheReplicate_default_instance_;
+class CacheReplicateItem;
+struct CacheReplicateItemDefaultTypeInternal;
+extern CacheReplicateItemDefaultTypeInternal _CacheReplicateItem_default_instance_;
+class CacheUpdateItem;
+struct CacheUpdateItemDefaultTypeInternal;
+extern CacheUpdateItemDefaultTypeInternal _CacheUpdateItem_default_instance_;
+class CacheUpdateManyRequest;
+struct CacheUpdateManyRequestDefaultTypeInternal;
+extern CacheUpdateManyRequestDefaultTypeInternal _CacheUpdateManyRequest_default_instance_;
+class CacheUpdateRequest;
+struct CacheUpdateRequestDefaultTypeInternal;
+extern CacheUpdateRequestDefaultTypeInternal _CacheUpdateRequest_default_instance_;
+}  // namespace CacheMessageProto
+PROTOBUF_NAMESPACE_OPEN
+template<> ::CacheMessageProto::CacheInvalidate* Arena::CreateMaybeMessage<::CacheMessageProto::CacheInvalidate>(Arena*);
+template<> ::CacheMessageProto::CacheMessage* Arena::CreateMaybeMessage<::CacheMessageProto::CacheMessage>(Arena*);
+template<> ::CacheMessageProto::CacheMessageHeader* Arena::CreateMaybeMessage<::CacheMessageProto::CacheMessageHeader>(Arena*);
+template<> ::CacheMessageProto::CacheOpResponse* Arena::CreateMaybeMessage<::CacheMessageProto::CacheOpResponse>(Arena*);
+template<> ::CacheMessageProto::CacheReadManyRequest* Arena::CreateMaybeMessage<::CacheMessageProto::CacheReadManyRequest>(Arena*);
+template<> ::CacheMessageProto::CacheReadRequest* Arena::CreateMaybeMessage<::CacheMessageProto::CacheReadRequest>(Arena*);
+template<> ::CacheMessageProto::CacheReplicate* Arena::CreateMaybeMessage<::CacheMessageProto::CacheReplicate>(Arena*);
+template<> ::CacheMessageProto::CacheReplicateItem* Arena::CreateMaybeMessage<::CacheMessageProto::CacheReplicateItem>(Arena*);
+template<> ::CacheMessageProto::CacheUpdateItem* Arena::CreateMaybeMessage<::CacheMessageProto::CacheUpdateItem>(Arena*);
+template<> ::CacheMessageProto::CacheUpdateManyRequest* Arena::CreateMaybeMessage<::CacheMessageProto::CacheUpdateManyRequest>(Arena*);
+template<> ::CacheMessageProto::CacheUpdateRequest* Arena::CreateMaybeMessage<::CacheMessageProto::CacheUpdateRequest>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace CacheMessageProto {
+
+enum CacheMessageType : int {
+  kDummyType = 0,
+  kReadRequest = 4097,
+  kReadResponse = 4098,
+  kUpdateRequest = 4099,
+  kUpdateResponse = 4100,
+  kOperationAck = 4101,
+  kInvalidateCache = 4102,
+  kReadManyRequest = 4103,
+  kReadManyResponse = 4104,
+  kUpdateManyRequest = 4105,
+  kUpdateManyResponse = 4106,
+  kReplicateUpdates = 4107,
+  CacheMessageType_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  CacheMessageType_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool CacheMessageType_IsValid(int value);
+constexpr CacheMessageType CacheMessageType_MIN = kDummyType;
+constexpr CacheMessageType CacheMessageType_MAX = kReplicateUpdates;
+constexpr int CacheMessageType_ARRAYSIZE = CacheMessageType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* CacheMessageType_descriptor();
+template<typename T>
+inline const std::string& CacheMessageType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, CacheMessageType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function CacheMessageType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    CacheMessageType_descriptor(), enum_t_value);
+}
+inline bool CacheMessageType_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, CacheMessageType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<CacheMessageType>(
+    CacheMessageType_descriptor(), name, value);
+}
+// ===================================================================
+
+class CacheMessageHeader final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CacheMessageProto.CacheMessageHeader) */ {
+ public:
+  inline CacheMessageHeader() : CacheMessageHeader(nullptr) {}
+  ~CacheMessageHeader() override;
+  explicit PROTOBUF_CONSTEXPR CacheMessageHeader(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CacheMessageHeader(const CacheMessageHeader& from);
+  CacheMessageHeader(CacheMessageHeader&& from) noexcept
+    : CacheMessageHeader() {
+    *this = ::std::move(from);
+  }
+
+  inline CacheMessageHeader& operator=(const CacheMessageHeader& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CacheMessageHeader& operator=(CacheMessageHeader&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CacheMessageHeader& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CacheMessageHeader* internal_default_instance() {
+    return reinterpret_cast<const CacheMessageHeader*>(
+               &_CacheMessageHeader_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(CacheMessageHeader& a, CacheMessageHeader& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CacheMessageHeader* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CacheMessageHeader* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CacheMessageHeader* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CacheMessageHeader>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CacheMessageHeader& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CacheMessageHeader& from) {
+    CacheMessageHeader::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CacheMessageHeader* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CacheMessageProto.CacheMessageHeader";
+  }
+  protected:
+  explicit CacheMessageHeader(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMagicFieldNumber = 1,
+    kVersionFieldNumber = 2,
+    kOpIdFieldNumber = 4,
+    kTypeFieldNumber = 3,
+    kSequenceFieldNumber = 5,
+  };
+  // uint32 magic = 1;
+  void clear_magic();
+  uint32_t magic() const;
+  void set_magic(uint32_t value);
+  private:
+  uint32_t _internal_magic() const;
+  void _internal_set_magic(uint32_t value);
+  public:
+
+  // uint32 version = 2;
+  void clear_version();
+  uint32_t version() const;
+  void set_version(uint32_t value);
+  private:
+  uint32_t _internal_version() const;
+  void _internal_set_version(uint32_t value);
+  public:
+
+  // uint64 op_id = 4;
+  void clear_op_id();
+  uint64_t op_id() const;
+  void set_op_id(uint64_t value);
+  private:
+  uint64_t _internal_op_id() const;
+  void _internal_set_op_id(uint64_t value);
+  public:
+
+  // .CacheMessageProto.CacheMessageType type = 3;
+  void clear_type();
+  ::CacheMessageProto::CacheMessageType type() const;
+  void set_type(::CacheMessageProto::CacheMessageType value);
+  private:
+  ::CacheMessageProto::CacheMessageType _internal_type() const;
+  void _internal_set_type(::CacheMessageProto::CacheMessageType value);
+  public:
+
+  // uint32 sequence = 5;
+  void clear_sequence();
+  uint32_t sequence() const;
+  void set_sequence(uint32_t value);
+  private:
+  uint32_t _internal_sequence() const;
+  void _internal_set_sequence(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CacheMessageProto.CacheMessageHeader)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint32_t magic_;
+    uint32_t version_;
+    uint64_t op_id_;
+    int type_;
+    uint32_t sequence_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_cache_5fmessage_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CacheReadRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CacheMessageProto.CacheReadRequest) */ {
+ public:
+  inline CacheReadRequest() : CacheReadRequest(nullptr) {}
+  ~CacheReadRequest() override;
+  explicit PROTOBUF_CONSTEXPR CacheReadRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CacheReadRequest(const CacheReadRequest& from);
+  CacheReadRequest(CacheReadRequest&& from) noexcept
+    : CacheReadRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline CacheReadRequest& operator=(const CacheReadRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CacheReadRequest& operator=(CacheReadRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CacheReadRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CacheReadRequest* internal_default_instance() {
+    return reinterpret_cast<const CacheReadRequest*>(
+               &_CacheReadRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(CacheReadRequest& a, CacheReadRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CacheReadRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CacheReadRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CacheReadRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CacheReadRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CacheReadRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CacheReadRequest& from) {
+    CacheReadRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CacheReadRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CacheMessageProto.CacheReadRequest";
+  }
+  protected:
+  explicit CacheReadRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTimestampFieldNumber = 1,
+    kExpireFieldNumber = 2,
+    kCacheIdFieldNumber = 3,
+    kVersionFieldNumber = 4,
+  };
+  // uint64 timestamp = 1;
+  void clear_timestamp();
+  uint64_t timestamp() const;
+  void set_timestamp(uint64_t value);
+  private:
+  uint64_t _internal_timestamp() const;
+  void _internal_set_timestamp(uint64_t value);
+  public:
+
+  // uint32 expire = 2;
+  void clear_expire();
+  uint32_t expire() const;
+  void set_expire(uint32_t value);
+  private:
+  uint32_t _internal_expire() const;
+  void _internal_set_expire(uint32_t value);
+  public:
+
+  // uint32 cache_id = 3;
+  void clear_cache_id();
+  uint32_t cache_id() const;
+  void set_cache_id(uint32_t value);
+  private:
+  uint32_t _internal_cache_id() const;
+  void _internal_set_cache_id(uint32_t value);
+  public:
+
+  // uint64 version = 4;
+  void clear_version();
+  uint64_t version() const;
+  void set_version(uint64_t value);
+  private:
+  uint64_t _internal_version() const;
+  void _internal_set_version(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CacheMessageProto.CacheReadRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint64_t timestamp_;
+    uint32_t expire_;
+    uint32_t cache_id_;
+    uint64_t version_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_cache_5fmessage_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CacheUpdateRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CacheMessageProto.CacheUpdateRequest) */ {
+ public:
+  inline CacheUpdateRequest() : CacheUpdateRequest(nullptr) {}
+  ~CacheUpdateRequest() override;
+  explicit PROTOBUF_CONSTEXPR CacheUpdateRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CacheUpdateRequest(const CacheUpdateRequest& from);
+  CacheUpdateRequest(CacheUpdateRequest&& from) noexcept
+    : CacheUpdateRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline CacheUpdateRequest& operator=(const CacheUpdateRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CacheUpdateRequest& operator=(CacheUpdateRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CacheUpdateRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CacheUpdateRequest* internal_default_instance() {
+    return reinterpret_cast<const CacheUpdateRequest*>(
+               &_CacheUpdateRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(CacheUpdateRequest& a, CacheUpdateRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CacheUpdateRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CacheUpdateRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CacheUpdateRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CacheUpdateRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CacheUpdateRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CacheUpdateRequest& from) {
+    CacheUpdateRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CacheUpdateRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CacheMessageProto.CacheUpdateRequest";
+  }
+  protected:
+  explicit CacheUpdateRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kCacheDataFieldNumber = 4,
+    kTimestampFieldNumber = 1,
+    kExpireFieldNumber = 2,
+    kCacheIdFieldNumber = 3,
+  };
+  // bytes cache_data = 4;
+  void clear_cache_data();
+  const std::string& cache_data() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_cache_data(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_cache_data();
+  PROTOBUF_NODISCARD std::string* release_cache_data();
+  void set_allocated_cache_data(std::string* cache_data);
+  private:
+  const std::string& _internal_cache_data() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_cache_data(const std::string& value);
+  std::string* _internal_mutable_cache_data();
+  public:
+
+  // uint64 timestamp = 1;
+  void clear_timestamp();
+  uint64_t timestamp() const;
+  void set_timestamp(uint64_t value);
+  private:
+  uint64_t _internal_timestamp() const;
+  void _internal_set_timestamp(uint64_t value);
+  public:
+
+  // uint32 expire = 2;
+  void clear_expire();
+  uint32_t expire() const;
+  void set_expire(uint32_t value);
+  private:
+  uint32_t _internal_expire() const;
+  void _internal_set_expire(uint32_t value);
+  public:
+
+  // uint32 cache_id = 3;
+  void clear_cache_id();
+  uint32_t cache_id() const;
+  void set_cache_id(uint32_t value);
+  private:
+  uint32_t _internal_cache_id() const;
+  void _internal_set_cache_id(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CacheMessageProto.CacheUpdateRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr cache_data_;
+    uint64_t timestamp_;
+    uint32_t expire_;
+    uint32_t cache_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_cache_5fmessage_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CacheReadManyRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CacheMessageProto.CacheReadManyRequest) */ {
+ public:
+  inline CacheReadManyRequest() : CacheReadManyRequest(nullptr) {}
+  ~CacheReadManyRequest() override;
+  explicit PROTOBUF_CONSTEXPR CacheReadManyRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CacheReadManyRequest(const CacheReadManyRequest& from);
+  CacheReadManyRequest(CacheReadManyRequest&& from) noexcept
+    : CacheReadManyRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline CacheReadManyRequest& operator=(const CacheReadManyRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CacheReadManyRequest& operator=(CacheReadManyRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CacheReadManyRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CacheReadManyRequest* internal_default_instance() {
+    return reinterpret_cast<const CacheReadManyRequest*>(
+               &_CacheReadManyRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(CacheReadManyRequest& a, CacheReadManyRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CacheReadManyRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CacheReadManyRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CacheReadManyRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CacheReadManyRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CacheReadManyRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CacheReadManyRequest& from) {
+    CacheReadManyRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CacheReadManyRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CacheMessageProto.CacheReadManyRequest";
+  }
+  protected:
+  explicit CacheReadManyRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kCacheIdsFieldNumber = 3,
+    kTimestampFieldNumber = 1,
+    kExpireFieldNumber = 2,
+  };
+  // repeated uint32 cache_ids = 3;
+  int cache_ids_size() const;
+  private:
+  int _internal_cache_ids_size() const;
+  public:
+  void clear_cache_ids();
+  private:
+  uint32_t _internal_cache_ids(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_cache_ids() const;
+  void _internal_add_cache_ids(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_cache_ids();
+  public:
+  uint32_t cache_ids(int index) const;
+  void set_cache_ids(int index, uint32_t value);
+  void add_cache_ids(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      cache_ids() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_cache_ids();
+
+  // uint64 timestamp = 1;
+  void clear_timestamp();
+  uint64_t timestamp() const;
+  void set_timestamp(uint64_t value);
+  private:
+  uint64_t _internal_timestamp() const;
+  void _internal_set_timestamp(uint64_t value);
+  public:
+
+  // uint32 expire = 2;
+  void clear_expire();
+  uint32_t expire() const;
+  void set_expire(uint32_t value);
+  private:
+  uint32_t _internal_expire() const;
+  void _internal_set_expire(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CacheMessageProto.CacheReadManyRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > cache_ids_;
+    mutable std::atomic<int> _cache_ids_cached_byte_size_;
+    uint64_t timestamp_;
+    uint32_t expire_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_cache_5fmessage_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CacheUpdateItem final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CacheMessageProto.CacheUpdateItem) */ {
+ public:
+  inline CacheUpdateItem() : CacheUpdateItem(nullptr) {}
+  ~CacheUpdateItem() override;
+  explicit PROTOBUF_CONSTEXPR CacheUpdateItem(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CacheUpdateItem(const CacheUpdateItem& from);
+  CacheUpdateItem(CacheUpdateItem&& from) noexcept
+    : CacheUpdateItem() {
+    *this = ::std::move(from);
+  }
+
+  inline CacheUpdateItem& operator=(const CacheUpdateItem& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CacheUpdateItem& operator=(CacheUpdateItem&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CacheUpdateItem& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CacheUpdateItem* internal_default_instance() {
+    return reinterpret_cast<const CacheUpdateItem*>(
+               &_CacheUpdateItem_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(CacheUpdateItem& a, CacheUpdateItem& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CacheUpdateItem* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CacheUpdateItem* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CacheUpdateItem* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CacheUpdateItem>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CacheUpdateItem& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CacheUpdateItem& from) {
+    CacheUpdateItem::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CacheUpdateItem* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CacheMessageProto.CacheUpdateItem";
+  }
+  protected:
+  explicit CacheUpdateItem(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kCacheDataFieldNumber = 2,
+    kCacheIdFieldNumber = 1,
+  };
+  // bytes cache_data = 2;
+  void clear_cache_data();
+  const std::string& cache_data() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_cache_data(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_cache_data();
+  PROTOBUF_NODISCARD std::string* release_cache_data();
+  void set_allocated_cache_data(std::string* cache_data);
+  private:
+  const std::string& _internal_cache_data() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_cache_data(const std::string& value);
+  std::string* _internal_mutable_cache_data();
+  public:
+
+  // uint32 cache_id = 1;
+  void clear_cache_id();
+  uint32_t cache_id() const;
+  void set_cache_id(uint32_t value);
+  private:
+  uint32_t _internal_cache_id() const;
+  void _internal_set_cache_id(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CacheMessageProto.CacheUpdateItem)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr cache_data_;
+    uint32_t cache_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_cache_5fmessage_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CacheUpdateManyRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CacheMessageProto.CacheUpdateManyRequest) */ {
+ public:
+  inline CacheUpdateManyRequest() : CacheUpdateManyRequest(nullptr) {}
+  ~CacheUpdateManyRequest() override;
+  explicit PROTOBUF_CONSTEXPR CacheUpdateManyRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CacheUpdateManyRequest(const CacheUpdateManyRequest& from);
+  CacheUpdateManyRequest(CacheUpdateManyRequest&& from) noexcept
+    : CacheUpdateManyRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline CacheUpdateManyRequest& operator=(const CacheUpdateManyRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CacheUpdateManyRequest& operator=(CacheUpdateManyRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CacheUpdateManyRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CacheUpdateManyRequest* internal_default_instance() {
+    return reinterpret_cast<const CacheUpdateManyRequest*>(
+               &_CacheUpdateManyRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(CacheUpdateManyRequest& a, CacheUpdateManyRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CacheUpdateManyRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CacheUpdateManyRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CacheUpdateManyRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CacheUpdateManyRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CacheUpdateManyRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CacheUpdateManyRequest& from) {
+    CacheUpdateManyRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CacheUpdateManyRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CacheMessageProto.CacheUpdateManyRequest";
+  }
+  protected:
+  explicit CacheUpdateManyRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kItemsFieldNumber = 3,
+    kTimestampFieldNumber = 1,
+    kExpireFieldNumber = 2,
+  };
+  // repeated .CacheMessageProto.CacheUpdateItem items = 3;
+  int items_size() const;
+  private:
+  int _internal_items_size() const;
+  public:
+  void clear_items();
+  ::CacheMessageProto::CacheUpdateItem* mutable_items(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CacheMessageProto::CacheUpdateItem >*
+      mutable_items();
+  private:
+  const ::CacheMessageProto::CacheUpdateItem& _internal_items(int index) const;
+  ::CacheMessageProto::CacheUpdateItem* _internal_add_items();
+  public:
+  const ::CacheMessageProto::CacheUpdateItem& items(int index) const;
+  ::CacheMessageProto::CacheUpdateItem* add_items();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CacheMessageProto::CacheUpdateItem >&
+      items() const;
+
+  // uint64 timestamp = 1;
+  void clear_timestamp();
+  uint64_t timestamp() const;
+  void set_timestamp(uint64_t value);
+  private:
+  uint64_t _internal_timestamp() const;
+  void _internal_set_timestamp(uint64_t value);
+  public:
+
+  // uint32 expire = 2;
+  void clear_expire();
+  uint32_t expire() const;
+  void set_expire(uint32_t value);
+  private:
+  uint32_t _internal_expire() const;
+  void _internal_set_expire(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CacheMessageProto.CacheUpdateManyRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CacheMessageProto::CacheUpdateItem > items_;
+    uint64_t timestamp_;
+    uint32_t expire_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_cache_5fmessage_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CacheOpResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CacheMessageProto.CacheOpResponse) */ {
+ public:
+  inline CacheOpResponse() : CacheOpResponse(nullptr) {}
+  ~CacheOpResponse() override;
+  explicit PROTOBUF_CONSTEXPR CacheOpResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CacheOpResponse(const CacheOpResponse& from);
+  CacheOpResponse(CacheOpResponse&& from) noexcept
+    : CacheOpResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline CacheOpResponse& operator=(const CacheOpResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CacheOpResponse& operator=(CacheOpResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CacheOpResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CacheOpResponse* internal_default_instance() {
+    return reinterpret_cast<const CacheOpResponse*>(
+               &_CacheOpResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  friend void swap(CacheOpResponse& a, CacheOpResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CacheOpResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CacheOpResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CacheOpResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CacheOpResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CacheOpResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CacheOpResponse& from) {
+    CacheOpResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CacheOpResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CacheMessageProto.CacheOpResponse";
+  }
+  protected:
+  explicit CacheOpResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kCacheDataFieldNumber = 5,
+    kTimestampFieldNumber = 2,
+    kResultFieldNumber = 1,
+    kExpireFieldNumber = 3,
+    kCacheIdFieldNumber = 4,
+    kNotModifiedFieldNumber = 7,
+    kVersionFieldNumber = 6,
+  };
+  // bytes cache_data = 5;
+  void clear_cache_data();
+  const std::string& cache_data() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_cache_data(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_cache_data();
+  PROTOBUF_NODISCARD std::string* release_cache_data();
+  void set_allocated_cache_data(std::string* cache_data);
+  private:
+  const std::string& _internal_cache_data() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_cache_data(const std::string& value);
+  std::string* _internal_mutable_cache_data();
+  public:
+
+  // uint64 timestamp = 2;
+  void clear_timestamp();
+  uint64_t timestamp() const;
+  void set_timestamp(uint64_t value);
+  private:
+  uint64_t _internal_timestamp() const;
+  void _internal_set_timestamp(uint64_t value);
+  public:
+
+  // uint32 result = 1;
+  void clear_result();
+  uint32_t result() const;
+  void set_result(uint32_t value);
+  private:
+  uint32_t _internal_result() const;
+  void _internal_set_result(uint32_t value);
+  public:
+
+  // uint32 expire = 3;
+  void clear_expire();
+  uint32_t expire() const;
+  void set_expire(uint32_t value);
+  private:
+  uint32_t _internal_expire() const;
+  void _internal_set_expire(uint32_t value);
+  public:
+
+  // uint32 cache_id = 4;
+  void clear_cache_id();
+  uint32_t cache_id() const;
+  void set_cache_id(uint32_t value);
+  private:
+  uint32_t _internal_cache_id() const;
+  void _internal_set_cache_id(uint32_t value);
+  public:
+
+  // bool not_modified = 7;
+  void clear_not_modified();
+  bool not_modified() const;
+  void set_not_modified(bool value);
+  private:
+  bool _internal_not_modified() const;
+  void _internal_set_not_modified(bool value);
+  public:
+
+  // uint64 version = 6;
+  void clear_version();
+  uint64_t version() const;
+  void set_version(uint64_t value);
+  private:
+  uint64_t _internal_version() const;
+  void _internal_set_version(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CacheMessageProto.CacheOpResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr cache_data_;
+    uint64_t timestamp_;
+    uint32_t result_;
+    uint32_t expire_;
+    uint32_t cache_id_;
+    bool not_modified_;
+    uint64_t version_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_cache_5fmessage_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CacheInvalidate final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CacheMessageProto.CacheInvalidate) */ {
+ public:
+  inline CacheInvalidate() : CacheInvalidate(nullptr) {}
+  ~CacheInvalidate() override;
+  explicit PROTOBUF_CONSTEXPR CacheInvalidate(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CacheInvalidate(const CacheInvalidate& from);
+  CacheInvalidate(CacheInvalidate&& from) noexcept
+    : CacheInvalidate() {
+    *this = ::std::move(from);
+  }
+
+  inline CacheInvalidate& operator=(const CacheInvalidate& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CacheInvalidate& operator=(CacheInvalidate&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CacheInvalidate& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CacheInvalidate* internal_default_instance() {
+    return reinterpret_cast<const CacheInvalidate*>(
+               &_CacheInvalidate_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
+
+  friend void swap(CacheInvalidate& a, CacheInvalidate& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CacheInvalidate* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CacheInvalidate* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CacheInvalidate* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CacheInvalidate>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CacheInvalidate& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CacheInvalidate& from) {
+    CacheInvalidate::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CacheInvalidate* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CacheMessageProto.CacheInvalidate";
+  }
+  protected:
+  explicit CacheInvalidate(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kVersionFieldNumber = 2,
+    kCacheIdFieldNumber = 1,
+  };
+  // uint64 version = 2;
+  void clear_version();
+  uint64_t version() const;
+  void set_version(uint64_t value);
+  private:
+  uint64_t _internal_version() const;
+  void _internal_set_version(uint64_t value);
+  public:
+
+  // uint32 cache_id = 1;
+  void clear_cache_id();
+  uint32_t cache_id() const;
+  void set_cache_id(uint32_t value);
+  private:
+  uint32_t _internal_cache_id() const;
+  void _internal_set_cache_id(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CacheMessageProto.CacheInvalidate)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint64_t version_;
+    uint32_t cache_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_cache_5fmessage_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CacheReplicateItem final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CacheMessageProto.CacheReplicateItem) */ {
+ public:
+  inline CacheReplicateItem() : CacheReplicateItem(nullptr) {}
+  ~CacheReplicateItem() override;
+  explicit PROTOBUF_CONSTEXPR CacheReplicateItem(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CacheReplicateItem(const CacheReplicateItem& from);
+  CacheReplicateItem(CacheReplicateItem&& from) noexcept
+    : CacheReplicateItem() {
+    *this = ::std::move(from);
+  }
+
+  inline CacheReplicateItem& operator=(const CacheReplicateItem& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CacheReplicateItem& operator=(CacheReplicateItem&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CacheReplicateItem& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CacheReplicateItem* internal_default_instance() {
+    return reinterpret_cast<const CacheReplicateItem*>(
+               &_CacheReplicateItem_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    8;
+
+  friend void swap(CacheReplicateItem& a, CacheReplicateItem& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CacheReplicateItem* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CacheReplicateItem* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CacheReplicateItem* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CacheReplicateItem>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CacheReplicateItem& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CacheReplicateItem& from) {
+    CacheReplicateItem::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CacheReplicateItem* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CacheMessageProto.CacheReplicateItem";
+  }
+  protected:
+  explicit CacheReplicateItem(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kCacheDataFieldNumber = 3,
+    kCacheIdFieldNumber = 1,
+    kVersionFieldNumber = 2,
+  };
+  // bytes cache_data = 3;
+  void clear_cache_data();
+  const std::string& cache_data() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_cache_data(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_cache_data();
+  PROTOBUF_NODISCARD std::string* release_cache_data();
+  void set_allocated_cache_data(std::string* cache_data);
+  private:
+  const std::string& _internal_cache_data() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_cache_data(const std::string& value);
+  std::string* _internal_mutable_cache_data();
+  public:
+
+  // uint64 cache_id = 1;
+  void clear_cache_id();
+  uint64_t cache_id() const;
+  void set_cache_id(uint64_t value);
+  private:
+  uint64_t _internal_cache_id() const;
+  void _internal_set_cache_id(uint64_t value);
+  public:
+
+  // uint64 version = 2;
+  void clear_version();
+  uint64_t version() const;
+  void set_version(uint64_t value);
+  private:
+  uint64_t _internal_version() const;
+  void _internal_set_version(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CacheMessageProto.CacheReplicateItem)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr cache_data_;
+    uint64_t cache_id_;
+    uint64_t version_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_cache_5fmessage_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CacheReplicate final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CacheMessageProto.CacheReplicate) */ {
+ public:
+  inline CacheReplicate() : CacheReplicate(nullptr) {}
+  ~CacheReplicate() override;
+  explicit PROTOBUF_CONSTEXPR CacheReplicate(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CacheReplicate(const CacheReplicate& from);
+  CacheReplicate(CacheReplicate&& from) noexcept
+    : CacheReplicate() {
+    *this = ::std::move(from);
+  }
+
+  inline CacheReplicate& operator=(const CacheReplicate& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CacheReplicate& operator=(CacheReplicate&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CacheReplicate& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CacheReplicate* internal_default_instance() {
+    return reinterpret_cast<const CacheReplicate*>(
+               &_CacheReplicate_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    9;
+
+  friend void swap(CacheReplicate& a, CacheReplicate& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CacheReplicate* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CacheReplicate* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CacheReplicate* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CacheReplicate>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CacheReplicate& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CacheReplicate& from) {
+    CacheReplicate::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CacheReplicate* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CacheMessageProto.CacheReplicate";
+  }
+  protected:
+  explicit CacheReplicate(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kItemsFieldNumber = 1,
+    kSessionFieldNumber = 2,
+  };
+  // repeated .CacheMessageProto.CacheReplicateItem items = 1;
+  int items_size() const;
+  private:
+  int _internal_items_size() const;
+  public:
+  void clear_items();
+  ::CacheMessageProto::CacheReplicateItem* mutable_items(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CacheMessageProto::CacheReplicateItem >*
+      mutable_items();
+  private:
+  const ::CacheMessageProto::CacheReplicateItem& _internal_items(int index) const;
+  ::CacheMessageProto::CacheReplicateItem* _internal_add_items();
+  public:
+  const ::CacheMessageProto::CacheReplicateItem& items(int index) const;
+  ::CacheMessageProto::CacheReplicateItem* add_items();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CacheMessageProto::CacheReplicateItem >&
+      items() const;
+
+  // uint64 session = 2;
+  void clear_session();
+  uint64_t session() const;
+  void set_session(uint64_t value);
+  private:
+  uint64_t _internal_session() const;
+  void _internal_set_session(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CacheMessageProto.CacheReplicate)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CacheMessageProto::CacheReplicateItem > items_;
+    uint64_t session_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_cache_5fmessage_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CacheMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CacheMessageProto.CacheMessage) */ {
+ public:
+  inline CacheMessage() : CacheMessage(nullptr) {}
+  ~CacheMessage() override;
+  explicit PROTOBUF_CONSTEXPR CacheMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CacheMessage(const CacheMessage& from);
+  CacheMessage(CacheMessage&& from) noexcept
+    : CacheMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline CacheMessage& operator=(const CacheMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CacheMessage& operator=(CacheMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CacheMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CacheMessage* internal_default_instance() {
+    return reinterpret_cast<const CacheMessage*>(
+               &_CacheMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    10;
+
+  friend void swap(CacheMessage& a, CacheMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CacheMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CacheMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CacheMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CacheMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CacheMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CacheMessage& from) {
+    CacheMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CacheMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CacheMessageProto.CacheMessage";
+  }
+  protected:
+  explicit CacheMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kOpResponsesFieldNumber = 7,
+    kHeaderFieldNumber = 1,
+    kReadRequestFieldNumber = 2,
+    kUpdateRequestFieldNumber = 3,
+    kOpResponseFieldNumber = 4,
+    kReadManyRequestFieldNumber = 5,
+    kUpdateManyRequestFieldNumber = 6,
+    kInvalidateFieldNumber = 8,
+    kReplicateFieldNumber = 9,
+  };
+  // repeated .CacheMessageProto.CacheOpResponse op_responses = 7;
+  int op_responses_size() const;
+  private:
+  int _internal_op_responses_size() const;
+  public:
+  void clear_op_responses();
+  ::CacheMessageProto::CacheOpResponse* mutable_op_responses(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CacheMessageProto::CacheOpResponse >*
+      mutable_op_responses();
+  private:
+  const ::CacheMessageProto::CacheOpResponse& _internal_op_responses(int index) const;
+  ::CacheMessageProto::CacheOpResponse* _internal_add_op_responses();
+  public:
+  const ::CacheMessageProto::CacheOpResponse& op_responses(int index) const;
+  ::CacheMessageProto::CacheOpResponse* add_op_responses();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CacheMessageProto::CacheOpResponse >&
+      op_responses() const;
+
+  // .CacheMessageProto.CacheMessageHeader header = 1;
+  bool has_header() const;
+  private:
+  bool _internal_has_header() const;
+  public:
+  void clear_header();
+  const ::CacheMessageProto::CacheMessageHeader& header() const;
+  PROTOBUF_NODISCARD ::CacheMessageProto::CacheMessageHeader* release_header();
+  ::CacheMessageProto::CacheMessageHeader* mutable_header();
+  void set_allocated_header(::CacheMessageProto::CacheMessageHeader* header);
+  private:
+  const ::CacheMessageProto::CacheMessageHeader& _internal_header() const;
+  ::CacheMessageProto::CacheMessageHeader* _internal_mutable_header();
+  public:
+  void unsafe_arena_set_allocated_header(
+      ::CacheMessageProto::CacheMessageHeader* header);
+  ::CacheMessageProto::CacheMessageHeader* unsafe_arena_release_header();
+
+  // .CacheMessageProto.CacheReadRequest read_request = 2;
+  bool has_read_request() const;
+  private:
+  bool _internal_has_read_request() const;
+  public:
+  void clear_read_request();
+  const ::CacheMessageProto::CacheReadRequest& read_request() const;
+  PROTOBUF_NODISCARD ::CacheMessageProto::CacheReadRequest* release_read_request();
+  ::CacheMessageProto::CacheReadRequest* mutable_read_request();
+  void set_allocated_read_request(::CacheMessageProto::CacheReadRequest* read_request);
+  private:
+  const ::CacheMessageProto::CacheReadRequest& _internal_read_request() const;
+  ::CacheMessageProto::CacheReadRequest* _internal_mutable_read_request();
+  public:
+  void unsafe_arena_set_allocated_read_request(
+      ::CacheMessageProto::CacheReadRequest* read_request);
+  ::CacheMessageProto::CacheReadRequest* unsafe_arena_release_read_request();
+
+  // .CacheMessageProto.CacheUpdateRequest update_request = 3;
+  bool has_update_request() const;
+  private:
+  bool _internal_has_update_request() const;
+  public:
+  void clear_update_request();
+  const ::CacheMessageProto::CacheUpdateRequest& update_request() const;
+  PROTOBUF_NODISCARD ::CacheMessageProto::CacheUpdateRequest* release_update_request();
+  ::CacheMessageProto::CacheUpdateRequest* mutable_update_request();
+  void set_allocated_update_request(::CacheMessageProto::CacheUpdateRequest* update_request);
+  private:
+  const ::CacheMessageProto::CacheUpdateRequest& _internal_update_request() const;
+  ::CacheMessageProto::CacheUpdateRequest* _internal_mutable_update_request();
+  public:
+  void unsafe_arena_set_allocated_update_request(
+      ::CacheMessageProto::CacheUpdateRequest* update_request);
+  ::CacheMessageProto::CacheUpdateRequest* unsafe_arena_release_update_request();
+
+  // .CacheMessageProto.CacheOpResponse op_response = 4;
+  bool has_op_response() const;
+  private:
+  bool _internal_has_op_response() const;
+  public:
+  void clear_op_response();
+  const ::CacheMessageProto::CacheOpResponse& op_response() const;
+  PROTOBUF_NODISCARD ::CacheMessageProto::CacheOpResponse* release_op_response();
+  ::CacheMessageProto::CacheOpResponse* mutable_op_response();
+  void set_allocated_op_response(::CacheMessageProto::CacheOpResponse* op_response);
+  private:
+  const ::CacheMessageProto::CacheOpResponse& _internal_op_response() const;
+  ::CacheMessageProto::CacheOpResponse* _internal_mutable_op_response();
+  public:
+  void unsafe_arena_set_allocated_op_response(
+      ::CacheMessageProto::CacheOpResponse* op_response);
+  ::CacheMessageProto::CacheOpResponse* unsafe_arena_release_op_response();
+
+  // .CacheMessageProto.CacheReadManyRequest read_many_request = 5;
+  bool has_read_many_request() const;
+  private:
+  bool _internal_has_read_many_request() const;
+  public:
+  void clear_read_many_request();
+  const ::CacheMessageProto::CacheReadManyRequest& read_many_request() const;
+  PROTOBUF_NODISCARD ::CacheMessageProto::CacheReadManyRequest* release_read_many_request();
+  ::CacheMessageProto::CacheReadManyRequest* mutable_read_many_request();
+  void set_allocated_read_many_request(::CacheMessageProto::CacheReadManyRequest* read_many_request);
+  private:
+  const ::CacheMessageProto::CacheReadManyRequest& _internal_read_many_request() const;
+  ::CacheMessageProto::CacheReadManyRequest* _internal_mutable_read_many_request();
+  public:
+  void unsafe_arena_set_allocated_read_many_request(
+      ::CacheMessageProto::CacheReadManyRequest* read_many_request);
+  ::CacheMessageProto::CacheReadManyRequest* unsafe_arena_release_read_many_request();
+
+  // .CacheMessageProto.CacheUpdateManyRequest update_many_request = 6;
+  bool has_update_many_request() const;
+  private:
+  bool _internal_has_update_many_request() const;
+  public:
+  void clear_update_many_request();
+  const ::CacheMessageProto::CacheUpdateManyRequest& update_many_request() const;
+  PROTOBUF_NODISCARD ::CacheMessageProto::CacheUpdateManyRequest* release_update_many_request();
+  ::CacheMessageProto::CacheUpdateManyRequest* mutable_update_many_request();
+  void set_allocated_update_many_request(::CacheMessageProto::CacheUpdateManyRequest* update_many_request);
+  private:
+  const ::CacheMessageProto::CacheUpdateManyRequest& _internal_update_many_request() const;
+  ::CacheMessageProto::CacheUpdateManyRequest* _internal_mutable_update_many_request();
+  public:
+  void unsafe_arena_set_allocated_update_many_request(
+      ::CacheMessageProto::CacheUpdateManyRequest* update_many_request);
+  ::CacheMessageProto::CacheUpdateManyRequest* unsafe_arena_release_update_many_request();
+
+  // .CacheMessageProto.CacheInvalidate invalidate = 8;
+  bool has_invalidate() const;
+  private:
+  bool _internal_has_invalidate() const;
+  public:
+  void clear_invalidate();
+  const ::CacheMessageProto::CacheInvalidate& invalidate() const;
+  PROTOBUF_NODISCARD ::CacheMessageProto::CacheInvalidate* release_invalidate();
+  ::CacheMessageProto::CacheInvalidate* mutable_invalidate();
+  void set_allocated_invalidate(::CacheMessageProto::CacheInvalidate* invalidate);
+  private:
+  const ::CacheMessageProto::CacheInvalidate& _internal_invalidate() const;
+  ::CacheMessageProto::CacheInvalidate* _internal_mutable_invalidate();
+  public:
+  void unsafe_arena_set_allocated_invalidate(
+      ::CacheMessageProto::CacheInvalidate* invalidate);
+  ::CacheMessageProto::CacheInvalidate* unsafe_arena_release_invalidate();
+
+  // .CacheMessageProto.CacheReplicate replicate = 9;
+  bool has_replicate() const;
+  private:
+  bool _internal_has_replicate() const;
+  public:
+  void clear_replicate();
+  const ::CacheMessageProto::CacheReplicate& replicate() const;
+  PROTOBUF_NODISCARD ::CacheMessageProto::CacheReplicate* release_replicate();
+  ::CacheMessageProto::CacheReplicate* mutable_replicate();
+  void set_allocated_replicate(::CacheMessageProto::CacheReplicate* replicate);
+  private:
+  const ::CacheMessageProto::CacheReplicate& _internal_replicate() const;
+  ::CacheMessageProto::CacheReplicate* _internal_mutable_replicate();
+  public:
+  void unsafe_arena_set_allocated_replicate(
+      ::CacheMessageProto::CacheReplicate* replicate);
+  ::CacheMessageProto::CacheReplicate* unsafe_arena_release_replicate();
+
+  // @@protoc_insertion_point(class_scope:CacheMessageProto.CacheMessage)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CacheMessageProto::CacheOpResponse > op_responses_;
+    ::CacheMessageProto::CacheMessageHeader* header_;
+    ::CacheMessageProto::CacheReadRequest* read_request_;
+    ::CacheMessageProto::CacheUpdateRequest* update_request_;
+    ::CacheMessageProto::CacheOpResponse* op_response_;
+    ::CacheMessageProto::CacheReadManyRequest* read_many_request_;
+    ::CacheMessageProto::CacheUpdateManyRequest* update_many_request_;
+    ::CacheMessageProto::CacheInvalidate* invalidate_;
+    ::CacheMessageProto::CacheReplicate* replicate_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_cache_5fmessage_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// CacheMessageHeader
+
+// uint32 magic = 1;
+inline void CacheMessageHeader::clear_magic() {
+  _impl_.magic_ = 0u;
+}
+inline uint32_t CacheMessageHeader::_internal_magic() const {
+  return _impl_.magic_;
+}
+inline uint32_t CacheMessageHeader::magic() const {
+  // @@protoc_insertion_point(field_get:CacheMessageProto.CacheMessageHeader.magic)
+  return _internal_magic();
+}
+inline void CacheMessageHeader::_internal_set_magic(uint32_t value) {
+  
+  _impl_.magic_ = value;
+}
+inline void CacheMessageHeader::set_magic(uint32_t value) {
+  _internal_set_magic(value);
+  // @@protoc_insertion_point(field_set:CacheMessageProto.CacheMessageHeader.magic)
+}
+
+// uint32 version = 2;
+inline void CacheMessageHeader::clear_version() {
+  _impl_.version_ = 0u;
+}
+inline uint32_t CacheMessageHeader::_internal_version() const {
+  return _impl_.version_;
+}
+inline uint32_t CacheMessageHeader::version() const {
+  // @@protoc_insertion_point(field_get:CacheMessageProto.CacheMessageHeader.version)
+  return _internal_version();
+}
+inline void CacheMessageHeader::_internal_set_version(uint32_t value) {
+  
+  _impl_.version_ = value;
+}
+inline void CacheMessageHeader::set_version(uint32_t value) {
+  _internal_set_version(value);
+  // @@protoc_insertion_point(field_set:CacheMessageProto.CacheMessageHeader.version)
+}
+
+// .CacheMessageProto.CacheMessageType type = 3;
+inline void CacheMessageHeader::clear_type() {
+  _impl_.type_ = 0;
+}
+inline ::CacheMessageProto::CacheMessageType CacheMessageHeader::_internal_type() const {
+  return static_cast< ::CacheMessageProto::CacheMessageType >(_impl_.type_);
+}
+inline ::CacheMessageProto::CacheMessageType CacheMessageHeader::type() const {
+  // @@protoc_insertion_point(field_get:CacheMessageProto.CacheMessageHeader.type)
+  return _internal_type();
+}
+inline void CacheMessageHeader::_internal_set_type(::CacheMessageProto::CacheMessageType value) {
+  
+  _impl_.type_ = value;
+}
+inline void CacheMessageHeader::set_type(::CacheMessageProto::CacheMessageType value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:CacheMessageProto.CacheMessageHeader.type)
+}
+
+// uint64 op_id = 4;
+inline void CacheMessageHeader::clear_op_id() {
+  _impl_.op_id_ = uint64_t{0u};
+}
+inline uint64_t CacheMessageHeader::_internal_op_id() const {
+  return _impl_.op_id_;
+}
+inline uint64_t CacheMessageHeader::op_id() const {
+  // @@protoc_insertion_point(field_get:CacheMessageProto.CacheMessageHeader.op_id)
+  return _internal_op_id();
+}
+inline void CacheMessageHeader::_internal_set_op_id(uint64_t value) {
+  
+  _impl_.op_id_ = value;
+}
+inline void CacheMessageHeader::set_op_id(uint64_t value) {
+  _internal_set_op_id(value);
+  // @@protoc_insertion_point(field_set:CacheMessageProto.CacheMessageHeader.op_id)
+}
+
+// uint32 sequence = 5;
+inline void CacheMessageHeader::clear_sequence() {
+  _impl_.sequence_ = 0u;
+}
+inline uint32_t CacheMessageHeader::_internal_sequence() const {
+  return _impl_.sequence_;
+}
+inline uint32_t CacheMessageHeader::sequence() const {
+  // @@protoc_insertion_point(field_get:CacheMessageProto.CacheMessageHeader.sequence)
+  return _internal_sequence();
+}
+inline void CacheMessageHeader::_internal_set_sequence(uint32_t value) {
+  
+  _impl_.sequence_ = value;
+}
+inline void CacheMessageHeader::set_sequence(uint32_t value) {
+  _internal_set_sequence(value);
+  // @@protoc_insertion_point(field_set:CacheMessageProto.CacheMessageHeader.sequence)
+}
+
+// -------------------------------------------------------------------
+
+// CacheReadRequest
+
+// uint64 timestamp = 1;
+inline void CacheReadRequest::clear_timestamp() {
+  _impl_.timestamp_ = uint64_t{0u};
+}
+inline uint64_t CacheReadRequest::_internal_timestamp() const {
+  return _impl_.timestamp_;
+}
+inline uint64_t CacheReadRequest::timestamp() const {
+  // @@protoc_insertion_point(field_get:CacheMessageProto.CacheReadRequest.timestamp)
+  return _internal_timestamp();
+}
+inline void CacheReadRequest::_internal_set_timestamp(uint64_t value) {
+  
+  _impl_.timestamp_ = value;
+}
+inline void CacheReadRequest::set_timestamp(uint64_t value) {
+  _internal_set_timestamp(value);
+  // @@protoc_insertion_point(field_set:CacheMessageProto.CacheReadRequest.timestamp)
+}
+
+// uint32 expire = 2;
+inline void CacheReadRequest::clear_expire() {
+  _impl_.expire_ = 0u;
+}
+inline uint32_t CacheReadRequest::_internal_expire() const {
+  return _impl_.expire_;
+}
+inline uint32_t CacheReadRequest::expire() const {
+  // @@protoc_insertion_point(field_get:CacheMessageProto.CacheReadRequest.expire)
+  return _internal_expire();
+}
+inline void CacheReadRequest::_internal_set_expire(uint32_t value) {
+  
+  _impl_.expire_ = value;
+}
+inline void CacheReadRequest::set_expire(uint32_t value) {
+  _internal_set_expire(value);
+  // @@protoc_insertion_point(field_set:CacheMessageProto.CacheReadRequest.expire)
+}
+
+// uint32 cache_id = 3;
+inline void CacheReadRequest::clear_cache_id() {
+  _impl_.cache_id_ = 0u;
+}
+inline uint32_t CacheReadRequest::_internal_cache_id() const {
+  return _impl_.cache_id_;
+}
+inline uint32_t CacheReadRequest::cache_id() const {
+  // @@protoc_insertion_point(field_get:CacheMessageProto.CacheReadRequest.cache_id)
+  return _internal_cache_id();
+}
+inline void CacheReadRequest::_internal_set_cache_id(uint32_t value) {
+  
+  _impl_.cache_id_ = value;
+}
+inline void CacheReadRequest::set_cache_id(uint32_t value) {
+  _internal_set_cache_id(value);
+  // @@protoc_insertion_point(field_set:CacheMessageProto.CacheReadRequest.cache_id)
+}
+
+// uint64 version = 4;
+inline void CacheReadRequest::clear_version() {
+  _impl_.version_ = uint64_t{0u};
+}
+inline uint64_t CacheReadRequest::_internal_version() const {
+  return _impl_.version_;
+}
+inline uint64_t CacheReadRequest::version() const {
+  // @@protoc_insertion_point(field_get:CacheMessageProto.CacheReadRequest.version)
+  return _internal_version();
+}
+inline void CacheReadRequest::_internal_set_version(uint64_t value) {
+  
+  _impl_.version_ = value;
+}
+inline void CacheReadRequest::set_version(uint64_t value) {
+  _internal_set_version(value);
+  // @@protoc_insertion_point(field_set:CacheMessageProto.CacheReadRequest.version)
+}
+
+// -------------------------------------------------------------------
+
+// CacheUpdateRequest
+
+// uint64 timestamp = 1;
+inline void CacheUpdateRequest::clear_timestamp() {
+  _impl_.timestamp_ = uint64_t{0u};
+}
+inline uint64_t CacheUpdateRequest::_internal_timestamp() const {
+  return _impl_.timestamp_;
+}
+inline uint64_t CacheUpdateRequest::timestamp() const {
+  // @@protoc_insertion_point(field_get:CacheMessageProto.CacheUpdateRequest.timestamp)
+  return _internal_timestamp();
+}
+inline void CacheUpdateRequest::_internal_set_timestamp(uint64_t value) {
+  
+  _impl_.timestamp_ = value;
+}
+inline void CacheUpdateRequest::set_timestamp(uint64_t value) {
+  _internal_set_timestamp(value);
+  // @@protoc_insertion_point(field_set:CacheMessageProto.CacheUpdateRequest.timestamp)
+}
+
+// uint32 expire = 2;
+inline void CacheUpdateRequest::clear_expire() {
+  _impl_.expire_ = 0u;
+}
+inline uint32_t CacheUpdateRequest::_internal_expire() const {
+  return _impl_.expire_;
+}
+inline uint32_t CacheUpdateRequest::expire() const {
+  // @@protoc_insertion_point(field_get:CacheMessageProto.CacheUpdateRequest.expire)
+  return _internal_expire();
+}
+inline void CacheUpdateRequest::_internal_set_expire(uint32_t value) {
+  
+  _impl_.expire_ = value;
+}
+inline void CacheUpdateRequest::set_expire(uint32_t value) {
+  _internal_set_expire(value);
+  // @@protoc_insertion_point(field_set:CacheMessageProto.CacheUpdateRequest.expire)
+}
+
+// uint32 cache_id = 3;
+inline void CacheUpdateRequest::clear_cache_id() {
+  _impl_.cache_id_ = 0u;
+}
+inline uint32_t CacheUpdateRequest::_internal_cache_id() const {
+  return _impl_.cache_id_;
+}
+inline uint32_t CacheUpdateRequest::cache_id() const {
+  // @@protoc_insertion_point(field_get:CacheMessageProto.CacheUpdateRequest.cache_id)
+  return _internal_cache_id();
+}
+inline void CacheUpdateRequest::_internal_set_cache_id(uint32_t value) {
+  
+  _impl_.cache_id_ = value;
+}
+inline void CacheUpdateRequest::set_cache_id(uint32_t value) {
+  _internal_set_cache_id(value);
+  // @@protoc_insertion_point(field_set:CacheMessageProto.CacheUpdateRequest.cache_id)
+}
+
+// bytes cache_data = 4;
+inline void CacheUpdateRequest::clear_cache_data() {
+  _impl_.cache_data_.ClearToEmpty();
+}
+inline const std::string& CacheUpdateRequest::cache_data() const {
+  // @@protoc_insertion_point(field_get:CacheMessageProto.CacheUpdateRequest.cache_data)
+  return _internal_cache_data();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CacheUpdateRequest::set_cache_data(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.cache_data_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:CacheMessageProto.CacheUpdateRequest.cache_data)
+}
+inline std::string* CacheUpdateRequest::mutable_cache_data() {
+  std::string* _s = _internal_mutable_cache_data();
+  // @@protoc_insertion_point(field_mutable:CacheMessageProto.CacheUpdateRequest.cache_data)
+  return _s;
+}
+inline const std::string& CacheUpdateRequest::_internal_cache_data() const {
+  return _impl_.cache_data_.Get();
+}
+inline void CacheUpdateRequest::_internal_set_cache_data(const std::string& value) {
+  
+  _impl_.cache_data_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CacheUpdateRequest::_internal_mutable_cache_data() {
+  
+  return _impl_.cache_data_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CacheUpdateRequest::release_cache_data() {
+  // @@protoc_insertion_point(field_release:CacheMessageProto.CacheUpdateRequest.cache_data)
+  return _impl_.cache_data_.Release();
+}
+inline void CacheUpdateRequest::set_allocated_cache_data(std::string* cache_data) {
+  if (cache_data != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.cache_data_.SetAllocated(cache_data, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.cache_data_.IsDefault()) {
+    _impl_.cache_data_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:CacheMessageProto.CacheUpdateRequest.cache_data)
+}
+
+// -------------------------------------------------------------------
+
+// CacheReadManyRequest
+
+// uint64 timestamp = 1;
+inline void CacheReadManyRequest::clear_timestamp() {
+  _impl_.timestamp_ = uint64_t{0u};
+}
+inline uint64_t CacheReadManyRequest::_internal_timestamp() const {
+  return _impl_.timestamp_;
+}
+inline uint64_t CacheReadManyRequest::timestamp() const {
+  // @@protoc_insertion_point(field_get:CacheMessageProto.CacheReadManyRequest.timestamp)
+  return _internal_timestamp();
+}
+inline void CacheReadManyRequest::_internal_set_timestamp(uint64_t value) {
+  
+  _impl_.timestamp_ = value;
+}
+inline void CacheReadManyRequest::set_timestamp(uint64_t value) {
+  _internal_set_timestamp(value);
+  // @@protoc_insertion_point(field_set:CacheMessageProto.CacheReadManyRequest.timestamp)
+}
+
+// uint32 expire = 2;
+inline void CacheReadManyRequest::clear_expire() {
+  _impl_.expire_ = 0u;
+}
+inline uint32_t CacheReadManyRequest::_internal_expire() const {
+  return _impl_.expire_;
+}
+inline uint32_t CacheReadManyRequest::expire() const {
+  // @@protoc_insertion_point(field_get:CacheMessageProto.CacheReadManyRequest.expire)
+  return _internal_expire();
+}
+inline void CacheReadManyRequest::_internal_set_expire(uint32_t value) {
+  
+  _impl_.expire_ = value;
+}
+inline void CacheReadManyRequest::set_expire(uint32_t value) {
+  _internal_set_expire(value);
+  // @@protoc_insertion_point(field_set:CacheMessageProto.CacheReadManyRequest.expire)
+}
+
+// repeated uint32 cache_ids = 3;
+inline int CacheReadManyRequest::_internal_cache_ids_size() const {
+  return _impl_.cache_ids_.size();
+}
+inline int CacheReadManyRequest::cache_ids_size() const {
+  return _internal_cache_ids_size();
+}
+inline void CacheReadManyRequest::clear_cache_ids() {
+  _impl_.cache_ids_.Clear();
+}
+inline uint32_t CacheReadManyRequest::_internal_cache_ids(int index) const {
+  return _impl_.cache_ids_.Get(index);
+}
+inline uint32_t CacheReadManyRequest::cache_ids(int index) const {
+  // @@protoc_insertion_point(field_get:CacheMessageProto.CacheReadManyRequest.cache_ids)
+  return _internal_cache_ids(index);
+}
+inline void CacheReadManyRequest::set_cache_ids(int index, uint32_t value) {
+  _impl_.cache_ids_.Set(index, value);
+  // @@protoc_insertion_point(field_set:CacheMessageProto.CacheReadManyRequest.cache_ids)
+}
+inline void CacheReadManyRequest::_internal_add_cache_ids(uint32_t value) {
+  _impl_.cache_ids_.Add(value);
+}
+inline void CacheReadManyRequest::add_cache_ids(uint32_t value) {
+  _internal_add_cache_ids(value);
+  // @@protoc_insertion_point(field_add:CacheMessageProto.CacheReadManyRequest.cache_ids)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+CacheReadManyRequest::_internal_cache_ids() const {
+  return _impl_.cache_ids_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+CacheReadManyRequest::cache_ids() const {
+  // @@protoc_insertion_point(field_list:CacheMessageProto.CacheReadManyRequest.cache_ids)
+  return _internal_cache_ids();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+CacheReadManyRequest::_internal_mutable_cache_ids() {
+  return &_impl_.cache_ids_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+CacheReadManyRequest::mutable_cache_ids() {
+  // @@protoc_insertion_point(field_mutable_list:CacheMessageProto.CacheReadManyRequest.cache_ids)
+  return _internal_mutable_cache_ids();
+}
+
+// -------------------------------------------------------------------
+
+// CacheUpdateItem
+
+// uint32 cache_id = 1;
+inline void CacheUpdateItem::clear_cache_id() {
+  _impl_.cache_id_ = 0u;
+}
+inline uint32_t CacheUpdateItem::_internal_cache_id() const {
+  return _impl_.cache_id_;
+}
+inline uint32_t CacheUpdateItem::cache_id() const {
+  // @@protoc_insertion_point(field_get:CacheMessageProto.CacheUpdateItem.cache_id)
+  return _internal_cache_id();
+}
+inline void CacheUpdateItem::_internal_set_cache_id(uint32_t value) {
+  
+  _impl_.cache_id_ = value;
+}
+inline void CacheUpdateItem::set_cache_id(uint32_t value) {
+  _internal_set_cache_id(value);
+  // @@protoc_insertion_point(field_set:CacheMessageProto.CacheUpdateItem.cache_id)
+}
+
+// bytes cache_data = 2;
+inline void CacheUpdateItem::clear_cache_data() {
+  _impl_.cache_data_.ClearToEmpty();
+}
+inline const std::string& CacheUpdateItem::cache_data() const {
+  // @@protoc_insertion_point(field_get:CacheMessageProto.CacheUpdateItem.cache_data)
+  return _internal_cache_data();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CacheUpdateItem::set_cache_data(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.cache_data_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:CacheMessageProto.CacheUpdateItem.cache_data)
+}
+inline std::string* CacheUpdateItem::mutable_cache_data() {
+  std::string* _s = _internal_mutable_cache_data();
+  // @@protoc_insertion_point(field_mutable:CacheMessageProto.CacheUpdateItem.cache_data)
+  return _s;
+}
+inline const std::string& CacheUpdateItem::_internal_cache_data() const {
+  return _impl_.cache_data_.Get();
+}
+inline void CacheUpdateItem::_internal_set_cache_data(const std::string& value) {
+  
+  _impl_.cache_data_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CacheUpdateItem::_internal_mutable_cache_data() {
+  
+  return _impl_.cache_data_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CacheUpdateItem::release_cache_data() {
+  // @@protoc_insertion_point(field_release:CacheMessageProto.CacheUpdateItem.cache_data)
+  return _impl_.cache_data_.Release();
+}
+inline void CacheUpdateItem::set_allocated_cache_data(std::string* cache_data) {
+  if (cache_data != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.cache_data_.SetAllocated(cache_data, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.cache_data_.IsDefault()) {
+    _impl_.cache_data_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:CacheMessageProto.CacheUpdateItem.cache_data)
+}
+
+// -------------------------------------------------------------------
+
+// CacheUpdateManyRequest
+
+// uint64 timestamp = 1;
+inline void CacheUpdateManyRequest::clear_timestamp() {
+  _impl_.timestamp_ = uint64_t{0u};
+}
+inline uint64_t CacheUpdateManyRequest::_internal_timestamp() const {
+  return _impl_.timestamp_;
+}
+inline uint64_t CacheUpdateManyRequest::timestamp() const {
+  // @@protoc_insertion_point(field_get:CacheMessageProto.CacheUpdateManyRequest.timestamp)
+  return _internal_timestamp();
+}
+inline void CacheUpdateManyRequest::_internal_set_timestamp(uint64_t value) {
+  
+  _impl_.timestamp_ = value;
+}
+inline void CacheUpdateManyRequest::set_timestamp(uint64_t value) {
+  _internal_set_timestamp(value);
+  // @@protoc_insertion_point(field_set:CacheMessageProto.CacheUpdateManyRequest.timestamp)
+}
+
+// uint32 expire = 2;
+inline void CacheUpdateManyRequest::clear_expire() {
+  _impl_.expire_ = 0u;
+}
+inline uint32_t CacheUpdateManyRequest::_internal_expire() const {
+  return _impl_.expire_;
+}
+inline uint32_t CacheUpdateManyRequest::expire() const {
+  // @@protoc_insertion_point(field_get:CacheMessageProto.CacheUpdateManyRequest.expire)
+  return _internal_expire();
+}
+inline void CacheUpdateManyRequest::_internal_set_expire(uint32_t value) {
+  
+  _impl_.expire_ = value;
+}
+inline void CacheUpdateManyRequest::set_expire(uint32_t value) {
+  _internal_set_expire(value);
+  // @@protoc_insertion_point(field_set:CacheMessageProto.CacheUpdateManyRequest.expire)
+}
+
+// repeated .CacheMessageProto.CacheUpdateItem items = 3;
+inline int CacheUpdateManyRequest::_internal_items_size() const {
+  return _impl_.items_.size();
+}
+inline int CacheUpdateManyRequest::items_size() const {
+  return _internal_items_size();
+}
+inline void CacheUpdateManyRequest::clear_items() {
+  _impl_.items_.Clear();
+}
+inline ::CacheMessageProto::CacheUpdateItem* CacheUpdateManyRequest::mutable_items(int index) {
+  // @@protoc_insertion_point(field_mutable:CacheMessageProto.CacheUpdateManyRequest.items)
+  return _impl_.items_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CacheMessageProto::CacheUpdateItem >*
+CacheUpdateManyRequest::mutable_items() {
+  // @@protoc_insertion_point(field_mutable_list:CacheMessageProto.CacheUpdateManyRequest.items)
+  return &_impl_.items_;
+}
+inline const ::CacheMessageProto::CacheUpdateItem& CacheUpdateManyRequest::_internal_items(int index) const {
+  return _impl_.items_.Get(index);
+}
+inline const ::CacheMessageProto::CacheUpdateItem& CacheUpdateManyRequest::items(int index) const {
+  // @@protoc_insertion_point(field_get:CacheMessageProto.CacheUpdateManyRequest.items)
+  return _internal_items(index);
+}
+inline ::CacheMessageProto::CacheUpdateItem* CacheUpdateManyRequest::_internal_add_items() {
+  return _impl_.items_.Add();
+}
+inline ::CacheMessageProto::CacheUpdateItem* CacheUpdateManyRequest::add_items() {
+  ::CacheMessageProto::CacheUpdateItem* _add = _internal_add_items();
+  // @@protoc_insertion_point(field_add:CacheMessageProto.CacheUpdateManyRequest.items)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CacheMessageProto::CacheUpdateItem >&
+CacheUpdateManyRequest::items() const {
+  // @@protoc_insertion_point(field_list:CacheMessageProto.CacheUpdateManyRequest.items)
+  return _impl_.items_;
+}
+
+// -------------------------------------------------------------------
+
+// CacheOpResponse
+
+// uint32 result = 1;
+inline void CacheOpResponse::clear_result() {
+  _impl_.result_ = 0u;
+}
+inline uint32_t CacheOpResponse::_internal_result() const {
+  return _impl_.result_;
+}
+inline uint32_t CacheOpResponse::result() const {
+  // @@protoc_insertion_point(field_get:CacheMessageProto.CacheOpResponse.result)
+  return _internal_result();
+}
+inline void CacheOpResponse::_internal_set_result(uint32_t value) {
+  
+  _impl_.result_ = value;
+}
+inline void CacheOpResponse::set_result(uint32_t value) {
+  _internal_set_result(value);
+  // @@protoc_insertion_point(field_set:CacheMessageProto.CacheOpResponse.result)
+}
+
+// uint64 timestamp = 2;
+inline void CacheOpResponse::clear_timestamp() {
+  _impl_.timestamp_ = uint64_t{0u};
+}
+inline uint64_t CacheOpResponse::_internal_timestamp() const {
+  return _impl_.timestamp_;
+}
+inline uint64_t CacheOpResponse::timestamp() const {
+  // @@protoc_insertion_point(field_get:CacheMessageProto.CacheOpResponse.timestamp)
+  return _internal_timestamp();
+}
+inline void CacheOpResponse::_internal_set_timestamp(uint64_t value) {
+  
+  _impl_.timestamp_ = value;
+}
+inline void CacheOpResponse::set_timestamp(uint64_t value) {
+  _internal_set_timestamp(value);
+  // @@protoc_insertion_point(field_set:CacheMessageProto.CacheOpResponse.timestamp)
+}
+
+// uint32 expire = 3;
+inline void CacheOpResponse::clear_expire() {
+  _impl_.expire_ = 0u;
+}
+inline uint32_t CacheOpResponse::_internal_expire() const {
+  return _impl_.expire_;
+}
+inline uint32_t CacheOpResponse::expire() const {
+  // @@protoc_insertion_point(field_get:CacheMessageProto.CacheOpResponse.expire)
+  return _internal_expire();
+}
+inline void CacheOpResponse::_internal_set_expire(uint32_t value) {
+  
+  _impl_.expire_ = value;
+}
+inline void CacheOpResponse::set_expire(uint32_t value) {
+  _internal_set_expire(value);
+  // @@protoc_insertion_point(field_set:CacheMessageProto.CacheOpResponse.expire)
+}
+
+// uint32 cache_id = 4;
+inline void CacheOpResponse::clear_cache_id() {
+  _impl_.cache_id_ = 0u;
+}
+inline uint32_t CacheOpResponse::_internal_cache_id() const {
+  return _impl_.cache_id_;
+}
+inline uint32_t CacheOpResponse::cache_id() const {
+  // @@protoc_insertion_point(field_get:CacheMessageProto.CacheOpResponse.cache_id)
+  return _internal_cache_id();
+}
+inline void CacheOpResponse::_internal_set_cache_id(uint32_t value) {
+  
+  _impl_.cache_id_ = value;
+}
+inline void CacheOpResponse::set_cache_id(uint32_t value) {
+  _internal_set_cache_id(value);
+  // @@protoc_insertion_point(field_set:CacheMessageProto.CacheOpResponse.cache_id)
+}
+
+// bytes cache_data = 5;
+inline void CacheOpResponse::clear_cache_data() {
+  _impl_.cache_data_.ClearToEmpty();
+}
+inline const std::string& CacheOpResponse::cache_data() const {
+  // @@protoc_insertion_point(field_get:CacheMessageProto.CacheOpResponse.cache_data)
+  return _internal_cache_data();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CacheOpResponse::set_cache_data(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.cache_data_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:CacheMessageProto.CacheOpResponse.cache_data)
+}
+inline std::string* CacheOpResponse::mutable_cache_data() {
+  std::string* _s = _internal_mutable_cache_data();
+  // @@protoc_insertion_point(field_mutable:CacheMessageProto.CacheOpResponse.cache_data)
+  return _s;
+}
+inline const std::string& CacheOpResponse::_internal_cache_data() const {
+  return _impl_.cache_data_.Get();
+}
+inline void CacheOpResponse::_internal_set_cache_data(const std::string& value) {
+  
+  _impl_.cache_data_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CacheOpResponse::_internal_mutable_cache_data() {
+  
+  return _impl_.cache_data_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CacheOpResponse::release_cache_data() {
+  // @@protoc_insertion_point(field_release:CacheMessageProto.CacheOpResponse.cache_data)
+  return _impl_.cache_data_.Release();
+}
+inline void CacheOpResponse::set_allocated_cache_data(std::string* cache_data) {
+  if (cache_data != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.cache_data_.SetAllocated(cache_data, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.cache_data_.IsDefault()) {
+    _impl_.cache_data_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:CacheMessageProto.CacheOpResponse.cache_data)
+}
+
+// uint64 version = 6;
+inline void CacheOpResponse::clear_version() {
+  _impl_.version_ = uint64_t{0u};
+}
+inline uint64_t CacheOpResponse::_internal_version() const {
+  return _impl_.version_;
+}
+inline uint64_t CacheOpResponse::version() const {
+  // @@protoc_insertion_point(field_get:CacheMessageProto.CacheOpResponse.version)
+  return _internal_version();
+}
+inline void CacheOpResponse::_internal_set_version(uint64_t value) {
+  
+  _impl_.version_ = value;
+}
+inline void CacheOpResponse::set_version(uint64_t value) {
+  _internal_set_version(value);
+  // @@protoc_insertion_point(field_set:CacheMessageProto.CacheOpResponse.version)
+}
+
+// bool not_modified = 7;
+inline void CacheOpResponse::clear_not_modified() {
+  _impl_.not_modified_ = false;
+}
+inline bool CacheOpResponse::_internal_not_modified() const {
+  return _impl_.not_modified_;
+}
+inline bool CacheOpResponse::not_modified() const {
+  // @@protoc_insertion_point(field_get:CacheMessageProto.CacheOpResponse.not_modified)
+  return _internal_not_modified();
+}
+inline void CacheOpResponse::_internal_set_not_modified(bool value) {
+  
+  _impl_.not_modified_ = value;
+}
+inline void CacheOpResponse::set_not_modified(bool value) {
+  _internal_set_not_modified(value);
+  // @@protoc_insertion_point(field_set:CacheMessageProto.CacheOpResponse.not_modified)
+}
+
+// -------------------------------------------------------------------
+
+// CacheInvalidate
+
+// uint32 cache_id = 1;
+inline void CacheInvalidate::clear_cache_id() {
+  _impl_.cache_id_ = 0u;
+}
+inline uint32_t CacheInvalidate::_internal_cache_id() const {
+  return _impl_.cache_id_;
+}
+inline uint32_t CacheInvalidate::cache_id() const {
+  // @@protoc_insertion_point(field_get:CacheMessageProto.CacheInvalidate.cache_id)
+  return _internal_cache_id();
+}
+inline void CacheInvalidate::_internal_set_cache_id(uint32_t value) {
+  
+  _impl_.cache_id_ = value;
+}
+inline void CacheInvalidate::set_cache_id(uint32_t value) {
+  _internal_set_cache_id(value);
+  // @@protoc_insertion_point(field_set:CacheMessageProto.CacheInvalidate.cache_id)
+}
+
+// uint64 version = 2;
+inline void CacheInvalidate::clear_version() {
+  _impl_.version_ = uint64_t{0u};
+}
+inline uint64_t CacheInvalidate::_internal_version() const {
+  return _impl_.version_;
+}
+inline uint64_t CacheInvalidate::version() const {
+  // @@protoc_insertion_point(field_get:CacheMessageProto.CacheInvalidate.version)
+  return _internal_version();
+}
+inline void CacheInvalidate::_internal_set_version(uint64_t value) {
+  
+  _impl_.version_ = value;
+}
+inline void CacheInvalidate::set_version(uint64_t value) {
+  _internal_set_version(value);
+  // @@protoc_insertion_point(field_set:CacheMessageProto.CacheInvalidate.version)
+}
+
+// -------------------------------------------------------------------
+
+// CacheReplicateItem
+
+// uint64 cache_id = 1;
+inline void CacheReplicateItem::clear_cache_id() {
+  _impl_.cache_id_ = uint64_t{0u};
+}
+inline uint64_t CacheReplicateItem::_internal_cache_id() const {
+  return _impl_.cache_id_;
+}
+inline uint64_t CacheReplicateItem::cache_id() const {
+  // @@protoc_insertion_point(field_get:CacheMessageProto.CacheReplicateItem.cache_id)
+  return _internal_cache_id();
+}
+inline void CacheReplicateItem::_internal_set_cache_id(uint64_t value) {
+  
+  _impl_.cache_id_ = value;
+}
+inline void CacheReplicateItem::set_cache_id(uint64_t value) {
+  _internal_set_cache_id(value);
+  // @@protoc_insertion_point(field_set:CacheMessageProto.CacheReplicateItem.cache_id)
+}
+
+// uint64 version = 2;
+inline void CacheReplicateItem::clear_version() {
+  _impl_.version_ = uint64_t{0u};
+}
+inline uint64_t CacheReplicateItem::_internal_version() const {
+  return _impl_.version_;
+}
+inline uint64_t CacheReplicateItem::version() const {
+  // @@protoc_insertion_point(field_get:CacheMessageProto.CacheReplicateItem.version)
+  return _internal_version();
+}
+inline void CacheReplicateItem::_internal_set_version(uint64_t value) {
+  
+  _impl_.version_ = value;
+}
+inline void CacheReplicateItem::set_version(uint64_t value) {
+  _internal_set_version(value);
+  // @@protoc_insertion_point(field_set:CacheMessageProto.CacheReplicateItem.version)
+}
+
+// bytes cache_data = 3;
+inline void CacheReplicateItem::clear_cache_data() {
+  _impl_.cache_data_.ClearToEmpty();
+}
+inline const std::string& CacheReplicateItem::cache_data() const {
+  // @@protoc_insertion_point(field_get:CacheMessageProto.CacheReplicateItem.cache_data)
+  return _internal_cache_data();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CacheReplicateItem::set_cache_data(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.cache_data_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:CacheMessageProto.CacheReplicateItem.cache_data)
+}
+inline std::string* CacheReplicateItem::mutable_cache_data() {
+  std::string* _s = _internal_mutable_cache_data();
+  // @@protoc_insertion_point(field_mutable:CacheMessageProto.CacheReplicateItem.cache_data)
+  return _s;
+}
+inline const std::string& CacheReplicateItem::_internal_cache_data() const {
+  return _impl_.cache_data_.Get();
+}
+inline void CacheReplicateItem::_internal_set_cache_data(const std::string& value) {
+  
+  _impl_.cache_data_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CacheReplicateItem::_internal_mutable_cache_data() {
+  
+  return _impl_.cache_data_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CacheReplicateItem::release_cache_data() {
+  // @@protoc_insertion_point(field_release:CacheMessageProto.CacheReplicateItem.cache_data)
+  return _impl_.cache_data_.Release();
+}
+inline void CacheReplicateItem::set_allocated_cache_data(std::string* cache_data) {
+  if (cache_data != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.cache_data_.SetAllocated(cache_data, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.cache_data_.IsDefault()) {
+    _impl_.cache_data_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:CacheMessageProto.CacheReplicateItem.cache_data)
+}
+
+// -------------------------------------------------------------------
+
+// CacheReplicate
+
+// repeated .CacheMessageProto.CacheReplicateItem items = 1;
+inline int CacheReplicate::_internal_items_size() const {
+  return _impl_.items_.size();
+}
+inline int CacheReplicate::items_size() const {
+  return _internal_items_size();
+}
+inline void CacheReplicate::clear_items() {
+  _impl_.items_.Clear();
+}
+inline ::CacheMessageProto::CacheReplicateItem* CacheReplicate::mutable_items(int index) {
+  // @@protoc_insertion_point(field_mutable:CacheMessageProto.CacheReplicate.items)
+  return _impl_.items_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CacheMessageProto::CacheReplicateItem >*
+CacheReplicate::mutable_items() {
+  // @@protoc_insertion_point(field_mutable_list:CacheMessageProto.CacheReplicate.items)
+  return &_impl_.items_;
+}
+inline const ::CacheMessageProto::CacheReplicateItem& CacheReplicate::_internal_items(int index) const {
+  return _impl_.items_.Get(index);
+}
+inline const ::CacheMessageProto::CacheReplicateItem& CacheReplicate::items(int index) const {
+  // @@protoc_insertion_point(field_get:CacheMessageProto.CacheReplicate.items)
+  return _internal_items(index);
+}
+inline ::CacheMessageProto::CacheReplicateItem* CacheReplicate::_internal_add_items() {
+  return _impl_.items_.Add();
+}
+inline ::CacheMessageProto::CacheReplicateItem* CacheReplicate::add_items() {
+  ::CacheMessageProto::CacheReplicateItem* _add = _internal_add_items();
+  // @@protoc_insertion_point(field_add:CacheMessageProto.CacheReplicate.items)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CacheMessageProto::CacheReplicateItem >&
+CacheReplicate::items() const {
+  // @@protoc_insertion_point(field_list:CacheMessageProto.CacheReplicate.items)
+  return _impl_.items_;
+}
+
+// uint64 session = 2;
+inline void CacheReplicate::clear_session() {
+  _impl_.session_ = uint64_t{0u};
+}
+inline uint64_t CacheReplicate::_internal_session() const {
+  return _impl_.session_;
+}
+inline uint64_t CacheReplicate::session() const {
+  // @@protoc_insertion_point(field_get:CacheMessageProto.CacheReplicate.session)
+  return _internal_session();
+}
+inline void CacheReplicate::_internal_set_session(uint64_t value) {
+  
+  _impl_.session_ = value;
+}
+inline void CacheReplicate::set_session(uint64_t value) {
+  _internal_set_session(value);
+  // @@protoc_insertion_point(field_set:CacheMessageProto.CacheReplicate.session)
+}
+
+// -------------------------------------------------------------------
+
+// CacheMessage
+
+// .CacheMessageProto.CacheMessageHeader header = 1;
+inline bool CacheMessage::_internal_has_header() const {
+  return this != internal_default_instance() && _impl_.header_ != nullptr;
+}
+inline bool CacheMessage::has_header() const {
+  return _internal_has_header();
+}
+inline void CacheMessage::clear_header() {
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
+}
+inline const ::CacheMessageProto::CacheMessageHeader& CacheMessage::_internal_header() const {
+  const ::CacheMessageProto::CacheMessageHeader* p = _impl_.header_;
+  return p != nullptr ? *p : reinterpret_cast<const ::CacheMessageProto::CacheMessageHeader&>(
+      ::CacheMessageProto::_CacheMessageHeader_default_instance_);
+}
+inline const ::CacheMessageProto::CacheMessageHeader& CacheMessage::header() const {
+  // @@protoc_insertion_point(field_get:CacheMessageProto.CacheMessage.header)
+  return _internal_header();
+}
+inline void CacheMessage::unsafe_arena_set_allocated_header(
+    ::CacheMessageProto::CacheMessageHeader* header) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.header_);
+  }
+  _impl_.header_ = header;
+  if (header) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CacheMessageProto.CacheMessage.header)
+}
+inline ::CacheMessageProto::CacheMessageHeader* CacheMessage::release_header() {
+  
+  ::CacheMessageProto::CacheMessageHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::CacheMessageProto::CacheMessageHeader* CacheMessage::unsafe_arena_release_header() {
+  // @@protoc_insertion_point(field_release:CacheMessageProto.CacheMessage.header)
+  
+  ::CacheMessageProto::CacheMessageHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+  return temp;
+}
+inline ::CacheMessageProto::CacheMessageHeader* CacheMessage::_internal_mutable_header() {
+  
+  if (_impl_.header_ == nullptr) {
+    auto* p = CreateMaybeMessage<::CacheMessageProto::CacheMessageHeader>(GetArenaForAllocation());
+    _impl_.header_ = p;
+  }
+  return _impl_.header_;
+}
+inline ::CacheMessageProto::CacheMessageHeader* CacheMessage::mutable_header() {
+  ::CacheMessageProto::CacheMessageHeader* _msg = _internal_mutable_header();
+  // @@protoc_insertion_point(field_mutable:CacheMessageProto.CacheMessage.header)
+  return _msg;
+}
+inline void CacheMessage::set_allocated_header(::CacheMessageProto::CacheMessageHeader* header) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.header_;
+  }
+  if (header) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(header);
+    if (message_arena != submessage_arena) {
+      header = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, header, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.header_ = header;
+  // @@protoc_insertion_point(field_set_allocated:CacheMessageProto.CacheMessage.header)
+}
+
+// .CacheMessageProto.CacheReadRequest read_request = 2;
+inline bool CacheMessage::_internal_has_read_request() const {
+  return this != internal_default_instance() && _impl_.read_request_ != nullptr;
+}
+inline bool CacheMessage::has_read_request() const {
+  return _internal_has_read_request();
+}
+inline void CacheMessage::clear_read_request() {
+  if (GetArenaForAllocation() == nullptr && _impl_.read_request_ != nullptr) {
+    delete _impl_.read_request_;
+  }
+  _impl_.read_request_ = nullptr;
+}
+inline const ::CacheMessageProto::CacheReadRequest& CacheMessage::_internal_read_request() const {
+  const ::CacheMessageProto::CacheReadRequest* p = _impl_.read_request_;
+  return p != nullptr ? *p : reinterpret_cast<const ::CacheMessageProto::CacheReadRequest&>(
+      ::CacheMessageProto::_CacheReadRequest_default_instance_);
+}
+inline const ::CacheMessageProto::CacheReadRequest& CacheMessage::read_request() const {
+  // @@protoc_insertion_point(field_get:CacheMessageProto.CacheMessage.read_request)
+  return _internal_read_request();
+}
+inline void CacheMessage::unsafe_arena_set_allocated_read_request(
+    ::CacheMessageProto::CacheReadRequest* read_request) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.read_request_);
+  }
+  _impl_.read_request_ = read_request;
+  if (read_request) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CacheMessageProto.CacheMessage.read_request)
+}
+inline ::CacheMessageProto::CacheReadRequest* CacheMessage::release_read_request() {
+  
+  ::CacheMessageProto::CacheReadRequest* temp = _impl_.read_request_;
+  _impl_.read_request_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::CacheMessageProto::CacheReadRequest* CacheMessage::unsafe_arena_release_read_request() {
+  // @@protoc_insertion_point(field_release:CacheMessageProto.CacheMessage.read_request)
+  
+  ::CacheMessageProto::CacheReadRequest* temp = _impl_.read_request_;
+  _impl_.read_request_ = nullptr;
+  return temp;
+}
+inline ::CacheMessageProto::CacheReadRequest* CacheMessage::_internal_mutable_read_request() {
+  
+  if (_impl_.read_request_ == nullptr) {
+    auto* p = CreateMaybeMessage<::CacheMessageProto::CacheReadRequest>(GetArenaForAllocation());
+    _impl_.read_request_ = p;
+  }
+  return _impl_.read_request_;
+}
+inline ::CacheMessageProto::CacheReadRequest* CacheMessage::mutable_read_request() {
+  ::CacheMessageProto::CacheReadRequest* _msg = _internal_mutable_read_request();
+  // @@protoc_insertion_point(field_mutable:CacheMessageProto.CacheMessage.read_request)
+  return _msg;
+}
+inline void CacheMessage::set_allocated_read_request(::CacheMessageProto::CacheReadRequest* read_request) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.read_request_;
+  }
+  if (read_request) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(read_request);
+    if (message_arena != submessage_arena) {
+      read_request = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, read_request, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.read_request_ = read_request;
+  // @@protoc_insertion_point(field_set_allocated:CacheMessageProto.CacheMessage.read_request)
+}
+
+// .CacheMessageProto.CacheUpdateRequest update_request = 3;
+inline bool CacheMessage::_internal_has_update_request() const {
+  return this != internal_default_instance() && _impl_.update_request_ != nullptr;
+}
+inline bool CacheMessage::has_update_request() const {
+  return _internal_has_update_request();
+}
+inline void CacheMessage::clear_update_request() {
+  if (GetArenaForAllocation() == nullptr && _impl_.update_request_ != nullptr) {
+    delete _impl_.update_request_;
+  }
+  _impl_.update_request_ = nullptr;
+}
+inline const ::CacheMessageProto::CacheUpdateRequest& CacheMessage::_internal_update_request() const {
+  const ::CacheMessageProto::CacheUpdateRequest* p = _impl_.update_request_;
+  return p != nullptr ? *p : reinterpret_cast<const ::CacheMessageProto::CacheUpdateRequest&>(
+      ::CacheMessageProto::_CacheUpdateRequest_default_instance_);
+}
+inline const ::CacheMessageProto::CacheUpdateRequest& CacheMessage::update_request() const {
+  // @@protoc_insertion_point(field_get:CacheMessageProto.CacheMessage.update_request)
+  return _internal_update_request();
+}
+inline void CacheMessage::unsafe_arena_set_allocated_update_request(
+    ::CacheMessageProto::CacheUpdateRequest* update_request) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.update_request_);
+  }
+  _impl_.update_request_ = update_request;
+  if (update_request) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CacheMessageProto.CacheMessage.update_request)
+}
+inline ::CacheMessageProto::CacheUpdateRequest* CacheMessage::release_update_request() {
+  
+  ::CacheMessageProto::CacheUpdateRequest* temp = _impl_.update_request_;
+  _impl_.update_request_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::CacheMessageProto::CacheUpdateRequest* CacheMessage::unsafe_arena_release_update_request() {
+  // @@protoc_insertion_point(field_release:CacheMessageProto.CacheMessage.update_request)
+  
+  ::CacheMessageProto::CacheUpdateRequest* temp = _impl_.update_request_;
+  _impl_.update_request_ = nullptr;
+  return temp;
+}
+inline ::CacheMessageProto::CacheUpdateRequest* CacheMessage::_internal_mutable_update_request() {
+  
+  if (_impl_.update_request_ == nullptr) {
+    auto* p = CreateMaybeMessage<::CacheMessageProto::CacheUpdateRequest>(GetArenaForAllocation());
+    _impl_.update_request_ = p;
+  }
+  return _impl_.update_request_;
+}
+inline ::CacheMessageProto::CacheUpdateRequest* CacheMessage::mutable_update_request() {
+  ::CacheMessageProto::CacheUpdateRequest* _msg = _internal_mutable_update_request();
+  // @@protoc_insertion_point(field_mutable:CacheMessageProto.CacheMessage.update_request)
+  return _msg;
+}
+inline void CacheMessage::set_allocated_update_request(::CacheMessageProto::CacheUpdateRequest* update_request) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.update_request_;
+  }
+  if (update_request) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(update_request);
+    if (message_arena != submessage_arena) {
+      update_request = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, update_request, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.update_request_ = update_request;
+  // @@protoc_insertion_point(field_set_allocated:CacheMessageProto.CacheMessage.update_request)
+}
+
+// .CacheMessageProto.CacheOpResponse op_response = 4;
+inline bool CacheMessage::_internal_has_op_response() const {
+  return this != internal_default_instance() && _impl_.op_response_ != nullptr;
+}
+inline bool CacheMessage::has_op_response() const {
+  return _internal_has_op_response();
+}
+inline void CacheMessage::clear_op_response() {
+  if (GetArenaForAllocation() == nullptr && _impl_.op_response_ != nullptr) {
+    delete _impl_.op_response_;
+  }
+  _impl_.op_response_ = nullptr;
+}
+inline const ::CacheMessageProto::CacheOpResponse& CacheMessage::_internal_op_response() const {
+  const ::CacheMessageProto::CacheOpResponse* p = _impl_.op_response_;
+  return p != nullptr ? *p : reinterpret_cast<const ::CacheMessageProto::CacheOpResponse&>(
+      ::CacheMessageProto::_CacheOpResponse_default_instance_);
+}
+inline const ::CacheMessageProto::CacheOpResponse& CacheMessage::op_response() const {
+  // @@protoc_insertion_point(field_get:CacheMessageProto.CacheMessage.op_response)
+  return _internal_op_response();
+}
+inline void CacheMessage::unsafe_arena_set_allocated_op_response(
+    ::CacheMessageProto::CacheOpResponse* op_response) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.op_response_);
+  }
+  _impl_.op_response_ = op_response;
+  if (op_response) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CacheMessageProto.CacheMessage.op_response)
+}
+inline ::CacheMessageProto::CacheOpResponse* CacheMessage::release_op_response() {
+  
+  ::CacheMessageProto::CacheOpResponse* temp = _impl_.op_response_;
+  _impl_.op_response_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::CacheMessageProto::CacheOpResponse* CacheMessage::unsafe_arena_release_op_response() {
+  // @@protoc_insertion_point(field_release:CacheMessageProto.CacheMessage.op_response)
+  
+  ::CacheMessageProto::CacheOpResponse* temp = _impl_.op_response_;
+  _impl_.op_response_ = nullptr;
+  return temp;
+}
+inline ::CacheMessageProto::CacheOpResponse* CacheMessage::_internal_mutable_op_response() {
+  
+  if (_impl_.op_response_ == nullptr) {
+    auto* p = CreateMaybeMessage<::CacheMessageProto::CacheOpResponse>(GetArenaForAllocation());
+    _impl_.op_response_ = p;
+  }
+  return _impl_.op_response_;
+}
+inline ::CacheMessageProto::CacheOpResponse* CacheMessage::mutable_op_response() {
+  ::CacheMessageProto::CacheOpResponse* _msg = _internal_mutable_op_response();
+  // @@protoc_insertion_point(field_mutable:CacheMessageProto.CacheMessage.op_response)
+  return _msg;
+}
+inline void CacheMessage::set_allocated_op_response(::CacheMessageProto::CacheOpResponse* op_response) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.op_response_;
+  }
+  if (op_response) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(op_response);
+    if (message_arena != submessage_arena) {
+      op_response = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, op_response, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.op_response_ = op_response;
+  // @@protoc_insertion_point(field_set_allocated:CacheMessageProto.CacheMessage.op_response)
+}
+
+// .CacheMessageProto.CacheReadManyRequest read_many_request = 5;
+inline bool CacheMessage::_internal_has_read_many_request() const {
+  return this != internal_default_instance() && _impl_.read_many_request_ != nullptr;
+}
+inline bool CacheMessage::has_read_many_request() const {
+  return _internal_has_read_many_request();
+}
+inline void CacheMessage::clear_read_many_request() {
+  if (GetArenaForAllocation() == nullptr && _impl_.read_many_request_ != nullptr) {
+    delete _impl_.read_many_request_;
+  }
+  _impl_.read_many_request_ = nullptr;
+}
+inline const ::CacheMessageProto::CacheReadManyRequest& CacheMessage::_internal_read_many_request() const {
+  const ::CacheMessageProto::CacheReadManyRequest* p = _impl_.read_many_request_;
+  return p != nullptr ? *p : reinterpret_cast<const ::CacheMessageProto::CacheReadManyRequest&>(
+      ::CacheMessageProto::_CacheReadManyRequest_default_instance_);
+}
+inline const ::CacheMessageProto::CacheReadManyRequest& CacheMessage::read_many_request() const {
+  // @@protoc_insertion_point(field_get:CacheMessageProto.CacheMessage.read_many_request)
+  return _internal_read_many_request();
+}
+inline void CacheMessage::unsafe_arena_set_allocated_read_many_request(
+    ::CacheMessageProto::CacheReadManyRequest* read_many_request) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.read_many_request_);
+  }
+  _impl_.read_many_request_ = read_many_request;
+  if (read_many_request) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CacheMessageProto.CacheMessage.read_many_request)
+}
+inline ::CacheMessageProto::CacheReadManyRequest* CacheMessage::release_read_many_request() {
+  
+  ::CacheMessageProto::CacheReadManyRequest* temp = _impl_.read_many_request_;
+  _impl_.read_many_request_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::CacheMessageProto::CacheReadManyRequest* CacheMessage::unsafe_arena_release_read_many_request() {
+  // @@protoc_insertion_point(field_release:CacheMessageProto.CacheMessage.read_many_request)
+  
+  ::CacheMessageProto::CacheReadManyRequest* temp = _impl_.read_many_request_;
+  _impl_.read_many_request_ = nullptr;
+  return temp;
+}
+inline ::CacheMessageProto::CacheReadManyRequest* CacheMessage::_internal_mutable_read_many_request() {
+  
+  if (_impl_.read_many_request_ == nullptr) {
+    auto* p = CreateMaybeMessage<::CacheMessageProto::CacheReadManyRequest>(GetArenaForAllocation());
+    _impl_.read_many_request_ = p;
+  }
+  return _impl_.read_many_request_;
+}
+inline ::CacheMessageProto::CacheReadManyRequest* CacheMessage::mutable_read_many_request() {
+  ::CacheMessageProto::CacheReadManyRequest* _msg = _internal_mutable_read_many_request();
+  // @@protoc_insertion_point(field_mutable:CacheMessageProto.CacheMessage.read_many_request)
+  return _msg;
+}
+inline void CacheMessage::set_allocated_read_many_request(::CacheMessageProto::CacheReadManyRequest* read_many_request) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.read_many_request_;
+  }
+  if (read_many_request) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(read_many_request);
+    if (message_arena != submessage_arena) {
+      read_many_request = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, read_many_request, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.read_many_request_ = read_many_request;
+  // @@protoc_insertion_point(field_set_allocated:CacheMessageProto.CacheMessage.read_many_request)
+}
+
+// .CacheMessageProto.CacheUpdateManyRequest update_many_request = 6;
+inline bool CacheMessage::_internal_has_update_many_request() const {
+  return this != internal_default_instance() && _impl_.update_many_request_ != nullptr;
+}
+inline bool CacheMessage::has_update_many_request() const {
+  return _internal_has_update_many_request();
+}
+inline void CacheMessage::clear_update_many_request() {
+  if (GetArenaForAllocation() == nullptr && _impl_.update_many_request_ != nullptr) {
+    delete _impl_.update_many_request_;
+  }
+  _impl_.update_many_request_ = nullptr;
+}
+inline const ::CacheMessageProto::CacheUpdateManyRequest& CacheMessage::_internal_update_many_request() const {
+  const ::CacheMessageProto::CacheUpdateManyRequest* p = _impl_.update_many_request_;
+  return p != nullptr ? *p : reinterpret_cast<const ::CacheMessageProto::CacheUpdateManyRequest&>(
+      ::CacheMessageProto::_CacheUpdateManyRequest_default_instance_);
+}
+inline const ::CacheMessageProto::CacheUpdateManyRequest& CacheMessage::update_many_request() const {
+  // @@protoc_insertion_point(field_get:CacheMessageProto.CacheMessage.update_many_request)
+  return _internal_update_many_request();
+}
+inline void CacheMessage::unsafe_arena_set_allocated_update_many_request(
+    ::CacheMessageProto::CacheUpdateManyRequest* update_many_request) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.update_many_request_);
+  }
+  _impl_.update_many_request_ = update_many_request;
+  if (update_many_request) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CacheMessageProto.CacheMessage.update_many_request)
+}
+inline ::CacheMessageProto::CacheUpdateManyRequest* CacheMessage::release_update_many_request() {
+  
+  ::CacheMessageProto::CacheUpdateManyRequest* temp = _impl_.update_many_request_;
+  _impl_.update_many_request_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::CacheMessageProto::CacheUpdateManyRequest* CacheMessage::unsafe_arena_release_update_many_request() {
+  // @@protoc_insertion_point(field_release:CacheMessageProto.CacheMessage.update_many_request)
+  
+  ::CacheMessageProto::CacheUpdateManyRequest* temp = _impl_.update_many_request_;
+  _impl_.update_many_request_ = nullptr;
+  return temp;
+}
+inline ::CacheMessageProto::CacheUpdateManyRequest* CacheMessage::_internal_mutable_update_many_request() {
+  
+  if (_impl_.update_many_request_ == nullptr) {
+    auto* p = CreateMaybeMessage<::CacheMessageProto::CacheUpdateManyRequest>(GetArenaForAllocation());
+    _impl_.update_many_request_ = p;
+  }
+  return _impl_.update_many_request_;
+}
+inline ::CacheMessageProto::CacheUpdateManyRequest* CacheMessage::mutable_update_many_request() {
+  ::CacheMessageProto::CacheUpdateManyRequest* _msg = _internal_mutable_update_many_request();
+  // @@protoc_insertion_point(field_mutable:CacheMessageProto.CacheMessage.update_many_request)
+  return _msg;
+}
+inline void CacheMessage::set_allocated_update_many_request(::CacheMessageProto::CacheUpdateManyRequest* update_many_request) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.update_many_request_;
+  }
+  if (update_many_request) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(update_many_request);
+    if (message_arena != submessage_arena) {
+      update_many_request = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, update_many_request, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.update_many_request_ = update_many_request;
+  // @@protoc_insertion_point(field_set_allocated:CacheMessageProto.CacheMessage.update_many_request)
+}
+
+// repeated .CacheMessageProto.CacheOpResponse op_responses = 7;
+inline int CacheMessage::_internal_op_responses_size() const {
+  return _impl_.op_responses_.size();
+}
+inline int CacheMessage::op_responses_size() const {
+  return _internal_op_responses_size();
+}
+inline void CacheMessage::clear_op_responses() {
+  _impl_.op_responses_.Clear();
+}
+inline ::CacheMessageProto::CacheOpResponse* CacheMessage::mutable_op_responses(int index) {
+  // @@protoc_insertion_point(field_mutable:CacheMessageProto.CacheMessage.op_responses)
+  return _impl_.op_responses_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CacheMessageProto::CacheOpResponse >*
+CacheMessage::mutable_op_responses() {
+  // @@protoc_insertion_point(field_mutable_list:CacheMessageProto.CacheMessage.op_responses)
+  return &_impl_.op_responses_;
+}
+inline const ::CacheMessageProto::CacheOpResponse& CacheMessage::_internal_op_responses(int index) const {
+  return _impl_.op_responses_.Get(index);
+}
+inline const ::CacheMessageProto::CacheOpResponse& CacheMessage::op_responses(int index) const {
+  // @@protoc_insertion_point(field_get:CacheMessageProto.CacheMessage.op_responses)
+  return _internal_op_responses(index);
+}
+inline ::CacheMessageProto::CacheOpResponse* CacheMessage::_internal_add_op_responses() {
+  return _impl_.op_responses_.Add();
+}
+inline ::CacheMessageProto::CacheOpResponse* CacheMessage::add_op_responses() {
+  ::CacheMessageProto::CacheOpResponse* _add = _internal_add_op_responses();
+  // @@protoc_insertion_point(field_add:CacheMessageProto.CacheMessage.op_responses)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CacheMessageProto::CacheOpResponse >&
+CacheMessage::op_responses() const {
+  // @@protoc_insertion_point(field_list:CacheMessageProto.CacheMessage.op_responses)
+  return _impl_.op_responses_;
+}
+
+// .CacheMessageProto.CacheInvalidate invalidate = 8;
+inline bool CacheMessage::_internal_has_invalidate() const {
+  return this != internal_default_instance() && _impl_.invalidate_ != nullptr;
+}
+inline bool CacheMessage::has_invalidate() const {
+  return _internal_has_invalidate();
+}
+inline void CacheMessage::clear_invalidate() {
+  if (GetArenaForAllocation() == nullptr && _impl_.invalidate_ != nullptr) {
+    delete _impl_.invalidate_;
+  }
+  _impl_.invalidate_ = nullptr;
+}
+inline const ::CacheMessageProto::CacheInvalidate& CacheMessage::_internal_invalidate() const {
+  const ::CacheMessageProto::CacheInvalidate* p = _impl_.invalidate_;
+  return p != nullptr ? *p : reinterpret_cast<const ::CacheMessageProto::CacheInvalidate&>(
+      ::CacheMessageProto::_CacheInvalidate_default_instance_);
+}
+inline const ::CacheMessageProto::CacheInvalidate& CacheMessage::invalidate() const {
+  // @@protoc_insertion_point(field_get:CacheMessageProto.CacheMessage.invalidate)
+  return _internal_invalidate();
+}
+inline void CacheMessage::unsafe_arena_set_allocated_invalidate(
+    ::CacheMessageProto::CacheInvalidate* invalidate) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.invalidate_);
+  }
+  _impl_.invalidate_ = invalidate;
+  if (invalidate) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CacheMessageProto.CacheMessage.invalidate)
+}
+inline ::CacheMessageProto::CacheInvalidate* CacheMessage::release_invalidate() {
+  
+  ::CacheMessageProto::CacheInvalidate* temp = _impl_.invalidate_;
+  _impl_.invalidate_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::CacheMessageProto::CacheInvalidate* CacheMessage::unsafe_arena_release_invalidate() {
+  // @@protoc_insertion_point(field_release:CacheMessageProto.CacheMessage.invalidate)
+  
+  ::CacheMessageProto::CacheInvalidate* temp = _impl_.invalidate_;
+  _impl_.invalidate_ = nullptr;
+  return temp;
+}
+inline ::CacheMessageProto::CacheInvalidate* CacheMessage::_internal_mutable_invalidate() {
+  
+  if (_impl_.invalidate_ == nullptr) {
+    auto* p = CreateMaybeMessage<::CacheMessageProto::CacheInvalidate>(GetArenaForAllocation());
+    _impl_.invalidate_ = p;
+  }
+  return _impl_.invalidate_;
+}
+inline ::CacheMessageProto::CacheInvalidate* CacheMessage::mutable_invalidate() {
+  ::CacheMessageProto::CacheInvalidate* _msg = _internal_mutable_invalidate();
+  // @@protoc_insertion_point(field_mutable:CacheMessageProto.CacheMessage.invalidate)
+  return _msg;
+}
+inline void CacheMessage::set_allocated_invalidate(::CacheMessageProto::CacheInvalidate* invalidate) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.invalidate_;
+  }
+  if (invalidate) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(invalidate);
+    if (message_arena != submessage_arena) {
+      invalidate = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, invalidate, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.invalidate_ = invalidate;
+  // @@protoc_insertion_point(field_set_allocated:CacheMessageProto.CacheMessage.invalidate)
+}
+
+// .CacheMessageProto.CacheReplicate replicate = 9;
+inline bool CacheMessage::_internal_has_replicate() const {
+  return this != internal_default_instance() && _impl_.replicate_ != nullptr;
+}
+inline bool CacheMessage::has_replicate() const {
+  return _internal_has_replicate();
+}
+inline void CacheMessage::clear_replicate() {
+  if (GetArenaForAllocation() == nullptr && _impl_.replicate_ != nullptr) {
+    delete _impl_.replicate_;
+  }
+  _impl_.replicate_ = nullptr;
+}
+inline const ::CacheMessageProto::CacheReplicate& CacheMessage::_internal_replicate() const {
+  const ::CacheMessageProto::CacheReplicate* p = _impl_.replicate_;
+  return p != nullptr ? *p : reinterpret_cast<const ::CacheMessageProto::CacheReplicate&>(
+      ::CacheMessageProto::_CacheReplicate_default_instance_);
+}
+inline const ::CacheMessageProto::CacheReplicate& CacheMessage::replicate() const {
+  // @@protoc_insertion_point(field_get:CacheMessageProto.CacheMessage.replicate)
+  return _internal_replicate();
+}
+inline void CacheMessage::unsafe_arena_set_allocated_replicate(
+    ::CacheMessageProto::CacheReplicate* replicate) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.replicate_);
+  }
+  _impl_.replicate_ = replicate;
+  if (replicate) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CacheMessageProto.CacheMessage.replicate)
+}
+inline ::CacheMessageProto::CacheReplicate* CacheMessage::release_replicate() {
+  
+  ::CacheMessageProto::CacheReplicate* temp = _impl_.replicate_;
+  _impl_.replicate_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::CacheMessageProto::CacheReplicate* CacheMessage::unsafe_arena_release_replicate() {
+  // @@protoc_insertion_point(field_release:CacheMessageProto.CacheMessage.replicate)
+  
+  ::CacheMessageProto::CacheReplicate* temp = _impl_.replicate_;
+  _impl_.replicate_ = nullptr;
+  return temp;
+}
+inline ::CacheMessageProto::CacheReplicate* CacheMessage::_internal_mutable_replicate() {
+  
+  if (_impl_.replicate_ == nullptr) {
+    auto* p = CreateMaybeMessage<::CacheMessageProto::CacheReplicate>(GetArenaForAllocation());
+    _impl_.replicate_ = p;
+  }
+  return _impl_.replicate_;
+}
+inline ::CacheMessageProto::CacheReplicate* CacheMessage::mutable_replicate() {
+  ::CacheMessageProto::CacheReplicate* _msg = _internal_mutable_replicate();
+  // @@protoc_insertion_point(field_mutable:CacheMessageProto.CacheMessage.replicate)
+  return _msg;
+}
+inline void CacheMessage::set_allocated_replicate(::CacheMessageProto::CacheReplicate* replicate) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.replicate_;
+  }
+  if (replicate) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(replicate);
+    if (message_arena != submessage_arena) {
+      replicate = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, replicate, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.replicate_ = replicate;
+  // @@protoc_insertion_point(field_set_allocated:CacheMessageProto.CacheMessage.replicate)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace CacheMessageProto
+
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::CacheMessageProto::CacheMessageType> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::CacheMessageProto::CacheMessageType>() {
+  return ::CacheMessageProto::CacheMessageType_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_cache_5fmessage_2eproto
@@ -0,0 +1,223 @@
+/*
+ * async_log.cc
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: rynzen <chuanrui123@126.com>
+ *
+ *  This file is part of a cache system of lease mechanism implemenation.
+ *
+ *  async_log.cc is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  async_log.cc is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with consistent_hashing.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <mutex>
+#include <vector>
+#include <thread>
+#include <condition_variable>
+#include <algorithm>
+#include <cstdlib>
+
+#if defined(OS_WINDOWS)
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+#include "common.h"
+
+CACHE_NAMESPACE_BEGIN
+std::atomic<int>  AsyncLogger::level_{ kLogInfo };
+std::atomic<bool> AsyncLogger::stopped_{ false };
+
+//
+// rings of all threads and the thread writing them out,never destroyed so
+// threads logging during exit find it,stopped from atexit()
+class LogWriter {
+	enum LogWriterLimits {
+		kOutputSize = 64 * 1024,
+		//longest line,longer ones are cut
+		kLineSize = 512,
+		//idle writer sleeps up to this long
+		kMaxIdleMillisecond = 8,
+	};
+public:
+	static LogWriter* get_log_writer() {
+		static LogWriter* writer = new LogWriter();
+		return writer;
+	}
+	std::shared_ptr<LogRing> attach() {
+		std::shared_ptr<LogRing> ring = std::make_shared<LogRing>();
+		std::lock_guard<std::mutex> lock(mutex_);
+		if (!thread_.joinable()) {
+			thread_ = std::thread(&LogWriter::run, this);
+			std::atexit([]() { get_log_writer()->stop(); });
+		}
+		rings_.push_back(ring);
+		return ring;
+	}
+	//caller holds no lock
+	void flush() {
+		std::lock_guard<std::mutex> lock(drain_mutex_);
+		drain();
+	}
+	void write_record(const LogRecord& record) {
+		std::lock_guard<std::mutex> lock(drain_mutex_);
+		append(record);
+		write_out();
+	}
+private:
+	LogWriter() :mutex_(), drain_mutex_(), wake_(), running_(true), thread_(),
+		rings_(), output_(), second_(-1), prefix_{}, prefix_length_(0) {
+		output_.reserve(kOutputSize + kLineSize);
+	}
+	void stop() {
+		AsyncLogger::stopped_.store(true);
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			running_ = false;
+		}
+		wake_.notify_one();
+		if (thread_.joinable())
+			thread_.join();
+		flush();
+	}
+	void run() {
+		uint32_t idle_ms = 0;
+		std::unique_lock<std::mutex> lock(mutex_);
+		while (running_) {
+			lock.unlock();
+			size_t count = 0;
+			{
+				std::lock_guard<std::mutex> drain_lock(drain_mutex_);
+				count = drain();
+			}
+			lock.lock();
+			//back off while nothing comes,producers never wake us
+			idle_ms = count ? 0 : std::min<uint32_t>(idle_ms ? idle_ms * 2 : 1, kMaxIdleMillisecond);
+			if (idle_ms)
+				wake_.wait_for(lock, std::chrono::milliseconds(idle_ms));
+		}
+	}
+	//holding drain_mutex_
+	size_t drain() {
+		std::vector<std::shared_ptr<LogRing>> rings{};
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			rings = rings_;
+		}
+		size_t count = 0;
+		for (auto& ring : rings) {
+			//retired flag first,records before it are all visible then
+			bool retired = ring->retired();
+			while (const LogRecord* record = ring->front()) {
+				append(*record);
+				ring->pop();
+				++count;
+				if (output_.size() >= kOutputSize)
+					write_out();
+			}
+			if (uint64_t dropped = ring->take_dropped()) {
+				char line[64];
+				int length = snprintf(line, sizeof(line), "dropped %llu log records\r\n", (unsigned long long)dropped);
+				output_.append(line, length);
+			}
+			if (retired) {
+				std::lock_guard<std::mutex> lock(mutex_);
+				rings_.erase(std::remove(rings_.begin(), rings_.end(), ring), rings_.end());
+			}
+		}
+		write_out();
+		return count;
+	}
+	void append(const LogRecord& record) {
+		update_prefix(record.timestamp);
+		size_t start = output_.size();
+		output_.resize(start + kLineSize);
+		char* line = &output_[start];
+		std::memcpy(line, prefix_, prefix_length_);
+		int length = prefix_length_;
+		length += snprintf(line + length, kLineSize - length, " %s %s() %u:", basename(record.file), record.func, record.line);
+		length = std::min<int>(length, kLineSize - 1);
+		length += std::max(record.format(record, line + length, kLineSize - length), 0);
+		output_.resize(start + std::min<int>(length, kLineSize - 1));
+	}
+	//date and time of a second formatted once
+	void update_prefix(std::time_t timestamp) {
+		std::time_t second = timestamp / 1000;
+		if (second == second_)
+			return;
+		second_ = second;
+		struct tm c {};
+#if defined(OS_WINDOWS)
+		localtime_s(&c, &second);
+#else
+		localtime_r(&second, &c);
+#endif
+		prefix_length_ = snprintf(prefix_, sizeof(prefix_), "%d-%d-%d %d:%d:%d", c.tm_year + 1900, c.tm_mon + 1, c.tm_mday, c.tm_hour, c.tm_min, c.tm_sec);
+	}
+	void write_out() {
+		if (output_.empty())
+			return;
+#if defined(OS_WINDOWS)
+		HANDLE stdout_handle = ::GetStdHandle(STD_OUTPUT_HANDLE);
+		DWORD bytes_written = 0;
+		::WriteFile(stdout_handle, output_.data(), (DWORD)output_.size(), &bytes_written, 0);
+#else
+		size_t written = 0;
+		while (written < output_.size()) {
+			ssize_t ret = ::write(STDOUT_FILENO, output_.data() + written, output_.size() - written);
+			if (ret <= 0)
+				break;
+			written += (size_t)ret;
+		}
+#endif
+		output_.clear();
+	}
+	//guards rings_ and running_
+	std::mutex								mutex_;
+	//one consumer of the rings at a time,the writer thread or a flush()
+	std::mutex								drain_mutex_;
+	std::condition_variable					wake_;
+	bool									running_;
+	std::thread								thread_;
+	std::vector<std::shared_ptr<LogRing>>	rings_;
+	std::string								output_;
+	std::time_t								second_;
+	char									prefix_[32];
+	int										prefix_length_;
+};
+
+namespace {
+//ring goes to the writer when its thread exits
+struct LogRingHolder {
+	std::shared_ptr<LogRing> ring;
+	~LogRingHolder() {
+		if (ring)
+			ring->retire();
+	}
+};
+}
+
+void AsyncLogger::flush() {
+	LogWriter::get_log_writer()->flush();
+}
+
+LogRing* AsyncLogger::thread_ring() {
+	static thread_local LogRingHolder holder{};
+	if (unlikely(!holder.ring))
+		holder.ring = LogWriter::get_log_writer()->attach();
+	return holder.ring.get();
+}
+
+void AsyncLogger::write_now(const LogRecord& record) {
+	LogWriter::get_log_writer()->write_record(record);
+}
+CACHE_NAMESPACE_END
@@ -0,0 +1,286 @@
+/*
+ * cache_metrics.cc
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: rynzen <chuanrui123@126.com>
+ *
+ *  This file is part of a cache system of lease mechanism implemenation.
+ *
+ *  cache_metrics.cc is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  cache_metrics.cc is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with consistent_hashing.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <cstdio>
+#include <cstdarg>
+#include <cstring>
+#include <cerrno>
+
+#if !defined(OS_WINDOWS)
+#include <unistd.h>
+#include <netdb.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#endif
+#include "common.h"
+#include "cache_metrics.h"
+
+CACHE_NAMESPACE_BEGIN
+namespace {
+//shards of all threads and the sources,never destroyed so threads counting
+//during exit find it
+struct MetricRegistry {
+	static MetricRegistry* get_registry() {
+		static MetricRegistry* registry = new MetricRegistry();
+		return registry;
+	}
+	std::mutex									mutex;
+	std::vector<std::shared_ptr<MetricShard>>	shards;
+	std::vector<CacheMetrics::MetricSource>		sources;
+};
+
+const char* const kResultNames[kOpResultCount] = {
+	"ok", "defer", "retry", "error_argument", "error_no_data", "timeout",
+};
+const char* const kLatencyOps[] = {
+	"read", "update", "read_many", "update_many", "ack",
+};
+
+void append_format(std::string& out, const char* fmt, ...) {
+	char line[256];
+	va_list args;
+	va_start(args, fmt);
+	int length = vsnprintf(line, sizeof(line), fmt, args);
+	va_end(args);
+	if (length > 0)
+		out.append(line, std::min<size_t>((size_t)length, sizeof(line) - 1));
+}
+void append_header(std::string& out, const char* name, const char* type, const char* help) {
+	append_format(out, "# HELP %s %s\n# TYPE %s %s\n", name, help, name, type);
+}
+//labels:"" or `op="read",`,quantiles in seconds
+void append_summary(std::string& out, const char* name, const char* labels, const HistogramSnapshot& histogram) {
+	static const double kQuantiles[] = { 0.5, 0.9, 0.99, 0.999 };
+	for (double quantile : kQuantiles) {
+		append_format(out, "%s{%squantile=\"%g\"} %.9g\n", name, labels, quantile,
+			(double)histogram.value_at(quantile) / 1e9);
+	}
+	std::string bare(labels, std::strlen(labels) ? std::strlen(labels) - 1 : 0);
+	const char* open = bare.empty() ? "" : "{";
+	const char* close = bare.empty() ? "" : "}";
+	append_format(out, "%s_sum%s%s%s %.9g\n", name, open, bare.c_str(), close, (double)histogram.sum / 1e9);
+	append_format(out, "%s_count%s%s%s %llu\n", name, open, bare.c_str(), close, (unsigned long long)histogram.count);
+}
+}
+
+MetricShard* CacheMetrics::attach() {
+	std::shared_ptr<MetricShard> shard = std::make_shared<MetricShard>();
+	MetricRegistry* registry = MetricRegistry::get_registry();
+	std::lock_guard<std::mutex> lock(registry->mutex);
+	registry->shards.push_back(shard);
+	return shard.get();
+}
+
+MetricsSnapshot CacheMetrics::snapshot() {
+	MetricsSnapshot snapshot{};
+	for (auto& histogram : snapshot.histograms)
+		histogram.buckets.assign(MetricBuckets::kBucketCount, 0);
+	std::vector<std::shared_ptr<MetricShard>> shards{};
+	{
+		MetricRegistry* registry = MetricRegistry::get_registry();
+		std::lock_guard<std::mutex> lock(registry->mutex);
+		shards = registry->shards;
+	}
+	for (auto& shard : shards) {
+		for (uint32_t i = 0; i < kMetricCounterCount; ++i)
+			snapshot.counters[i] += shard->counters[i].load(std::memory_order_relaxed);
+		for (uint32_t i = 0; i < kMetricHistogramCount; ++i) {
+			const MetricShard::Histogram& from = shard->histograms[i];
+			HistogramSnapshot& to = snapshot.histograms[i];
+			//count summed from buckets,so quantiles always find their rank
+			for (uint32_t j = 0; j < MetricBuckets::kBucketCount; ++j) {
+				uint64_t count = from.buckets[j].load(std::memory_order_relaxed);
+				to.buckets[j] += count;
+				to.count += count;
+			}
+			to.sum += from.sum.load(std::memory_order_relaxed);
+		}
+	}
+	return snapshot;
+}
+
+void CacheMetrics::add_source(MetricSource source) {
+	MetricRegistry* registry = MetricRegistry::get_registry();
+	std::lock_guard<std::mutex> lock(registry->mutex);
+	registry->sources.push_back(std::move(source));
+}
+
+void CacheMetrics::append_metric(std::string& out, const char* name, const char* type, const char* help, double value) {
+	append_header(out, name, type, help);
+	append_format(out, "%s %.17g\n", name, value);
+}
+
+std::string CacheMetrics::render() {
+	MetricsSnapshot snapshot = CacheMetrics::snapshot();
+	std::string out{};
+	out.reserve(8192);
+	append_header(out, "csn_read_results_total", "counter", "results of reads,one per key");
+	for (uint32_t i = 0; i < kOpResultCount; ++i) {
+		append_format(out, "csn_read_results_total{result=\"%s\"} %llu\n", kResultNames[i],
+			(unsigned long long)snapshot.counters[kMetricReadResults + i]);
+	}
+	append_header(out, "csn_update_results_total", "counter", "results of updates,one per key,deferred ones again once committed");
+	for (uint32_t i = 0; i < kOpResultCount; ++i) {
+		append_format(out, "csn_update_results_total{result=\"%s\"} %llu\n", kResultNames[i],
+			(unsigned long long)snapshot.counters[kMetricUpdateResults + i]);
+	}
+	append_metric(out, "csn_read_not_modified_total", "counter", "reads renewing a lease on a value the client holds,sent without it",
+		(double)snapshot.counters[kMetricReadsNotModified]);
+	append_metric(out, "csn_ack_retransmits_total", "counter", "responses sent again as their ack didn't come in time",
+		(double)snapshot.counters[kMetricAckRetransmits]);
+	append_metric(out, "csn_ack_resends_total", "counter", "responses sent again for a request the client resent",
+		(double)snapshot.counters[kMetricAckResends]);
+	append_metric(out, "csn_ack_unmatched_total", "counter", "acks of no response waiting,late or duplicated",
+		(double)snapshot.counters[kMetricAckUnmatched]);
+	append_metric(out, "csn_timers_fired_total", "counter", "timer callbacks run",
+		(double)snapshot.counters[kMetricTimersFired]);
+
+	append_header(out, "csn_op_latency_seconds", "summary", "server processing of a request,receive to send");
+	for (uint32_t i = kMetricReadLatency; i <= kMetricAckLatency; ++i) {
+		std::string labels = std::string("op=\"") + kLatencyOps[i - kMetricReadLatency] + "\",";
+		append_summary(out, "csn_op_latency_seconds", labels.c_str(), snapshot.histograms[i]);
+	}
+	append_header(out, "csn_ack_round_trip_seconds", "summary", "response sent to its ack received");
+	append_summary(out, "csn_ack_round_trip_seconds", "", snapshot.histograms[kMetricAckRoundTrip]);
+	append_header(out, "csn_defer_wait_seconds", "summary", "deferred update waiting for the lease to end");
+	append_summary(out, "csn_defer_wait_seconds", "", snapshot.histograms[kMetricDeferWait]);
+	append_header(out, "csn_timer_lag_seconds", "summary", "timer fired this long after its expire time");
+	append_summary(out, "csn_timer_lag_seconds", "", snapshot.histograms[kMetricTimerLag]);
+
+	std::vector<MetricSource> sources{};
+	{
+		MetricRegistry* registry = MetricRegistry::get_registry();
+		std::lock_guard<std::mutex> lock(registry->mutex);
+		sources = registry->sources;
+	}
+	for (auto& source : sources)
+		source(out);
+	return out;
+}
+
+MetricsExporter::~MetricsExporter() {
+	stop();
+#if !defined(OS_WINDOWS)
+	if (fd_ >= 0)
+		::close(fd_);
+#endif
+}
+void MetricsExporter::start() {
+	std::lock_guard<std::mutex> lock(mutex_);
+	if (running_)
+		throw Exception(Exception::kErrorIllUsage, "MetricsExporter already started");
+	running_ = true;
+	thread_ = std::thread(&MetricsExporter::run, this);
+}
+void MetricsExporter::stop() {
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		if (!running_)
+			return;
+		running_ = false;
+	}
+	cond_.notify_all();
+	thread_.join();
+}
+void MetricsExporter::export_now() {
+	std::string text = CacheMetrics::render();
+	if (target_ == kExportFile)
+		write_file(text);
+	else
+		send_datagram(text);
+}
+void MetricsExporter::run() {
+	std::unique_lock<std::mutex> lock(mutex_);
+	bool stopping = false;
+	while (!stopping) {
+		stopping = cond_.wait_for(lock, std::chrono::milliseconds(interval_ms_), [this]() { return !running_; });
+		lock.unlock();
+		try {
+			export_now();
+		}
+		catch (csn::Exception e) { LOG_OUT("metrics csn::Exception code:%d describe:%s", e.code(), e.what()); }
+		lock.lock();
+	}
+}
+//readers see the old file or the new one,never a part
+void MetricsExporter::write_file(const std::string& text) {
+	std::string temp = address_ + ".tmp";
+	std::FILE* file = std::fopen(temp.c_str(), "wb");
+	if (!file)
+		throw Exception(Exception::kErrorWrite, "open " + temp + " failure");
+	bool written = std::fwrite(text.data(), 1, text.size(), file) == text.size();
+	written = std::fclose(file) == 0 && written;
+#if defined(OS_WINDOWS)
+	std::remove(address_.c_str());
+#endif
+	if (!written || std::rename(temp.c_str(), address_.c_str()) != 0)
+		throw Exception(Exception::kErrorWrite, "write " + address_ + " failure");
+}
+//connected once,retried on the next export until then,
+//a udp receiver not up yet just misses the datagram
+void MetricsExporter::send_datagram(const std::string& text) {
+#if defined(OS_WINDOWS)
+	throw Exception(Exception::kErrorIllUsage, "metrics datagram export is not supported on windows");
+#else
+	if (fd_ < 0) {
+		if (target_ == kExportUnix) {
+			sockaddr_un address{};
+			address.sun_family = AF_UNIX;
+			if (address_.size() >= sizeof(address.sun_path))
+				throw Exception(Exception::kErrorIllArgument, "unix socket path too long " + address_);
+			std::memcpy(address.sun_path, address_.data(), address_.size());
+			int fd = ::socket(AF_UNIX, SOCK_DGRAM, 0);
+			if (fd < 0)
+				throw Exception(Exception::kErrorSysRoutine, "socket failure");
+			if (::connect(fd, (const sockaddr*)&address, sizeof(address)) != 0) {
+				::close(fd);
+				throw Exception(Exception::kErrorWrite, "connect " + address_ + " failure");
+			}
+			fd_ = fd;
+		}
+		else {
+			size_t colon = address_.rfind(':');
+			if (colon == std::string::npos)
+				throw Exception(Exception::kErrorIllArgument, "udp target should be host:port " + address_);
+			std::string host = address_.substr(0, colon);
+			std::string port = address_.substr(colon + 1);
+			addrinfo hints{};
+			hints.ai_family = AF_UNSPEC;
+			hints.ai_socktype = SOCK_DGRAM;
+			addrinfo* result = nullptr;
+			if (::getaddrinfo(host.c_str(), port.c_str(), &hints, &result) != 0 || !result)
+				throw Exception(Exception::kErrorIllArgument, "resolve " + address_ + " failure");
+			int fd = ::socket(result->ai_family, result->ai_socktype, result->ai_protocol);
+			bool connected = fd >= 0 && ::connect(fd, result->ai_addr, result->ai_addrlen) == 0;
+			::freeaddrinfo(result);
+			if (!connected) {
+				if (fd >= 0)
+					::close(fd);
+				throw Exception(Exception::kErrorWrite, "connect " + address_ + " failure");
+			}
+			fd_ = fd;
+		}
+	}
+	if (::send(fd_, text.data(), text.size(), 0) < 0 && errno != ECONNREFUSED && errno != ENOENT)
+		throw Exception(Exception::kErrorWrite, "send metrics to " + address_ + " failure");
+#endif
+}
+CACHE_NAMESPACE_END
@@ -28,9 +28,16 @@
 #include <memory>
 #include "common.h"
 #include "timer_queue.h"
+#include "cache_metrics.h"
 
 CACHE_NAMESPACE_BEGIN
-TimerQueue TimerQueue::queue_{};
+thread_local TimerQueue TimerQueue::queue_{};
+
+TimerQueue::TimerQueue() :timers_(), free_head_(kLinkNull), slots_(),
+	current_(get_time_stamp()), count_()
+{
+	slots_.fill(kLinkNull);
+}
 
 const size_t TimerQueue::add_timer(TimerCallHandler&& callback,
 	uint32_t timeout_ms, uint32_t repeat) {
@@ -38,53 +45,193 @@ const size_t TimerQueue::add_timer(TimerCallHandler&& callback,
 		throw Exception(Exception::kErrorIllArgument, "error timer repeat count");
 
 	std::lock_guard<std::mutex> lock(mutex_);
-	const std::unique_ptr<EventTimer>& timer = timer_queue_.emplace_back(
-		std::make_unique<EventTimer>(std::forward<TimerCallHandler>(callback),
-			timeout_ms, repeat));
-	size_t timer_id = timer->timer_id();
-	//heap up
-	//warnning:would change timer reference !!!
-	std::push_heap(timer_queue_.begin(), timer_queue_.end(), compare_);
-	return timer_id;
+	uint32_t index = alloc_timer();
+	EventTimer& timer = timers_[index];
+	timer.callback_ = std::forward<TimerCallHandler>(callback);
+	timer.timeout_ms_ = timeout_ms;
+	timer.repeat_ = repeat;
+	timer.expire_time_ = get_time_stamp(timeout_ms);
+	link_timer(index);
+	++count_;
+	return ((size_t)timer.generation_ << 32) | ((size_t)index + 1);
 }
 //
 void TimerQueue::del_timer(const size_t timer_id) {
+	uint32_t index = (uint32_t)(timer_id & 0xFFFFFFFF) - 1;
+	uint32_t generation = (uint32_t)(timer_id >> 32);
 
 	std::lock_guard<std::mutex> lock(mutex_);
-	for (auto& t : timer_queue_) {
-		if (t->timer_id() == timer_id) {
-			//just make timer unavailable
-			t->repeat_ = 0;
-		}
+	if (unlikely(index >= timers_.size()))
+		return;
+	EventTimer& timer = timers_[index];
+	if (timer.generation_ != generation || timer.slot_ == kLinkNull)
+		return;
+	if (timer.slot_ == kLinkFiring) {
+		//callback is running,fire_timer recycles it afterwards
+		timer.repeat_ = 0;
+		return;
 	}
+	unlink_timer(index);
+	free_timer(index);
+	--count_;
 }
 void TimerQueue::tick() {
-	if (timer_queue_.empty())
+	std::unique_lock<std::mutex> lock(mutex_);
+	std::time_t now = get_time_stamp();
+	if (!count_) {
+		//nothing to expire,no need to walk the idle milliseconds
+		current_ = std::max(current_, now);
 		return;
-	std::unique_ptr<EventTimer>& timer = timer_queue_.front();
-	while (unlikely(timer->expired())) {
-		//here we actually delete a timer  
-		std::lock_guard<std::mutex> lock(mutex_);
-		if (timer->repeat_ > 0) {
-			timer->callback_();
-			timer->repeat_--;
+	}
+	while (count_ && current_ <= now) {
+		uint32_t index = (uint32_t)(current_ & kRootMask);
+		//root wheel wraps,refill it from upper levels
+		if (!index && !cascade(0) && !cascade(1) && !cascade(2))
+			cascade(3);
+		++current_;
+		//detach the slot first,callbacks may add timers falling into it again
+		uint32_t timer = slots_[index];
+		slots_[index] = kLinkNull;
+		slots_[kFiringSlot] = timer;
+		for (; timer != kLinkNull; timer = timers_[timer].next_)
+			timers_[timer].slot_ = kFiringSlot;
+		while (slots_[kFiringSlot] != kLinkNull) {
+			timer = slots_[kFiringSlot];
+			unlink_timer(timer);
+			std::time_t late = get_time_stamp() - timers_[timer].expire_time_;
+			CacheMetrics::record(kMetricTimerLag, late > 0 ? (uint64_t)late * 1000000 : 0);
+			CacheMetrics::count(kMetricTimersFired);
+			fire_timer(timer, lock);
 		}
-		if (!timer->repeat_) {
-			//heap down
-			std::pop_heap(timer_queue_.begin(), timer_queue_.end(), compare_);
-			timer_queue_.pop_back();
+	}
+	if (!count_)
+		current_ = std::max(current_, now);
+}
+uint32_t TimerQueue::next_timeout_ms() {
+	std::lock_guard<std::mutex> lock(mutex_);
+	if (!count_)
+		return kTimerIdle;
+	//upper levels only come down when root wraps,wake up by then at latest
+	std::time_t target = (current_ & kRootMask) ? (current_ | kRootMask) + 1 : current_;
+	for (std::time_t t = current_; t < target; ++t) {
+		if (slots_[t & kRootMask] != kLinkNull) {
+			target = t;
+			break;
 		}
-		else
-		{
-			timer->reset();
-			//heap down
-			std::pop_heap(timer_queue_.begin(), timer_queue_.end(), compare_);
-			//heap up
-			std::push_heap(timer_queue_.begin(), timer_queue_.end(), compare_);
+	}
+	std::time_t now = get_time_stamp();
+	return target > now ? (uint32_t)(target - now) : 0;
+}
+size_t TimerQueue::size() {
+	std::lock_guard<std::mutex> lock(mutex_);
+	return count_;
+}
+
+uint32_t TimerQueue::alloc_timer() {
+	if (free_head_ == kLinkNull) {
+		uint32_t index = (uint32_t)timers_.size();
+		if (unlikely(index >= kLinkFiring))
+			throw Exception(Exception::kErrorOutOfRange, "too many timers");
+		EventTimer& timer = timers_.emplace_back();
+		timer.generation_ = 1;
+		timer.slot_ = kLinkNull;
+		return index;
+	}
+	uint32_t index = free_head_;
+	free_head_ = timers_[index].next_;
+	return index;
+}
+void TimerQueue::free_timer(uint32_t index) {
+	EventTimer& timer = timers_[index];
+	timer.callback_ = nullptr;
+	timer.slot_ = kLinkNull;
+	timer.generation_++;
+	timer.next_ = free_head_;
+	free_head_ = index;
+}
+void TimerQueue::link_timer(uint32_t index) {
+	EventTimer& timer = timers_[index];
+	std::time_t expire = timer.expire_time_;
+	int64_t delta = expire - current_;
+	uint32_t slot;
+	if (delta < 0) {
+		//already expired,run at next tick
+		slot = (uint32_t)(current_ & kRootMask);
+	}
+	else if (delta < kRootSize) {
+		slot = (uint32_t)(expire & kRootMask);
+	}
+	else {
+		if (delta > 0xFFFFFFFFll)
+			expire = current_ + 0xFFFFFFFFll;
+		uint32_t level = 0;
+		while (level < kLevelCount - 1 &&
+			delta >= (1ll << (kRootBits + (level + 1) * kLevelBits)))
+			++level;
+		slot = kRootSize + level * kLevelSize +
+			(uint32_t)((expire >> (kRootBits + level * kLevelBits)) & kLevelMask);
+	}
+	timer.slot_ = slot;
+	timer.prev_ = kLinkNull;
+	timer.next_ = slots_[slot];
+	if (timer.next_ != kLinkNull)
+		timers_[timer.next_].prev_ = index;
+	slots_[slot] = index;
+}
+void TimerQueue::unlink_timer(uint32_t index) {
+	EventTimer& timer = timers_[index];
+	if (timer.prev_ != kLinkNull)
+		timers_[timer.prev_].next_ = timer.next_;
+	else
+		slots_[timer.slot_] = timer.next_;
+	if (timer.next_ != kLinkNull)
+		timers_[timer.next_].prev_ = timer.prev_;
+	timer.slot_ = kLinkFiring;
+}
+uint32_t TimerQueue::cascade(uint32_t level) {
+	uint32_t index = (uint32_t)((current_ >> (kRootBits + level * kLevelBits)) & kLevelMask);
+	uint32_t slot = kRootSize + level * kLevelSize + index;
+	uint32_t timer = slots_[slot];
+	slots_[slot] = kLinkNull;
+	while (timer != kLinkNull) {
+		uint32_t next = timers_[timer].next_;
+		link_timer(timer);
+		timer = next;
+	}
+	return index;
+}
+void TimerQueue::fire_timer(uint32_t index, std::unique_lock<std::mutex>& lock) {
+	//slab may grow while callback runs,never hold a reference across it
+	TimerCallHandler callback = std::move(timers_[index].callback_);
+	timers_[index].repeat_--;
+	lock.unlock();
+	try {
+		callback();
+	}
+	catch (...) {
+		lock.lock();
+		free_timer(index);
+		--count_;
+		//the rest of the detached slot is due already,hand it to the next tick
+		uint32_t timer = slots_[kFiringSlot];
+		slots_[kFiringSlot] = kLinkNull;
+		while (timer != kLinkNull) {
+			uint32_t next = timers_[timer].next_;
+			link_timer(timer);
+			timer = next;
 		}
-		if (timer_queue_.empty())
-			break;
-		std::unique_ptr<EventTimer>& timer = timer_queue_.front();
+		throw;
+	}
+	lock.lock();
+	EventTimer& timer = timers_[index];
+	if (timer.repeat_ > 0) {
+		timer.callback_ = std::move(callback);
+		timer.expire_time_ = get_time_stamp(timer.timeout_ms_);
+		link_timer(index);
+	}
+	else {
+		free_timer(index);
+		--count_;
 	}
 }
 CACHE_NAMESPACE_END
\ No newline at end of file
@@ -12,6 +12,8 @@ int main(int argc, char** argv) {
 	try {
 		client->initialize("*", 3823, "127.0.0.1", 3824);
 		group.register_socket(client);
+		//resends and deadlines of operations
+		group.add_timer_source(TimerQueue::get_timer_queue());
 	}
 	CATCH_EXPTIONS;
 	int count = 0;
@@ -0,0 +1,63 @@
+#include <cstdlib>
+#include "common.h"
+#include "multi_reactor_server.h"
+#include "cache_snapshot.h"
+#include "cache_metrics.h"
+
+//usage: sample_multi_reactor_server [reactor count] [snapshot path] [wal path] [metrics target]
+//metrics target:a file path,udp:host:port or unix:socket path,written every 10 seconds
+int main(int argc, char** argv)
+{
+	using namespace csn;
+	uint32_t reactor_count = argc > 1 ? (uint32_t)std::atoi(argv[1]) : std::thread::hardware_concurrency();
+	MultiReactorServer server(reactor_count);
+	std::shared_ptr<CacheWal> wal;
+	std::unique_ptr<CacheSnapshotWriter> snapshot_writer;
+	std::unique_ptr<MetricsExporter> metrics_exporter;
+	try {
+		std::shared_ptr<CacheDataCenter<CacheDataType>> center = server.data_center();
+		if (argc > 2) {
+			//warm restart from last snapshot and the log since,then keep saving one every minute
+			try {
+				LOG_OUT("restored %llu keys", (unsigned long long)CacheSnapshot::load(*center, argv[2]));
+			}
+			catch (csn::Exception e) { LOG_OUT("no snapshot restored,code:%d describe:%s", e.code(), e.what()); }
+			if (argc > 3) {
+				wal = std::make_shared<CacheWal>(argv[3]);
+				LOG_OUT("replayed %llu updates", (unsigned long long)CacheWal::replay(*center, argv[3]));
+				center->add_commit_listener(wal);
+				wal->start();
+			}
+			snapshot_writer = std::make_unique<CacheSnapshotWriter>(center, argv[2], 60000, wal);
+			snapshot_writer->start();
+		}
+		if (argc > 4) {
+			std::string target = argv[4];
+			if (target.compare(0, 4, "udp:") == 0)
+				metrics_exporter = std::make_unique<MetricsExporter>(MetricsExporter::kExportUdp, target.substr(4));
+			else if (target.compare(0, 5, "unix:") == 0)
+				metrics_exporter = std::make_unique<MetricsExporter>(MetricsExporter::kExportUnix, target.substr(5));
+			else
+				metrics_exporter = std::make_unique<MetricsExporter>(MetricsExporter::kExportFile, target);
+			CacheMetrics::watch_data_center(center);
+			metrics_exporter->start();
+		}
+		bool warm = center->size() != 0;
+		//insert some data for test,after update,data would be guaranteed no change during kDefaultExpireMillisecond seconds
+		for (int i = 0; i < 50 && !warm; ++i) {
+			std::time_t timestamp;
+			center->update_op(i, std::to_string(50 - i), i * i,
+				[](csn::OpResult status, uint32_t op_id, std::time_t expire) {
+					LOG_OUT("update_op status %u op_id %u expire time %llu", status, op_id, expire); },
+				&timestamp);
+		}
+		LOG_OUT("start %u reactors", server.reactor_count());
+		server.start("*", 3824);
+	}
+	catch (csn::Exception e) {
+		LOG_OUT("csn::Exception code:%d describe:%s", e.code(), e.what());
+		return 1;
+	}
+	server.join();
+	return 0;
+}
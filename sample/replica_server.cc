@@ -0,0 +1,60 @@
+#include <cstdlib>
+#include <cstring>
+#include "common.h"
+#include "timer_queue.h"
+#include "socket_group_epoll_impl.h"
+#include "protobuf_message_server_impl.h"
+#include "cache_replication.h"
+
+//usage: sample_replica_server <port> primary <backup host> <backup port> [...]
+//		 sample_replica_server <port> backup [failover ms]
+//e.g. on one host:
+//		 sample_replica_server 3825 backup 1000
+//		 sample_replica_server 3824 primary 127.0.0.1 3825
+int main(int argc, char** argv)
+{
+	using namespace csn;
+	if (argc < 3 || (std::strcmp(argv[2], "primary") && std::strcmp(argv[2], "backup"))) {
+		LOG_OUT("usage: %s <port> primary <backup host> <backup port> [...] | <port> backup [failover ms]", argv[0]);
+		return 1;
+	}
+	bool primary = std::strcmp(argv[2], "primary") == 0;
+	SocketGroupEpollImpl group{};
+	std::shared_ptr<ProtobufMessageServerImpl> impl = std::make_shared<ProtobufMessageServerImpl>();
+	std::shared_ptr<CacheDataCenter<CacheDataType>> center = impl->data_center();
+	std::shared_ptr<CacheReplicator> replicator;
+	std::unique_ptr<CacheReplica> replica;
+	try {
+		if (primary) {
+			replicator = std::make_shared<CacheReplicator>();
+			for (int i = 3; i + 1 < argc; i += 2)
+				replicator->add_backup(argv[i], (uint16_t)std::atoi(argv[i + 1]));
+			center->add_commit_listener(replicator);
+			replicator->start();
+		}
+		else {
+			replica = std::make_unique<CacheReplica>(impl, argc > 3 ? (uint32_t)std::atoi(argv[3]) : 0);
+			replica->set_promote_handler([&replica]() {
+				LOG_OUT("promoted after %llu replicated values", (unsigned long long)replica->applied()); });
+			group.add_timer_source(replica.get());
+		}
+		std::shared_ptr<MessageServer<MmsgUdpSocket>> server = std::make_shared<MessageServer<MmsgUdpSocket>>();
+		server->set_message_impl(impl);
+		server->initialize("*", (uint16_t)std::atoi(argv[1]), "*", 0);
+		group.register_socket(server);
+		group.add_timer_source(TimerQueue::get_timer_queue());
+		group.add_timer_source(center.get());
+	}
+	catch (csn::Exception e) {
+		LOG_OUT("csn::Exception code:%d describe:%s", e.code(), e.what());
+		return 1;
+	}
+	while (true) {
+		try {
+			group.listen(-1);
+		}
+		catch (csn::Exception e) { LOG_OUT("csn::Exception code:%d describe:%s", e.code(), e.what()); }
+		catch (std::exception e) { LOG_OUT("std::exception code:%s", e.what()); }
+	}
+	return 0;
+}
@@ -7,9 +7,10 @@ int main(int argc, char** argv)
 {
 	using namespace csn;
 	SocketGroup<SocketGroupNetlinkImpl> group{};
+	std::shared_ptr<CacheDataCenter<CacheDataType>> center;
 	try {
 		std::shared_ptr<ProtobufMessageServerImpl> impl = std::make_shared<ProtobufMessageServerImpl>();
-		std::shared_ptr<CacheDataCenter<CacheDataType>> center = impl->data_center();
+		center = impl->data_center();
 		//insert some data for test,after update,data would be guaranteed no change during kDefaultExpireMillisecond seconds
 		for (int i = 0; i < 50; ++i) {
 			std::time_t timestamp;
@@ -23,12 +24,14 @@ int main(int argc, char** argv)
 		server->set_message_impl(impl);
 		server->initialize("*", 3824, "*", 0);
 		group.register_socket(server);
+		//ack retransmit and lease expire timers,listen wakes up for them
+		group.add_timer_source(csn::TimerQueue::get_timer_queue());
+		group.add_timer_source(center.get());
 	}
 	CATCH_EXPTIONS;
 	while (true) {
 		try {
-			csn::TimerQueue::get_timer_queue()->tick();
-			group.listen(0.03);
+			group.listen(-1);
 		}
 		CATCH_EXPTIONS;
 	}